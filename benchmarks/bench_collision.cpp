@@ -0,0 +1,152 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "core/box_collision.hpp"
+#include "core/obstacle_manager.hpp"
+#include "core/vehicle_manager.hpp"
+#include "core/counter_rng.hpp"
+#include "core/vehicle.hpp"
+#include <array>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace {
+    // Same tree density as the default map (30 trees on 200 x 200 m)
+    constexpr float DEFAULT_PLAY_AREA = 200.0f;
+    constexpr float DEFAULT_TREE_COUNT = 30.0f;
+    constexpr int PROBES_PER_AXIS = 32;
+
+    float playAreaFor(int treeCount) {
+        return DEFAULT_PLAY_AREA * std::sqrt(static_cast<float>(treeCount) / DEFAULT_TREE_COUNT);
+    }
+
+    // Evenly spread vehicle positions, so both hits and misses are measured
+    std::vector<std::array<float, 2>> probePositions(float playAreaSize) {
+        std::vector<std::array<float, 2>> positions;
+        const float step = playAreaSize / PROBES_PER_AXIS;
+        for (int i = 0; i < PROBES_PER_AXIS; ++i) {
+            for (int j = 0; j < PROBES_PER_AXIS; ++j) {
+                positions.push_back({-playAreaSize / 2.0f + (i + 0.5f) * step, -playAreaSize / 2.0f + (j + 0.5f) * step});
+            }
+        }
+        return positions;
+    }
+
+    // ObstacleManager::handleCollisions before the grid: every obstacle, every call
+    void handleCollisionsLinear(const ObstacleManager& manager, Vehicle& vehicle) {
+        for (const auto& obstacle : manager.getObstacles()) {
+            float overlapDistance, normalX, normalZ;
+            if (vehicle.checkCircleCollision(*obstacle, overlapDistance, normalX, normalZ)) {
+                const auto& vehiclePos = vehicle.getPosition();
+                vehicle.setPosition(vehiclePos[0] - normalX * overlapDistance, vehiclePos[1],
+                                    vehiclePos[2] - normalZ * overlapDistance);
+                vehicle.setVelocity(0.0f);
+                break;
+            }
+        }
+    }
+}
+
+TEST_CASE("Obstacle collision broadphase", "[benchmark][obstacle_manager]") {
+    for (const int treeCount : {30, 300, 3000}) {
+        const float playAreaSize = playAreaFor(treeCount);
+        ObstacleManager manager(playAreaSize, treeCount);
+        const auto probes = probePositions(playAreaSize);
+        Vehicle vehicle(0.0f, 0.0f, 0.0f);
+
+        const std::string suffix = std::to_string(treeCount) + " trees, " + std::to_string(manager.getCount()) + " obstacles";
+
+        BENCHMARK("linear scan, " + suffix) {
+            float checksum = 0.0f;
+            for (const auto& probe : probes) {
+                vehicle.setPosition(probe[0], 0.0f, probe[1]);
+                handleCollisionsLinear(manager, vehicle);
+                checksum += vehicle.getPosition()[0];
+            }
+            return checksum;
+        };
+
+        BENCHMARK("spatial grid, " + suffix) {
+            float checksum = 0.0f;
+            for (const auto& probe : probes) {
+                // Stationary probe, so only the overlap test runs and not a sweep from the last one
+                vehicle.setPosition(probe[0], 0.0f, probe[1]);
+                vehicle.storePreviousTransform();
+                manager.handleCollisions(vehicle);
+                checksum += vehicle.getPosition()[0];
+            }
+            return checksum;
+        };
+    }
+}
+
+TEST_CASE("Oriented box narrowphase", "[benchmark][box_collision]") {
+    constexpr int BOX_COUNT = 4096;
+
+    // A ring of wall-sized boxes at every angle around a moving car
+    std::vector<OrientedBox> boxes;
+    for (int i = 0; i < BOX_COUNT; ++i) {
+        const float angle = static_cast<float>(i) * 0.618f;
+        const float distance = 2.0f + static_cast<float>(i % 64) * 0.25f;
+        boxes.push_back({distance * std::cos(angle), distance * std::sin(angle), std::cos(angle * 3.0f),
+                         -std::sin(angle * 3.0f), 2.5f, 1.0f});
+    }
+    const OrientedBox car{0.0f, 0.0f, std::cos(0.3f), -std::sin(0.3f), 0.5f, 1.0f};
+
+    for (const SimdLevel level : {SimdLevel::SCALAR, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        BoxCollisionBatch batch(level);
+        for (const auto& box : boxes) {
+            batch.add(box);
+        }
+
+        BENCHMARK(std::string(simdLevelName(batch.getSimdLevel())) + ", " + std::to_string(BOX_COUNT) + " boxes") {
+            batch.sweep(car, 7.0f, -3.0f);
+            return batch.getTimeOfImpact(BOX_COUNT - 1);
+        };
+    }
+}
+
+TEST_CASE("Vehicle vs vehicle broadphase", "[benchmark][vehicle_manager]") {
+    constexpr float STEP = 1.0f / 60.0f;
+    constexpr float AREA_PER_VEHICLE = 100.0f;  // About a 10 m square per car
+
+    for (const int vehicleCount : {100, 500, 2000}) {
+        const float halfSize = std::sqrt(AREA_PER_VEHICLE * static_cast<float>(vehicleCount)) / 2.0f;
+        CounterRng random(1, RandomStream::TRAFFIC);
+
+        // Everyone driving and some turning, so the order on x keeps changing
+        VehicleManager manager;
+        manager.reserve(static_cast<std::size_t>(vehicleCount));
+        ControlState forward;
+        forward.forward = true;
+        ControlState left = forward;
+        left.left = true;
+        for (int i = 0; i < vehicleCount; ++i) {
+            const std::size_t index = manager.add(random.uniform(-halfSize, halfSize), 0.0f, random.uniform(-halfSize, halfSize));
+            manager.getVehicle(index).setRotation(random.uniform(0.0f, 6.3f));
+            manager.setControls(index, i % 2 == 0 ? left : forward);
+        }
+        manager.resolveCollisions();
+
+        const std::string suffix = std::to_string(vehicleCount) + " vehicles";
+
+        BENCHMARK("all pairs, " + suffix) {
+            int hits = 0;
+            const auto& vehicles = manager.getVehicles();
+            for (std::size_t i = 0; i < vehicles.size(); ++i) {
+                for (std::size_t j = i + 1; j < vehicles.size(); ++j) {
+                    float overlapDistance, normalX, normalZ;
+                    hits += vehicles[i]->checkCircleCollision(*vehicles[j], overlapDistance, normalX, normalZ) ? 1 : 0;
+                }
+            }
+            return hits;
+        };
+
+        // A whole tick: moving the cars is what makes the re-sort do any work
+        BENCHMARK("sweep and prune tick, " + suffix) {
+            manager.update(STEP);
+            manager.resolveCollisions();
+            return manager.getPairs().size();
+        };
+    }
+}
@@ -0,0 +1,88 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "core/job_system.hpp"
+#include "core/obstacle_manager.hpp"
+#include "core/vehicle_manager.hpp"
+#include "core/counter_rng.hpp"
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    // 1, 2, 4, ... up to every hardware thread, which is always included
+    std::vector<unsigned int> threadCounts() {
+        const unsigned int hardware = (std::max)(1u, std::thread::hardware_concurrency());
+        std::vector<unsigned int> counts;
+        for (unsigned int count = 1; count < hardware; count *= 2) {
+            counts.push_back(count);
+        }
+        counts.push_back(hardware);
+        return counts;
+    }
+}
+
+TEST_CASE("JobSystem scaling", "[benchmark][job_system]") {
+    constexpr std::size_t ELEMENT_COUNT = 1 << 20;
+    constexpr int ITERATIONS = 16;
+
+    std::vector<float> values(ELEMENT_COUNT);
+    for (std::size_t i = 0; i < ELEMENT_COUNT; ++i) {
+        values[i] = static_cast<float>(i) * 0.001f;
+    }
+
+    for (const unsigned int threadCount : threadCounts()) {
+        JobSystem jobs(threadCount);
+        const std::string suffix = std::to_string(threadCount) + (threadCount == 1 ? " thread" : " threads");
+
+        // Compute bound, so the only limit on scaling is the pool itself
+        BENCHMARK("parallelFor kernel, " + suffix) {
+            jobs.parallelFor("Kernel", values.size(), 0, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    float value = values[i];
+                    for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+                        value = std::sin(value) * 0.5f + 0.5f;
+                    }
+                    values[i] = value;
+                }
+            });
+            return values[0];
+        };
+    }
+}
+
+TEST_CASE("Traffic tick scaling", "[benchmark][job_system][vehicle_manager]") {
+    constexpr float STEP = 1.0f / 60.0f;
+    constexpr int VEHICLE_COUNT = 4000;
+    constexpr float PLAY_AREA_SIZE = 600.0f;
+
+    const ObstacleManager obstacles(PLAY_AREA_SIZE, 1000);
+    ControlState forward;
+    forward.forward = true;
+    ControlState left = forward;
+    left.left = true;
+
+    for (const unsigned int threadCount : threadCounts()) {
+        JobSystem jobs(threadCount);
+        VehicleManager manager(jobs);
+        manager.reserve(VEHICLE_COUNT);
+
+        CounterRng random(1, RandomStream::TRAFFIC);
+        const float halfSize = PLAY_AREA_SIZE / 2.0f - 20.0f;
+        for (int i = 0; i < VEHICLE_COUNT; ++i) {
+            const std::size_t index = manager.add(random.uniform(-halfSize, halfSize), 0.0f, random.uniform(-halfSize, halfSize));
+            manager.getVehicle(index).setRotation(random.uniform(0.0f, 6.3f));
+            manager.setControls(index, i % 2 == 0 ? left : forward);
+        }
+
+        // The whole traffic step as Simulation runs it; only the pair resolve stays serial
+        BENCHMARK("traffic tick, " + std::to_string(VEHICLE_COUNT) + " vehicles, " + std::to_string(threadCount) +
+                  (threadCount == 1 ? " thread" : " threads")) {
+            manager.update(STEP);
+            manager.resolveCollisions();
+            manager.handleObstacleCollisions(obstacles, STEP);
+            return manager.getPairs().size();
+        };
+    }
+}
@@ -0,0 +1,116 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "loaders/obj_parser.hpp"
+#include <threepp/threepp.hpp>
+#include <threepp/loaders/OBJLoader.hpp>
+#include <algorithm>
+#include <optional>
+#include <string>
+
+using namespace threepp;
+
+namespace {
+    const std::string STEERING_WHEEL_PATH = "assets/steeringwheel.obj";
+
+    MeshMaterial toMeshMaterial(const Material& material) {
+        MeshMaterial result;
+        result.name = material.name;
+        result.opacity = material.opacity;
+        if (const auto* phong = dynamic_cast<const MeshPhongMaterial*>(&material)) {
+            result.diffuse = {phong->color.r, phong->color.g, phong->color.b};
+            result.specular = {phong->specular.r, phong->specular.g, phong->specular.b};
+            result.emissive = {phong->emissive.r, phong->emissive.g, phong->emissive.b};
+            result.shininess = phong->shininess;
+        }
+        return result;
+    }
+
+    // Copy vertices [first, first + count) of geometry into part, expanding an index if present
+    void copyVertices(BufferGeometry& geometry, std::size_t first, std::size_t count, MeshPart& part) {
+        const auto* positions = geometry.getAttribute<float>("position");
+        const auto* normals = geometry.hasAttribute("normal") ? geometry.getAttribute<float>("normal") : nullptr;
+        const auto* uvs = geometry.hasAttribute("uv") ? geometry.getAttribute<float>("uv") : nullptr;
+        const auto* index = geometry.getIndex();
+
+        for (std::size_t i = first; i < first + count; ++i) {
+            const auto vertex = index ? static_cast<std::size_t>(index->array()[i]) : i;
+            for (std::size_t c = 0; c < 3; ++c) {
+                part.positions.push_back(positions->array()[vertex * 3 + c]);
+                if (normals) {
+                    part.normals.push_back(normals->array()[vertex * 3 + c]);
+                }
+            }
+            if (uvs) {
+                part.uvs.push_back(uvs->array()[vertex * 2]);
+                part.uvs.push_back(uvs->array()[vertex * 2 + 1]);
+            }
+        }
+    }
+
+    // The file through threepp's OBJLoader (the loader ObjParser replaced), copied out as MeshData
+    std::optional<MeshData> parseWithObjLoader(const std::string& path) {
+        OBJLoader loader;
+        auto group = loader.load(path);
+        if (!group) {
+            return std::nullopt;
+        }
+
+        MeshData mesh;
+        group->traverse([&mesh](Object3D& object) {
+            auto* threeMesh = object.as<Mesh>();
+            if (!threeMesh || !threeMesh->geometry()->hasAttribute("position")) {
+                return;
+            }
+            auto& geometry = *threeMesh->geometry();
+
+            // Materials are appended per mesh; OBJLoader already shares them by name within a file
+            const auto firstMaterial = static_cast<std::uint32_t>(mesh.materials.size());
+            for (const auto& material : threeMesh->materials()) {
+                mesh.materials.push_back(toMeshMaterial(*material));
+            }
+
+            const std::size_t vertexCount = geometry.getIndex() ? geometry.getIndex()->count()
+                                                                : geometry.getAttribute<float>("position")->count();
+            if (geometry.groups.empty()) {
+                MeshPart part;
+                part.name = object.name;
+                part.materialIndex = firstMaterial;
+                copyVertices(geometry, 0, vertexCount, part);
+                mesh.parts.push_back(std::move(part));
+                return;
+            }
+
+            // Multi-material mesh: one part per geometry group
+            for (const auto& range : geometry.groups) {
+                MeshPart part;
+                part.name = object.name;
+                part.materialIndex = firstMaterial + static_cast<std::uint32_t>(range.materialIndex);
+                copyVertices(geometry, range.start, (std::min)(static_cast<std::size_t>(range.count), vertexCount - range.start), part);
+                mesh.parts.push_back(std::move(part));
+            }
+        });
+
+        if (mesh.empty()) {
+            return std::nullopt;
+        }
+        return mesh;
+    }
+}
+
+// Same file through threepp's OBJLoader and ObjParser
+TEST_CASE("OBJ parsing against OBJLoader", "[benchmark][obj_parser]") {
+    const auto reference = parseWithObjLoader(STEERING_WHEEL_PATH);
+    const auto parsed = ObjParser::parseFile(STEERING_WHEEL_PATH);
+    REQUIRE(reference.has_value());
+    REQUIRE(parsed.has_value());
+    REQUIRE(parsed->getVertexCount() == reference->getVertexCount());
+    REQUIRE(parsed->parts.size() == reference->parts.size());
+
+    BENCHMARK("OBJLoader") {
+        return parseWithObjLoader(STEERING_WHEEL_PATH);
+    };
+
+    BENCHMARK("ObjParser") {
+        return ObjParser::parseFile(STEERING_WHEEL_PATH);
+    };
+}
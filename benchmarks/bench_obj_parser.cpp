@@ -0,0 +1,18 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "loaders/obj_parser.hpp"
+#include <string>
+
+namespace {
+    const std::string STEERING_WHEEL_PATH = "assets/steeringwheel.obj";
+}
+
+TEST_CASE("OBJ parsing", "[benchmark][obj_parser]") {
+    BENCHMARK("ObjParser, 1 thread") {
+        return ObjParser::parseFile(STEERING_WHEEL_PATH, 1);
+    };
+
+    BENCHMARK("ObjParser, all hardware threads") {
+        return ObjParser::parseFile(STEERING_WHEEL_PATH);
+    };
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Indices of objects whose state changed, kept in a fixed-size ring stamped with a running
+ * serial. A reader remembers the serial it last synced to and replays only the changes since,
+ * so its cost follows what changed rather than how many objects exist. A reader that fell
+ * more than Capacity changes behind gets false and has to resync everything.
+ * Trivially copyable, so it can travel inside a snapshot.
+ */
+template <std::size_t Capacity>
+struct ChangeList {
+    std::uint64_t serial = 0;  // Changes recorded so far
+    std::array<std::uint32_t, Capacity> indices{};
+
+    void record(std::uint32_t index) noexcept {
+        indices[serial % Capacity] = index;
+        ++serial;
+    }
+
+    // Call visit(index) for every change after sinceSerial, oldest first; false (and no calls)
+    // if some of them were already overwritten
+    template <typename Visitor>
+    [[nodiscard]] bool forEachSince(std::uint64_t sinceSerial, Visitor&& visit) const {
+        if (sinceSerial > serial || serial - sinceSerial > Capacity) {
+            return false;
+        }
+        for (std::uint64_t s = sinceSerial; s < serial; ++s) {
+            visit(indices[s % Capacity]);
+        }
+        return true;
+    }
+};
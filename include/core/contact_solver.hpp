@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "core/vehicle.hpp"
+
+/**
+ * Vehicle touching a static obstacle at the end of a step.
+ */
+struct Contact {
+    std::uint32_t obstacle = 0;  // Index in the obstacle list, also the key for warm starting
+    float normalX = 0.0f;        // Unit direction that moves the vehicle out of the obstacle
+    float normalZ = 0.0f;
+    float penetration = 0.0f;    // Overlap depth, negative for a gap inside the contact margin
+};
+
+/**
+ * Sequential-impulse contact solver for one vehicle against static obstacles (Catto,
+ * "Iterative Dynamics with Temporal Coherence"). All contacts of a tick are solved together
+ * for a fixed number of iterations: restitution on the normal, Coulomb friction along the
+ * surface. The accumulated impulses are kept per obstacle and applied up front the next tick
+ * while the contact persists, so resting and corner contacts settle instead of jittering.
+ * Contacts further than the contact skin from touching are speculative: they only stop the vehicle from closing
+ * the gap faster than it can within the step, and don't bounce.
+ *
+ * The vehicle only has a speed along its direction of travel, so the solver works on that as
+ * a velocity vector and hands back the part left along the direction of travel: a head-on hit
+ * bounces the car back, a glancing one slows it down.
+ */
+class ContactSolver {
+public:
+    // Impulses accumulated for one contact in the last solve
+    struct Impulse {
+        std::uint32_t obstacle;
+        float normal;
+        float tangent;
+    };
+
+    // Resolve the contacts (sorted by obstacle) for a step of deltaTime and remember their
+    // impulses for the next tick; returns true if the vehicle's position or velocity changed
+    bool solve(Vehicle& vehicle, const std::vector<Contact>& contacts, float deltaTime);
+
+    void clear() noexcept;
+
+    // Sorted by obstacle
+    [[nodiscard]] const std::vector<Impulse>& getImpulses() const noexcept { return impulses_; }
+
+private:
+    // Per-contact solver state for the current tick
+    struct Row {
+        float normalX;
+        float normalZ;
+        float targetNormalSpeed;  // Bounce speed wanted along the normal, negative to close a gap
+        float normalImpulse;
+        float tangentImpulse;
+    };
+
+    std::vector<Impulse> impulses_;
+    std::vector<Row> rows_;
+};
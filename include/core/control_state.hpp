@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include "core/interfaces/IControllable.hpp"
+
+/**
+ * Snapshot of which driving controls are held during a step.
+ * Shared by keyboard input, scripted headless runs and the simulation loop.
+ */
+struct ControlState {
+    bool forward = false;
+    bool backward = false;
+    bool left = false;
+    bool right = false;
+    bool drift = false;
+    bool nitrous = false;
+    bool reset = false;
+
+    [[nodiscard]] bool operator==(const ControlState& other) const noexcept = default;
+};
+
+// One bit per control, for atomics and recordings
+namespace ControlBit {
+    inline constexpr std::uint32_t FORWARD = 1u << 0;
+    inline constexpr std::uint32_t BACKWARD = 1u << 1;
+    inline constexpr std::uint32_t LEFT = 1u << 2;
+    inline constexpr std::uint32_t RIGHT = 1u << 3;
+    inline constexpr std::uint32_t DRIFT = 1u << 4;
+    inline constexpr std::uint32_t NITROUS = 1u << 5;
+    inline constexpr std::uint32_t RESET = 1u << 6;
+}
+
+[[nodiscard]] std::uint32_t packControls(const ControlState& controls) noexcept;
+[[nodiscard]] ControlState unpackControls(std::uint32_t bits) noexcept;
+
+/**
+ * Feed one step of controls into a controllable entity.
+ * Held controls are applied every step, drift/nitrous react to press and release edges.
+ * Reset is left to the caller since it affects more than the vehicle.
+ */
+void applyControls(IControllable& target, const ControlState& current, const ControlState& previous, float deltaTime) noexcept;
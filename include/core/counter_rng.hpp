@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+// Independent random streams drawn from one world seed
+enum class RandomStream : std::uint32_t {
+    TREES = 1,       // Substream: placement chunk
+    TREE_SELECTION,
+    POWERUPS,
+    TRAFFIC
+};
+
+/**
+ * Counter-based random numbers (Philox4x32-10, Salmon et al., "Parallel random numbers: as
+ * easy as 1, 2, 3"). Every value is a pure function of (seed, stream, substream, position):
+ * there is no state to share or hand over, so each chunk, object type or thread gets its own
+ * stream and the results never depend on who draws first or how the work is split.
+ * The uniform helpers avoid <random>'s distributions, whose output differs between standard
+ * library implementations.
+ */
+class CounterRng {
+public:
+    using result_type = std::uint32_t;
+
+    constexpr CounterRng(std::uint64_t seed, RandomStream stream, std::uint32_t substream = 0) noexcept
+        : key_{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)},
+          stream_(static_cast<std::uint32_t>(stream)),
+          substream_(substream) {
+    }
+
+    // Philox4x32-10 of a full 128-bit counter
+    [[nodiscard]] static constexpr std::array<std::uint32_t, 4> philox(std::array<std::uint32_t, 4> counter,
+                                                                      std::array<std::uint32_t, 2> key) noexcept {
+        for (int round = 0; round < ROUNDS; ++round) {
+            const std::uint64_t product0 = static_cast<std::uint64_t>(MULTIPLIER_0) * counter[0];
+            const std::uint64_t product1 = static_cast<std::uint64_t>(MULTIPLIER_1) * counter[2];
+            counter = {
+                static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                static_cast<std::uint32_t>(product1),
+                static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                static_cast<std::uint32_t>(product0)
+            };
+            key[0] += WEYL_0;
+            key[1] += WEYL_1;
+        }
+        return counter;
+    }
+
+    // Value at a position of this stream; doesn't move the sequential position
+    [[nodiscard]] constexpr result_type at(std::uint64_t position) const noexcept {
+        const std::uint64_t block = position / BLOCK_SIZE;
+        return philox({static_cast<std::uint32_t>(block), static_cast<std::uint32_t>(block >> 32), stream_, substream_},
+                      key_)[position % BLOCK_SIZE];
+    }
+
+    // Sequential use; also a UniformRandomBitGenerator
+    constexpr result_type operator()() noexcept {
+        if (position_ % BLOCK_SIZE == 0) {
+            const std::uint64_t block = position_ / BLOCK_SIZE;
+            buffer_ = philox({static_cast<std::uint32_t>(block), static_cast<std::uint32_t>(block >> 32), stream_, substream_},
+                             key_);
+        }
+        return buffer_[position_++ % BLOCK_SIZE];
+    }
+
+    [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+    [[nodiscard]] static constexpr result_type max() noexcept { return (std::numeric_limits<result_type>::max)(); }
+
+    // [0, 1) with 24 random bits, exact in float
+    constexpr float uniform() noexcept {
+        return static_cast<float>((*this)() >> 8) * UNIT_SCALE;
+    }
+
+    constexpr float uniform(float low, float high) noexcept {
+        return low + (high - low) * uniform();
+    }
+
+    // [0, bound) by multiply-shift; the bias is below 2^-32 * bound
+    constexpr std::uint32_t below(std::uint32_t bound) noexcept {
+        return static_cast<std::uint32_t>((static_cast<std::uint64_t>((*this)()) * bound) >> 32);
+    }
+
+    [[nodiscard]] constexpr std::uint64_t getPosition() const noexcept { return position_; }
+
+private:
+    static constexpr int ROUNDS = 10;
+    static constexpr std::uint32_t MULTIPLIER_0 = 0xD2511F53u;
+    static constexpr std::uint32_t MULTIPLIER_1 = 0xCD9E8D57u;
+    static constexpr std::uint32_t WEYL_0 = 0x9E3779B9u;  // Golden ratio
+    static constexpr std::uint32_t WEYL_1 = 0xBB67AE85u;  // sqrt(3) - 1
+    static constexpr std::uint64_t BLOCK_SIZE = 4;
+    static constexpr float UNIT_SCALE = 1.0f / 16777216.0f;  // 2^-24
+
+    std::array<std::uint32_t, 2> key_;
+    std::uint32_t stream_;
+    std::uint32_t substream_;
+    std::uint64_t position_ = 0;
+    std::array<std::uint32_t, 4> buffer_{};
+};
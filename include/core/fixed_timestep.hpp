@@ -0,0 +1,35 @@
+#pragma once
+
+#include "core/game_config.hpp"
+
+/**
+ * Accumulator that turns variable frame times into a whole number of fixed simulation steps.
+ * Physics then runs at the same rate and gives the same results whether we render at 30 or 144 Hz;
+ * the leftover fraction of a step is exposed as an interpolation factor for rendering.
+ */
+class FixedTimestep {
+public:
+    explicit FixedTimestep(float tickRate = GameConfig::Timing::TICK_RATE,
+                           int maxStepsPerFrame = GameConfig::Timing::MAX_STEPS_PER_FRAME);
+
+    // Add one frame of wall time, returns how many fixed steps to run now
+    [[nodiscard]] int advance(float frameTime) noexcept;
+
+    // Fraction of a step left in the accumulator, 0 = previous state, 1 = current state
+    [[nodiscard]] float getAlpha() const noexcept;
+
+    [[nodiscard]] float getStepSize() const noexcept { return stepSize_; }
+    [[nodiscard]] float getTickRate() const noexcept { return 1.0f / stepSize_; }
+    void setTickRate(float tickRate) noexcept;
+
+    // Time thrown away because a frame needed more than maxStepsPerFrame steps
+    [[nodiscard]] double getDroppedTime() const noexcept { return droppedTime_; }
+
+    void reset() noexcept;
+
+private:
+    float stepSize_;
+    int maxStepsPerFrame_;
+    double accumulator_;
+    double droppedTime_;
+};
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 #include <threepp/threepp.hpp>
-#include "core/vehicle.hpp"
-#include "core/powerup_manager.hpp"
-#include "core/obstacle_manager.hpp"
+#include "core/simulation.hpp"
+#include "core/input_recording.hpp"
+#include "core/simulation_thread.hpp"
+#include "core/simulation_snapshot.hpp"
 #include "graphics/vehicle_renderer.hpp"
 #include "graphics/powerup_renderer.hpp"
 #include "graphics/obstacle_renderer.hpp"
@@ -13,6 +15,7 @@
 #include "input/input_handler.hpp"
 #include "audio/audio_manager.hpp"
 #include "ui/imgui_layer.hpp"
+#include "ui/minimap_overlay.hpp"
 
 /**
  * Main game coordinator.
@@ -21,7 +24,10 @@
 class Game {
 public:
     explicit Game(threepp::Canvas& canvas);
-    ~Game() = default;
+    ~Game();
+
+    // Record every tick's controls and save them to path on exit; call before initialize()
+    void recordInputTo(std::string path);
 
     void initialize();
     void update(float deltaTime);
@@ -31,6 +37,7 @@ public:
 
 private:
     void initializeScene();
+    void initializeSimulation();
     void initializeVehicle();
     void initializeObstacles();
     void initializePowerups();
@@ -38,31 +45,39 @@ private:
     void initializeAudio();
     void initializeUI();
 
-    void updateGameState(float deltaTime);
+    void updateGameState();
     void updateCamera();
     void updateAudio();
 
     void renderMainView();
     void renderMinimap();
     void renderUI();
+    void renderMinimapOverlay();
 
     threepp::Canvas& canvas_;
 
     std::unique_ptr<SceneManager> sceneManager_;
-    std::unique_ptr<Vehicle> vehicle_;
-    std::unique_ptr<VehicleRenderer> vehicleRenderer_;
+    std::unique_ptr<Simulation> simulation_;
+    std::string recordingPath_;
+    std::unique_ptr<InputRecording> recording_;
+    std::unique_ptr<SimulationThread> simulationThread_;  // Declared after simulation_ so it stops first
 
-    std::unique_ptr<ObstacleManager> obstacleManager_;
-    std::unique_ptr<PowerupManager> powerupManager_;
+    // Render-side view of the latest snapshot
+    VehicleStateView vehicleView_;
+    TransformState vehicleTransform_;
+    std::uint32_t lastResetCount_;
+    std::unique_ptr<VehicleRenderer> vehicleRenderer_;
 
-    std::vector<std::unique_ptr<ObstacleRenderer>> obstacleRenderers_;
-    std::vector<std::unique_ptr<PowerupRenderer>> powerupRenderers_;
+    std::unique_ptr<ObstacleRenderer> obstacleRenderer_;
+    std::unique_ptr<PowerupRenderer> powerupRenderer_;
 
     std::unique_ptr<InputHandler> inputHandler_;
     std::unique_ptr<AudioManager> audioManager_;
     std::unique_ptr<ImGuiLayer> imguiLayer_;
+    std::unique_ptr<MinimapOverlay> minimapOverlay_;
 
     bool audioEnabled_;
+    bool profilerVisible_;
     bool shouldExit_;
     threepp::Clock clock_;
 
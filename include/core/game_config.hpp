@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 /**
  * Centralized game configuration constants
  * All magic numbers and tunable parameters should be defined here
@@ -9,6 +11,8 @@ namespace GameConfig {
 
 // World configuration
 namespace World {
+    // Same seed, same obstacle and powerup layout (on any machine and thread count)
+    inline constexpr std::uint32_t SEED = 0xC0FFEEu;
     inline constexpr float PLAY_AREA_SIZE = 200.0f;
     inline constexpr float SPAWN_POINT_X = 0.0f;
     inline constexpr float SPAWN_POINT_Y = 0.0f;
@@ -18,7 +22,10 @@ namespace World {
 // Powerup spawning configuration
 namespace Powerup {
     inline constexpr int DEFAULT_COUNT = 20;
+    inline constexpr int MAX_COUNT = 256;         // Capacity of the render snapshot
+    inline constexpr int CHANGE_LIST_SIZE = 64;   // Changes the renderer can fall behind before a full resync
     inline constexpr float SPAWN_MARGIN = 10.0f;  // Distance from play area edges
+    inline constexpr float MIN_SPACING = 5.0f;    // Between powerups, so two never overlap
     inline constexpr float HEIGHT = 0.4f;         // Fixed height above ground
 }
 
@@ -34,15 +41,54 @@ namespace Obstacle {
     inline constexpr float WALL_HEIGHT = 2.5f;
     inline constexpr float WALL_THICKNESS = 2.0f;
     inline constexpr float WALL_SEGMENT_LENGTH = 5.0f;
+
+    // Broadphase cell edge, a bit larger than the biggest obstacle so most touch one or two cells
+    inline constexpr float GRID_CELL_SIZE = 8.0f;
+}
+
+// Other vehicles sharing the world with the player
+namespace Traffic {
+    inline constexpr int DEFAULT_COUNT = 0;
+    inline constexpr float SPAWN_MARGIN = 15.0f;             // Distance from play area edges
+    inline constexpr float MIN_SPACING = 4.0f;               // Between spawn points, more than a car length
+    inline constexpr float MIN_DISTANCE_FROM_SPAWN = 6.0f;   // Keeps the player's spawn point clear
+}
+
+// Contact solver between the vehicle and obstacles
+namespace Collision {
+    inline constexpr int SOLVER_ITERATIONS = 8;
+    inline constexpr float RESTITUTION = 0.2f;            // Share of the approach speed given back as bounce
+    inline constexpr float RESTITUTION_MIN_SPEED = 1.0f;  // Slower impacts don't bounce, so resting contact stays put
+    inline constexpr float FRICTION = 0.5f;
+    inline constexpr float CONTACT_MARGIN = 0.05f;        // Gaps narrower than this are solved as speculative contacts
+    inline constexpr float CONTACT_SKIN = 0.01f;          // Left by the sweep in front of what it hit; this close counts as touching
+    inline constexpr float PENETRATION_SLOP = 0.005f;     // Overlap left in place so resting contacts persist
 }
 
 // UI configuration
 namespace UI {
     inline constexpr int MINIMAP_SIZE = 150;
+    inline constexpr int MINIMAP_OVERVIEW_SIZE = 300;  // Whole-arena map is drawn larger
     inline constexpr int MINIMAP_PADDING = 10;
+    inline constexpr float MINIMAP_OVERVIEW_MARGIN = 5.0f;  // World units around the play area
     inline constexpr float MINIMAP_ASPECT_RATIO = 1.0f;
 }
 
+// Fixed-step simulation loop
+namespace Timing {
+    inline constexpr float TICK_RATE = 60.0f;          // Physics steps per second
+    inline constexpr float MIN_TICK_RATE = 20.0f;
+    inline constexpr float MAX_TICK_RATE = 240.0f;
+    inline constexpr float MAX_FRAME_TIME = 0.25f;     // Longer frames (debugger, window drag) are cut short
+    inline constexpr int MAX_STEPS_PER_FRAME = 8;      // Drop time instead of spiralling when the CPU can't keep up
+}
+
+// Headless runner defaults (carsim_headless)
+namespace Headless {
+    inline constexpr long long DEFAULT_TICKS = 1'000'000;
+    inline constexpr float DEFAULT_TIME_STEP = 1.0f / 60.0f;
+}
+
 // Asset paths
 namespace Assets {
     inline constexpr const char* CAR_MODEL_PATH = "assets/body.obj";
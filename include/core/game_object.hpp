@@ -1,6 +1,8 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
+#include "core/transform_state.hpp"
 
 /**
  * Base for all game entities.
@@ -22,6 +24,17 @@ public:
     [[nodiscard]] virtual float getRotation() const noexcept;
     [[nodiscard]] const std::array<float, 3>& getSize() const noexcept;
     [[nodiscard]] virtual bool isActive() const noexcept;
+    [[nodiscard]] float getCollisionRadius() const noexcept { return collisionRadius_; }
+
+    // Bumped whenever position, rotation or active state changes, so observers can skip
+    // objects they have already synced
+    [[nodiscard]] std::uint32_t getVersion() const noexcept { return version_; }
+
+    // Transform at the start of the current step, for render interpolation and swept collision
+    void storePreviousTransform() noexcept;
+    [[nodiscard]] const std::array<float, 3>& getPreviousPosition() const noexcept { return previousPosition_; }
+    [[nodiscard]] float getPreviousRotation() const noexcept { return previousRotation_; }
+    [[nodiscard]] TransformState getInterpolatedTransform(float alpha) const noexcept;
 
     // Setters
     void setPosition(float x, float y, float z) noexcept;
@@ -38,8 +51,10 @@ protected:
     // Transform
     std::array<float, 3> position_;
     std::array<float, 3> initialPosition_;
+    std::array<float, 3> previousPosition_;
     float rotation_;
     float initialRotation_;
+    float previousRotation_;
 
     // Collision
     std::array<float, 3> size_;
@@ -47,6 +62,10 @@ protected:
 
     // State
     bool active_;
+    std::uint32_t version_;
+
+    // Derived classes that write the transform members directly call this
+    void markChanged() noexcept { ++version_; }
 
     // Recalculate collision radius when size changes
     void updateCollisionRadius() noexcept;
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "core/control_state.hpp"
+#include "core/simulation.hpp"
+
+/**
+ * A recorded session: the world it ran in plus the controls fed to every fixed step.
+ * Only changes are stored, as (tick, controls) commands, so holding a key costs nothing.
+ *
+ * Binary format, little-endian:
+ *     "CSRP" magic, u16 version
+ *     u32 seed, f32 play area size, i32 tree count, i32 powerup count, f32 step size
+ *     u64 tick count, u64 command count
+ *     per command: LEB128 tick delta from the previous command, u8 control bits
+ */
+class InputRecording {
+public:
+    // Everything needed to rebuild the same world
+    struct World {
+        std::uint32_t seed = GameConfig::World::SEED;
+        float playAreaSize = GameConfig::World::PLAY_AREA_SIZE;
+        std::int32_t treeCount = GameConfig::Obstacle::DEFAULT_TREE_COUNT;
+        std::int32_t powerupCount = GameConfig::Powerup::DEFAULT_COUNT;
+        float stepSize = GameConfig::Headless::DEFAULT_TIME_STEP;
+
+        [[nodiscard]] bool operator==(const World& other) const noexcept = default;
+    };
+
+    // Controls held from this tick until the next command
+    struct Command {
+        std::uint64_t tick = 0;
+        ControlState controls;
+
+        [[nodiscard]] bool operator==(const Command& other) const noexcept = default;
+    };
+
+    InputRecording() = default;
+    explicit InputRecording(const World& world);
+
+    // Controls fed to the step at this tick; ticks must not go backwards
+    void record(std::uint64_t tick, const ControlState& controls);
+
+    // Length of the session, at least one past the last recorded tick
+    void setTickCount(std::uint64_t tickCount) noexcept;
+
+    [[nodiscard]] ControlState controlsAt(std::uint64_t tick) const noexcept;
+
+    [[nodiscard]] const World& getWorld() const noexcept { return world_; }
+    [[nodiscard]] std::uint64_t getTickCount() const noexcept { return tickCount_; }
+    [[nodiscard]] const std::vector<Command>& getCommands() const noexcept { return commands_; }
+
+    // Throw std::runtime_error on I/O errors or a malformed file
+    void save(std::ostream& output) const;
+    void saveToFile(const std::string& path) const;
+    [[nodiscard]] static InputRecording load(std::istream& input);
+    [[nodiscard]] static InputRecording loadFromFile(const std::string& path);
+
+private:
+    World world_;
+    std::uint64_t tickCount_ = 0;
+    std::vector<Command> commands_;
+};
+
+/**
+ * Replays a recording: rebuilds its world from the seed and steps it with the recorded
+ * controls at the recorded step size, tick for tick.
+ */
+class InputReplay {
+public:
+    explicit InputReplay(InputRecording recording);
+
+    // Advance one tick; false once the recording is over
+    bool step();
+
+    // Play the rest of the recording
+    void run();
+
+    [[nodiscard]] bool isFinished() const noexcept;
+    [[nodiscard]] Simulation& getSimulation() noexcept { return simulation_; }
+    [[nodiscard]] const InputRecording& getRecording() const noexcept { return recording_; }
+
+private:
+    InputRecording recording_;
+    Simulation simulation_;
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <istream>
+#include <string>
+#include <vector>
+#include "core/control_state.hpp"
+
+/**
+ * Timed sequence of held controls for headless runs.
+ *
+ * Text format, one segment per line:
+ *     <duration seconds> <keys...>
+ * Keys are W, A, S, D, SPACE (drift), F (nitrous) and R (reset), either as separate
+ * tokens or glued together ("WA"). Use "-" for no input. '#' starts a comment.
+ * The script loops when the run is longer than the script.
+ */
+class InputScript {
+public:
+    struct Segment {
+        float duration;
+        ControlState controls;
+    };
+
+    InputScript() = default;
+    explicit InputScript(std::vector<Segment> segments);
+
+    // Throws std::runtime_error with the offending line number on malformed input
+    [[nodiscard]] static InputScript parse(std::istream& input);
+    [[nodiscard]] static InputScript loadFromFile(const std::string& path);
+
+    // Built-in lap around the arena used when no script is given
+    [[nodiscard]] static InputScript defaultLap();
+
+    // Controls held at the given time since start (wraps around)
+    [[nodiscard]] ControlState controlsAt(double time) const noexcept;
+
+    [[nodiscard]] double getDuration() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] const std::vector<Segment>& getSegments() const noexcept;
+
+private:
+    std::vector<Segment> segments_;
+    std::vector<double> segmentEnds_;  // Cumulative end times for lookup
+};
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Work-stealing thread pool for the simulation's data-parallel work.
+ * Every worker owns a deque: it pushes and pops its own jobs at the back (newest first, still
+ * warm in cache) and, once it runs dry, steals the oldest job from the front of someone
+ * else's. Threads outside the pool share one extra deque. A thread waiting for its jobs keeps
+ * running queued ones instead of blocking, so parallelFor and task graphs nest freely, and
+ * the calling thread always takes part, so a pool of one thread runs everything inline.
+ *
+ * Each job runs inside a profiler zone named after it, and an optional observer gets the
+ * timing of every job for custom statistics.
+ * Jobs must not throw.
+ */
+class JobSystem {
+public:
+    // One finished job, as seen by the task observer
+    struct TaskTiming {
+        const char* name;
+        unsigned int threadIndex;  // See getCurrentThreadIndex()
+        std::int64_t startNanoseconds;
+        std::int64_t endNanoseconds;
+    };
+    using TaskObserver = std::function<void(const TaskTiming&)>;
+
+    struct Stats {
+        std::uint64_t executed = 0;  // Jobs run, including inline ones
+        std::uint64_t stolen = 0;    // Jobs taken from another thread's deque
+    };
+
+    /**
+     * Tasks with dependencies, built once and run any number of times. A task starts once
+     * every task that precedes it has finished; independent tasks run in parallel.
+     */
+    class TaskGraph {
+    public:
+        using TaskId = std::uint32_t;
+
+        // name must be a string literal (it is kept, not copied)
+        TaskId add(const char* name, std::function<void()> work);
+        // after waits for before; the graph must stay acyclic
+        void precede(TaskId before, TaskId after);
+        void clear() noexcept;
+        [[nodiscard]] std::size_t size() const noexcept { return nodes_.size(); }
+
+    private:
+        friend class JobSystem;
+
+        struct Node {
+            const char* name;
+            std::function<void()> work;
+            std::vector<TaskId> successors;
+            std::uint32_t dependencyCount = 0;
+        };
+
+        std::vector<Node> nodes_;
+        std::unique_ptr<std::atomic<std::uint32_t>[]> remaining_;  // Unfinished predecessors during run()
+        std::size_t remainingSize_ = 0;
+    };
+
+    // threadCount includes the calling thread; 0 uses every hardware thread
+    explicit JobSystem(unsigned int threadCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Process-wide pool used by the core systems
+    [[nodiscard]] static JobSystem& instance();
+
+    [[nodiscard]] unsigned int getThreadCount() const noexcept { return static_cast<unsigned int>(workers_.size()) + 1; }
+    // 1 to getThreadCount() - 1 on this pool's workers, 0 on any other thread. Not a key for
+    // scratch: outside threads all share 0, and a thread waiting in parallelFor() or run() may
+    // run anyone's jobs meanwhile, so keep scratch per chunk instead
+    [[nodiscard]] unsigned int getCurrentThreadIndex() const noexcept;
+
+    /**
+     * Call body(begin, end) for consecutive chunks of [0, count), chunkSize indices each (the
+     * last may be shorter), and return once all are done. chunkSize 0 picks a few chunks per
+     * thread. A job that covers everything runs inline on the caller.
+     */
+    template <typename Body>
+    void parallelFor(const char* name, std::size_t count, std::size_t chunkSize, Body&& body) {
+        if (count == 0) {
+            return;
+        }
+        if (chunkSize == 0) {
+            chunkSize = defaultChunkSize(count);
+        }
+
+        using Function = std::remove_reference_t<Body>;
+        void* context = const_cast<void*>(static_cast<const void*>(std::addressof(body)));
+        const std::size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+        std::atomic<std::size_t> pending{chunkCount};
+
+        if (chunkCount == 1 || workers_.empty()) {
+            for (std::size_t begin = 0; begin < count; begin += chunkSize) {
+                execute({name, &invokeRange<Function>, context, begin, (std::min)(begin + chunkSize, count), &pending},
+                        getCurrentThreadIndex());
+            }
+            return;
+        }
+
+        std::vector<Job> jobs;
+        jobs.reserve(chunkCount);
+        for (std::size_t begin = 0; begin < count; begin += chunkSize) {
+            jobs.push_back({name, &invokeRange<Function>, context, begin, (std::min)(begin + chunkSize, count), &pending});
+        }
+        push(jobs.data(), jobs.size());
+        wait(pending);
+    }
+
+    // Run every task of the graph and return once all are done
+    void run(TaskGraph& graph);
+
+    // Called from whichever thread ran the job, so it must be thread safe; set it while the
+    // pool is idle
+    void setTaskObserver(TaskObserver observer);
+
+    [[nodiscard]] Stats getStats() const noexcept;
+
+private:
+    struct Job {
+        const char* name;
+        void (*invoke)(void* context, std::size_t begin, std::size_t end);
+        void* context;
+        std::size_t begin;
+        std::size_t end;
+        std::atomic<std::size_t>* pending;  // Decremented once the job has finished
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    template <typename Function>
+    static void invokeRange(void* context, std::size_t begin, std::size_t end) {
+        (*static_cast<Function*>(context))(begin, end);
+    }
+
+    static void invokeGraphNode(void* context, std::size_t node, std::size_t);
+
+    [[nodiscard]] std::size_t defaultChunkSize(std::size_t count) const noexcept;
+
+    // Onto the calling thread's deque
+    void push(const Job* jobs, std::size_t count);
+    // One job from the own deque or, failing that, stolen from another; false if all are empty
+    bool tryRunOne(unsigned int threadIndex);
+    void execute(const Job& job, unsigned int threadIndex);
+    // Run queued jobs until pending drops to zero
+    void wait(const std::atomic<std::size_t>& pending);
+    void workerLoop(unsigned int threadIndex);
+
+    std::vector<std::unique_ptr<Queue>> queues_;  // [0] for outside threads, [i] for worker i
+
+    std::atomic<std::size_t> queuedJobs_{0};
+    std::atomic<bool> stopping_{false};
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+
+    TaskObserver observer_;
+    std::atomic<std::uint64_t> executed_{0};
+    std::atomic<std::uint64_t> stolen_{0};
+
+    std::vector<std::thread> workers_;  // Last member: started once everything above exists
+};
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Distance-based level-of-detail choice with hysteresis.
+ * Level i is used up to switchDistances[i]; beyond the last distance the object is culled.
+ * An object only moves to a coarser level once it is a margin past the switch distance, and
+ * back only once it is the same margin inside it, so objects sitting on a boundary don't
+ * flicker between meshes as the camera jitters.
+ */
+class LodSelector {
+public:
+    // switchDistances ascending; hysteresis is a fraction of each switch distance
+    LodSelector(std::vector<float> switchDistances, float hysteresis);
+
+    // Level to use this frame given last frame's; getCulledLevel() for "not drawn"
+    [[nodiscard]] std::uint8_t select(std::uint8_t current, float distance) const noexcept;
+
+    [[nodiscard]] std::uint8_t getLevelCount() const noexcept { return static_cast<std::uint8_t>(switchDistances_.size()); }
+    [[nodiscard]] std::uint8_t getCulledLevel() const noexcept { return getLevelCount(); }
+
+    // Farthest distance at which anything can still be drawn
+    [[nodiscard]] float getMaxDistance() const noexcept;
+
+private:
+    [[nodiscard]] std::uint8_t levelAt(float distance, float distanceScale) const noexcept;
+
+    std::vector<float> switchDistances_;
+    float hysteresis_;
+};
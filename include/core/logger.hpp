@@ -1,43 +1,237 @@
 #pragma once
 
-#include <iostream>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
 #include <string_view>
+#include <thread>
+#include <type_traits>
+
+// Lowest level compiled in: 0 debug, 1 info, 2 warning, 3 error (set by CMake's CARSIM_LOG_LEVEL)
+#ifndef CARSIM_LOG_MIN_LEVEL
+#define CARSIM_LOG_MIN_LEVEL 1
+#endif
 
 /**
- * Simple logging utility for the application
- * Provides consistent formatting for different log levels
+ * Asynchronous logging utility for the application.
+ * A call formats its arguments straight into a slot of a lock-free ring buffer and returns;
+ * a background thread drains the ring to stdout/stderr and flushes only when it runs dry, so
+ * logging from the simulation or render loop never waits on the console. Levels below
+ * CARSIM_LOG_MIN_LEVEL compile to nothing. When the ring is full, messages are dropped (and
+ * counted) rather than blocking the caller. Errors are flushed before the call returns.
+ * The functions still evaluate their arguments at a compiled-out level; the CARSIM_LOG_*
+ * macros skip them too, so hot paths use those.
+ *
+ *   Logger::info("Game initialization complete.");
+ *   CARSIM_LOG_DEBUG(Logger::Tag::COLLISION, "Hit obstacle ", index, " overlap ", overlap);
  */
 namespace Logger {
-    enum class Level {
+    enum class Level : std::uint8_t {
+        DEBUG,
         INFO,
         WARNING,
         ERROR
     };
 
-    inline void log(Level level, std::string_view message) {
-        switch (level) {
-            case Level::INFO:
-                std::cout << "[INFO] " << message << std::endl;
-                break;
-            case Level::WARNING:
-                std::cout << "[WARNING] " << message << std::endl;
-                break;
-            case Level::ERROR:
-                std::cerr << "[ERROR] " << message << std::endl;
-                break;
+    // Subsystem a message comes from, printed after the level
+    enum class Tag : std::uint8_t {
+        GENERAL,
+        CORE,
+        PHYSICS,
+        COLLISION,
+        LOADERS,
+        GRAPHICS,
+        AUDIO,
+        INPUT,
+        UI
+    };
+
+    inline constexpr Level MIN_LEVEL = static_cast<Level>(CARSIM_LOG_MIN_LEVEL);
+
+    [[nodiscard]] constexpr bool isEnabled(Level level) noexcept {
+        return level >= MIN_LEVEL;
+    }
+
+    [[nodiscard]] std::string_view toString(Level level) noexcept;
+    [[nodiscard]] std::string_view toString(Tag tag) noexcept;
+
+    // One message as it sits in the ring
+    struct Record {
+        static constexpr std::size_t TEXT_CAPACITY = 240;
+
+        Level level = Level::INFO;
+        Tag tag = Tag::GENERAL;
+        std::uint16_t length = 0;
+        std::array<char, TEXT_CAPACITY> text{};
+
+        [[nodiscard]] std::string_view message() const noexcept { return {text.data(), length}; }
+    };
+
+    // "[LEVEL] [tag] message", without the tag for GENERAL
+    [[nodiscard]] std::string format(const Record& record);
+
+    // Appends values to a record's text without allocating; overlong messages end in "..."
+    class MessageBuilder {
+    public:
+        explicit MessageBuilder(Record& record) noexcept : record_(record) { record_.length = 0; }
+
+        template <typename T>
+        void append(const T& value) noexcept {
+            if constexpr (std::is_same_v<T, bool>) {
+                appendText(value ? "true" : "false");
+            } else if constexpr (std::is_same_v<T, char>) {
+                appendText(std::string_view(&value, 1));
+            } else if constexpr (std::is_arithmetic_v<T>) {
+                std::array<char, 64> digits;
+                const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+                appendText(std::string_view(digits.data(), static_cast<std::size_t>(result.ptr - digits.data())));
+            } else {
+                static_assert(std::is_convertible_v<const T&, std::string_view>,
+                              "Logger arguments must be numbers, bools or strings");
+                appendText(std::string_view(value));
+            }
+        }
+
+    private:
+        void appendText(std::string_view text) noexcept;
+
+        Record& record_;
+    };
+
+    /**
+     * Bounded multi-producer, single-consumer queue of records with its own drain thread.
+     * Producers claim a slot with one compare-and-swap on the write position and publish it
+     * through the slot's sequence number (Vyukov's bounded queue), so they never lock and
+     * never wait on the consumer.
+     */
+    class AsyncWriter {
+    public:
+        static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+
+        using WriteFunction = std::function<void(const Record& record)>;
+        using FlushFunction = std::function<void()>;
+
+        // write is called for every record, flush whenever the queue runs empty; both only
+        // on the drain thread. The capacity is rounded up to a power of two.
+        explicit AsyncWriter(WriteFunction write, FlushFunction flush = {},
+                             std::size_t capacity = DEFAULT_CAPACITY);
+        ~AsyncWriter();
+
+        AsyncWriter(const AsyncWriter&) = delete;
+        AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+        // Console writer used by the Logger functions
+        [[nodiscard]] static AsyncWriter& instance();
+
+        // Format into the ring; false if it was full and the message was dropped
+        template <typename... Args>
+        bool write(Level level, Tag tag, const Args&... args) noexcept {
+            Slot* slot = claim();
+            if (!slot) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            slot->record.level = level;
+            slot->record.tag = tag;
+            MessageBuilder builder(slot->record);
+            (builder.append(args), ...);
+            publish(*slot);
+            return true;
+        }
+
+        // Block until everything written before the call has been handed to flush
+        void flush();
+
+        [[nodiscard]] std::uint64_t getDroppedCount() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+        [[nodiscard]] std::size_t getCapacity() const noexcept { return mask_ + 1; }
+
+    private:
+        struct Slot {
+            std::atomic<std::uint64_t> sequence{0};
+            Record record;
+        };
+
+        [[nodiscard]] Slot* claim() noexcept;
+        static void publish(Slot& slot) noexcept;
+
+        void run();
+        std::size_t drain();
+        void reportDropped();
+
+        WriteFunction write_;
+        FlushFunction flush_;
+        const std::size_t mask_;
+        std::unique_ptr<Slot[]> slots_;
+
+        // Producer and consumer positions on separate cache lines
+        alignas(64) std::atomic<std::uint64_t> writePosition_{0};
+        alignas(64) std::atomic<std::uint64_t> readPosition_{0};
+        std::atomic<std::uint64_t> flushedPosition_{0};
+        std::atomic<std::uint64_t> dropped_{0};
+        std::uint64_t reportedDropped_ = 0;  // Drain thread only
+
+        std::atomic<bool> running_{true};
+        std::thread thread_;
+    };
+
+    template <Level L, typename... Args>
+    void log(Tag tag, const Args&... args) {
+        if constexpr (isEnabled(L)) {
+            AsyncWriter& writer = AsyncWriter::instance();
+            writer.write(L, tag, args...);
+            if constexpr (L == Level::ERROR) {
+                writer.flush();
+            }
         }
     }
 
+    // Arguments are still evaluated when a level is compiled out; see CARSIM_LOG_DEBUG
+    template <typename... Args>
+    void debug(Tag tag, const Args&... args) {
+        log<Level::DEBUG>(tag, args...);
+    }
+
+    template <typename... Args>
+    void info(Tag tag, const Args&... args) {
+        log<Level::INFO>(tag, args...);
+    }
+
+    template <typename... Args>
+    void warning(Tag tag, const Args&... args) {
+        log<Level::WARNING>(tag, args...);
+    }
+
+    template <typename... Args>
+    void error(Tag tag, const Args&... args) {
+        log<Level::ERROR>(tag, args...);
+    }
+
     inline void info(std::string_view message) {
-        log(Level::INFO, message);
+        info(Tag::GENERAL, message);
     }
 
     inline void warning(std::string_view message) {
-        log(Level::WARNING, message);
+        warning(Tag::GENERAL, message);
     }
 
     inline void error(std::string_view message) {
-        log(Level::ERROR, message);
+        error(Tag::GENERAL, message);
     }
 }
 
+// Same as the Logger functions, but the arguments are only evaluated if the level is compiled
+// in; they are still type checked either way
+#define CARSIM_LOG_AT(level, function, ...)         \
+    do {                                            \
+        if constexpr (::Logger::isEnabled(level)) { \
+            function(__VA_ARGS__);                  \
+        }                                           \
+    } while (false)
+#define CARSIM_LOG_DEBUG(...) CARSIM_LOG_AT(::Logger::Level::DEBUG, ::Logger::debug, __VA_ARGS__)
+#define CARSIM_LOG_INFO(...) CARSIM_LOG_AT(::Logger::Level::INFO, ::Logger::info, __VA_ARGS__)
+#define CARSIM_LOG_WARNING(...) CARSIM_LOG_AT(::Logger::Level::WARNING, ::Logger::warning, __VA_ARGS__)
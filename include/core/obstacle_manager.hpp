@@ -3,28 +3,89 @@
 #include "core/obstacle.hpp"
 #include "core/vehicle.hpp"
 #include "core/game_object_manager.hpp"
-#include "core/random_position_generator.hpp"
+#include "core/spatial_grid.hpp"
+#include "core/box_collision.hpp"
+#include "core/contact_solver.hpp"
+#include "core/game_config.hpp"
+#include <cstdint>
 #include <vector>
 #include <memory>
 
 /**
  * Manages all obstacles in the scene.
- * Generates perimeter walls and randomly positioned trees with proper spacing.
+ * Generates perimeter walls and randomly positioned trees with proper spacing, side by side
+ * on the JobSystem; the same seed always gives the same layout.
+ * Obstacles never move, so they are indexed once in a SpatialGrid and collision checks
+ * only look at the cells around the vehicle.
+ * Collisions are swept along the vehicle's step, so no speed or step size lets it pass
+ * through an obstacle. Walls and the vehicle are tested as oriented boxes, trees as circles,
+ * and every contact of a tick is resolved together by a ContactSolver.
  */
 class ObstacleManager : public GameObjectManager {
 public:
-    ObstacleManager(float playAreaSize, int treeCount);
+    ObstacleManager(float playAreaSize, int treeCount, std::uint32_t seed = GameConfig::World::SEED);
 
     void update(float deltaTime) override;
     void handleCollisions(Vehicle& vehicle) override;
+
+    // Working memory for collision queries, kept between calls to avoid reallocating
+    struct CollisionScratch {
+        std::vector<std::uint32_t> candidates;
+        std::vector<std::uint32_t> runCandidates;  // Wall runs among the candidates, lanes of wallBatch
+        BoxCollisionBatch wallBatch;
+        std::vector<Contact> contacts;
+    };
+
+    // Same, for vehicles other than the one this manager's own solver follows, after a step of
+    // deltaTime. Safe to call from several threads at once, each with its own vehicle, solver
+    // and scratch.
+    void handleCollisions(Vehicle& vehicle, float deltaTime, ContactSolver& contactSolver, CollisionScratch& scratch) const;
     void reset() noexcept override;
 
     [[nodiscard]] const std::vector<std::unique_ptr<Obstacle>>& getObstacles() const noexcept;
     [[nodiscard]] size_t getCount() const noexcept override;
+    [[nodiscard]] const SpatialGrid& getGrid() const noexcept { return grid_; }
+
+    // Indices of the obstacles whose bounding circle touches the box, each once and ascending
+    void queryBox(float minX, float minZ, float maxX, float maxZ, std::vector<std::uint32_t>& indices) const;
+
+    // Obstacles within the contact margin of the vehicle where it is now, in index order
+    void findContacts(const Vehicle& vehicle, std::vector<Contact>& contacts);
+    // Same test for one obstacle, without the grid; false when it is out of reach. A wall
+    // segment answers for the whole straight wall it belongs to.
+    [[nodiscard]] bool findContact(const Vehicle& vehicle, std::uint32_t index, Contact& contact) const;
+
+    [[nodiscard]] const ContactSolver& getContactSolver() const noexcept { return contactSolver_; }
 
 private:
     void generateWalls(float playAreaSize);
-    void generateTrees(int count, float playAreaSize);
+    [[nodiscard]] std::vector<std::unique_ptr<Obstacle>> generateTrees(int count, float playAreaSize, std::uint32_t seed) const;
+    void buildGrid();
+    void buildWallRuns();
+
+    // Fill the scratch wall batch with the runs of the wall candidates, each once
+    void gatherWallRuns(CollisionScratch& scratch) const;
+
+    // Move the vehicle back to the first obstacle it meets along this step, if any
+    void sweep(Vehicle& vehicle, CollisionScratch& scratch) const;
+    void findContacts(const Vehicle& vehicle, std::vector<Contact>& contacts, CollisionScratch& scratch) const;
+    [[nodiscard]] Contact circleContact(const Vehicle& vehicle, std::uint32_t index) const;
 
     std::vector<std::unique_ptr<Obstacle>> obstacles_;
+    SpatialGrid grid_;
+
+    // Segments of one straight wall collide as a single box, so the seams between them can't
+    // catch a car sliding along the wall; contacts with a run use its lowest segment index
+    struct WallRun {
+        OrientedBox box;
+        std::uint32_t firstIndex;
+    };
+    std::vector<WallRun> wallRuns_;
+    std::vector<std::uint32_t> wallRunOf_;  // Run of each wall, by obstacle index
+
+    CollisionScratch scratch_;
+
+    // Remembers last tick's contacts for warm starting
+    ContactSolver contactSolver_;
+    float stepTime_ = 1.0f / GameConfig::Timing::TICK_RATE;  // Of the last update(), for speculative contacts
 };
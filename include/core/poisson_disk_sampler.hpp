@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "core/counter_rng.hpp"
+#include "core/game_config.hpp"
+
+/**
+ * Bridson's Poisson-disk sampling over the play area: random points never closer than
+ * minDistance to each other, in near-linear time thanks to a background grid.
+ * Used for tree placement, where plain rejection sampling is O(n²) and runs out of attempts.
+ *
+ * The area is split into square chunks that are sampled independently, in parallel on the
+ * JobSystem, each from its own random stream. Chunks keep minDistance / 2 clear of their
+ * shared edges, so points from neighbouring chunks are always far enough apart. The chunk
+ * layout depends only on the area, so a seed gives bit-identical points for any thread count.
+ */
+class PoissonDiskSampler {
+public:
+    static constexpr float CHUNK_SIZE = 128.0f;  // Upper bound on a chunk's side
+
+    PoissonDiskSampler(float playAreaSize, float margin, float minDistance,
+                       std::uint32_t seed = GameConfig::World::SEED);
+
+    // Keep samples at least this far from the origin (the player spawn)
+    void setExclusionRadius(float radius) noexcept { exclusionRadius_ = radius; }
+
+    // Up to count points drawn at random from a full sample set; fewer only when the area is full.
+    // threadCount caps how many jobs the chunks are split into on the JobSystem; 0 leaves it
+    // to the pool.
+    [[nodiscard]] std::vector<std::array<float, 2>> generate(std::size_t count, unsigned int threadCount = 0) const;
+
+    // Every point the area holds at this spacing, chunk by chunk
+    [[nodiscard]] std::vector<std::array<float, 2>> generateAll(unsigned int threadCount = 0) const;
+
+private:
+    struct Region {
+        float minX, minZ, maxX, maxZ;
+    };
+
+    [[nodiscard]] bool isInRegion(const Region& region, float x, float z) const noexcept;
+    [[nodiscard]] std::vector<std::array<float, 2>> sampleRegion(const Region& region, CounterRng random) const;
+
+    std::uint32_t seed_;
+    float minPos_;
+    float maxPos_;
+    float minDistance_;
+    float exclusionRadius_;
+};
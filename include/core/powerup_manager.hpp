@@ -3,16 +3,21 @@
 #include "core/powerup.hpp"
 #include "core/vehicle.hpp"
 #include "core/game_object_manager.hpp"
+#include "core/change_list.hpp"
+#include "core/game_config.hpp"
+#include <cstdint>
 #include <vector>
 #include <memory>
 
 /**
  * Manages powerup spawning and collection.
  * Handles collision detection between vehicle and powerups.
+ * Every collection and respawn is recorded in a change list, so the renderer only touches
+ * the powerups that flipped.
  */
 class PowerupManager : public GameObjectManager {
 public:
-    PowerupManager(int count, float playAreaSize);
+    PowerupManager(int count, float playAreaSize, std::uint32_t seed = GameConfig::World::SEED);
 
     // Required by base class - powerups are static objects
     void update(float deltaTime) override;
@@ -29,8 +34,14 @@ public:
     // Get all powerups (for rendering)
     [[nodiscard]] const std::vector<std::unique_ptr<Powerup>>& getPowerups() const noexcept;
 
+    // Indices of powerups whose active state changed through the manager, in order
+    using Changes = ChangeList<GameConfig::Powerup::CHANGE_LIST_SIZE>;
+    [[nodiscard]] const Changes& getChanges() const noexcept { return changes_; }
+
 private:
-    void generatePowerups(int count, float playAreaSize);
+    void generatePowerups(int count, float playAreaSize, std::uint32_t seed);
+    void setActive(std::size_t index, bool active) noexcept;
 
     std::vector<std::unique_ptr<Powerup>> powerups_;
+    Changes changes_;
 };
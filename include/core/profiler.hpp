@@ -0,0 +1,140 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Frame profiler built from scoped timing zones.
+ * Every thread writes its zones into its own fixed ring buffer, so recording a zone is two
+ * clock reads and a few stores with no locking. Each slot carries a sequence number (as in
+ * Logger::AsyncWriter), so other threads can copy a ring while its owner keeps recording and
+ * drop any slot that was overwritten under them. The main thread marks frame ends; the profiler keeps
+ * recent frame times for percentiles and the last complete frame's zones for the HUD, and can
+ * dump everything still in the rings as a Chrome trace (chrome://tracing or Perfetto).
+ *
+ * Use the CARSIM_PROFILE_* macros: without CARSIM_ENABLE_PROFILER they compile to nothing.
+ */
+class Profiler {
+public:
+    static constexpr std::size_t ZONES_PER_THREAD = 16384;
+    static constexpr std::size_t FRAME_HISTORY = 512;
+
+    struct Zone {
+        const char* name = "";  // String literal, never copied
+        std::int64_t startNanoseconds = 0;
+        std::int64_t endNanoseconds = 0;
+        std::uint32_t depth = 0;  // Nesting level within its thread
+    };
+
+    struct FrameStats {
+        std::size_t frameCount = 0;  // Frames in the history, at most FRAME_HISTORY
+        float lastMilliseconds = 0.0f;
+        float p50Milliseconds = 0.0f;
+        float p95Milliseconds = 0.0f;
+        float p99Milliseconds = 0.0f;
+    };
+
+    // Times a scope on the calling thread
+    class ScopedZone {
+    public:
+        explicit ScopedZone(const char* name) noexcept : ScopedZone(Profiler::instance(), name) {}
+        ScopedZone(Profiler& profiler, const char* name) noexcept;
+        ~ScopedZone();
+
+        ScopedZone(const ScopedZone&) = delete;
+        ScopedZone& operator=(const ScopedZone&) = delete;
+
+    private:
+        Profiler& profiler_;
+        const char* name_;
+        std::int64_t start_;
+    };
+
+    Profiler();
+    ~Profiler();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    // Process-wide profiler used by the macros
+    [[nodiscard]] static Profiler& instance();
+    [[nodiscard]] static std::int64_t nowNanoseconds() noexcept;
+
+    // Label for the calling thread in traces
+    void setThreadName(const std::string& name);
+
+    // A finished zone on the calling thread, nested at the current ScopedZone depth
+    void recordZone(const char* name, std::int64_t startNanoseconds, std::int64_t endNanoseconds) noexcept;
+
+    // Frame boundary; call from the thread that owns the frame (the main loop)
+    void endFrame() { endFrame(nowNanoseconds()); }
+    void endFrame(std::int64_t nowNanoseconds);
+
+    // Main-thread views of the frame history
+    [[nodiscard]] FrameStats getFrameStats() const;
+    [[nodiscard]] std::vector<float> getFrameTimes() const;  // Milliseconds, oldest first
+    [[nodiscard]] const std::vector<Zone>& getLastFrameZones() const noexcept { return lastFrameZones_; }
+    [[nodiscard]] std::int64_t getLastFrameStart() const noexcept { return lastFrameStart_; }
+    [[nodiscard]] std::int64_t getLastFrameEnd() const noexcept { return lastFrameEnd_; }
+
+    // Trace-event JSON of every zone still held by any thread's ring
+    [[nodiscard]] std::string toChromeTrace() const;
+    bool writeChromeTrace(const std::string& path) const;
+
+private:
+    // One ring entry; fields are atomic so a reader copying it never races the owner
+    struct Slot {
+        std::atomic<std::uint64_t> sequence{0};  // Zone index + 1 once written, 0 while writing
+        std::atomic<const char*> name{""};
+        std::atomic<std::int64_t> startNanoseconds{0};
+        std::atomic<std::int64_t> endNanoseconds{0};
+        std::atomic<std::uint32_t> depth{0};
+    };
+
+    struct ThreadBuffer {
+        std::thread::id threadId;
+        std::uint32_t traceId = 0;
+        std::string name;
+        std::unique_ptr<Slot[]> slots = std::make_unique<Slot[]>(ZONES_PER_THREAD);
+        std::atomic<std::uint64_t> written{0};
+        std::uint32_t depth = 0;  // Open ScopedZones, touched only by the owning thread
+    };
+
+    [[nodiscard]] ThreadBuffer& threadBuffer();
+
+    // Copy of the zones currently in a ring, oldest first; safe from any thread
+    [[nodiscard]] static std::vector<Zone> readZones(const ThreadBuffer& buffer);
+    // Zone number index from its slot, false if the owner has overwritten or is rewriting it
+    [[nodiscard]] static bool readZone(const ThreadBuffer& buffer, std::uint64_t index, Zone& zone) noexcept;
+
+    const std::uint64_t id_;  // Distinguishes profilers in the thread-local buffer cache
+
+    mutable std::mutex threadsMutex_;
+    std::vector<std::unique_ptr<ThreadBuffer>> threads_;
+
+    // Frame history, owned by the thread calling endFrame
+    std::vector<float> frameTimes_;
+    std::size_t frameCount_ = 0;
+    std::int64_t frameStart_ = 0;
+    std::vector<Zone> lastFrameZones_;
+    std::int64_t lastFrameStart_ = 0;
+    std::int64_t lastFrameEnd_ = 0;
+};
+
+#ifdef CARSIM_ENABLE_PROFILER
+#define CARSIM_PROFILE_CONCAT_INNER(a, b) a##b
+#define CARSIM_PROFILE_CONCAT(a, b) CARSIM_PROFILE_CONCAT_INNER(a, b)
+#define CARSIM_PROFILE_ZONE(name) const Profiler::ScopedZone CARSIM_PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define CARSIM_PROFILE_FRAME() Profiler::instance().endFrame()
+#define CARSIM_PROFILE_THREAD(name) Profiler::instance().setThreadName(name)
+#else
+#define CARSIM_PROFILE_ZONE(name) ((void)0)
+#define CARSIM_PROFILE_FRAME() ((void)0)
+#define CARSIM_PROFILE_THREAD(name) ((void)0)
+#endif
@@ -2,8 +2,8 @@
 
 #include <array>
 #include <vector>
-#include <random>
 #include <cmath>
+#include "core/counter_rng.hpp"
 
 /**
  * Generates random positions with spacing constraints.
@@ -11,15 +11,15 @@
  */
 class RandomPositionGenerator {
 public:
-    RandomPositionGenerator(float playAreaSize, float margin)
-        : randomEngine_(std::random_device{}()),
+    RandomPositionGenerator(float playAreaSize, float margin, CounterRng random)
+        : random_(random),
           minPos_(-(playAreaSize / 2.0f) + margin),
-          maxPos_((playAreaSize / 2.0f) - margin),
-          distribution_(minPos_, maxPos_) {
+          maxPos_((playAreaSize / 2.0f) - margin) {
     }
 
     std::array<float, 2> getRandomPosition() {
-        return {distribution_(randomEngine_), distribution_(randomEngine_)};
+        const float x = random_.uniform(minPos_, maxPos_);
+        return {x, random_.uniform(minPos_, maxPos_)};
     }
 
     // Keep minimum distance from existing positions
@@ -85,8 +85,7 @@ private:
         return true;
     }
 
-    std::mt19937 randomEngine_;
+    CounterRng random_;
     float minPos_;
     float maxPos_;
-    std::uniform_real_distribution<float> distribution_;
 };
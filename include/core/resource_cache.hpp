@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+struct ResourceCacheStats {
+    std::size_t requests = 0;
+    std::size_t hits = 0;
+    std::size_t bytesSaved = 0;  // Size of the copies that hits did not have to create
+
+    [[nodiscard]] double getHitRate() const noexcept {
+        return requests == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(requests);
+    }
+};
+
+// Mix another hash into seed (boost::hash_combine)
+inline void hashCombine(std::size_t& seed, std::size_t value) noexcept {
+    seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+/**
+ * Hands out one shared instance per key instead of identical copies.
+ * The cache only keeps weak references: a resource lives as long as someone uses it,
+ * and the next request after that creates a fresh one.
+ */
+template <typename Key, typename Resource, typename Hash = std::hash<Key>>
+class ResourceCache {
+public:
+    using SizeFunction = std::function<std::size_t(const Resource&)>;
+
+    explicit ResourceCache(SizeFunction sizeOf = {})
+        : sizeOf_(std::move(sizeOf)) {
+    }
+
+    // Return the live resource for key, or store and return create()
+    template <typename Factory>
+    std::shared_ptr<Resource> acquire(const Key& key, Factory&& create) {
+        ++stats_.requests;
+
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            if (auto existing = it->second.resource.lock()) {
+                ++stats_.hits;
+                stats_.bytesSaved += it->second.bytes;
+                return existing;
+            }
+        }
+
+        std::shared_ptr<Resource> created = std::forward<Factory>(create)();
+        const std::size_t bytes = (sizeOf_ && created) ? sizeOf_(*created) : 0;
+        entries_.insert_or_assign(key, Entry{created, bytes});
+        return created;
+    }
+
+    // Drop entries whose resource is no longer used, returns how many were removed
+    std::size_t pruneExpired() {
+        std::size_t removed = 0;
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (it->second.resource.expired()) {
+                it = entries_.erase(it);
+                ++removed;
+            } else {
+                ++it;
+            }
+        }
+        return removed;
+    }
+
+    [[nodiscard]] std::size_t getLiveCount() const noexcept {
+        std::size_t live = 0;
+        for (const auto& [key, entry] : entries_) {
+            live += entry.resource.expired() ? 0 : 1;
+        }
+        return live;
+    }
+
+    [[nodiscard]] const ResourceCacheStats& getStats() const noexcept { return stats_; }
+
+private:
+    struct Entry {
+        std::weak_ptr<Resource> resource;
+        std::size_t bytes;
+    };
+
+    SizeFunction sizeOf_;
+    std::unordered_map<Key, Entry, Hash> entries_;
+    ResourceCacheStats stats_;
+};
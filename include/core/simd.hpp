@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * SIMD instruction sets the batched kernels can run on.
+ * Kernels are compiled per instruction set and picked at runtime,
+ * so one binary runs on any x86-64 machine (and on ARM via the scalar path).
+ */
+enum class SimdLevel {
+    SCALAR,
+    AVX2,
+    AVX512
+};
+
+// Best level that is both compiled in and supported by this CPU
+[[nodiscard]] SimdLevel detectSimdLevel() noexcept;
+
+// Clamp a requested level to what this machine can actually run
+[[nodiscard]] SimdLevel clampSimdLevel(SimdLevel requested) noexcept;
+
+[[nodiscard]] std::size_t simdLaneCount(SimdLevel level) noexcept;
+[[nodiscard]] const char* simdLevelName(SimdLevel level) noexcept;
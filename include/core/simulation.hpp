@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include "core/vehicle.hpp"
+#include "core/obstacle_manager.hpp"
+#include "core/powerup_manager.hpp"
+#include "core/vehicle_manager.hpp"
+#include "core/control_state.hpp"
+#include "core/game_config.hpp"
+
+/**
+ * Render-less world simulation.
+ * Owns the vehicle, obstacles, powerups and any other traffic and advances them one step at
+ * a time.
+ * Has no threepp, audio or GL dependency so it can run on headless servers.
+ * The world seed fixes the obstacle and powerup layout; with the same seed and the same
+ * controls at the same fixed steps, a run is reproduced exactly.
+ */
+class Simulation {
+public:
+    Simulation(float playAreaSize = GameConfig::World::PLAY_AREA_SIZE,
+               int treeCount = GameConfig::Obstacle::DEFAULT_TREE_COUNT,
+               int powerupCount = GameConfig::Powerup::DEFAULT_COUNT,
+               std::uint32_t seed = GameConfig::World::SEED,
+               int trafficCount = GameConfig::Traffic::DEFAULT_COUNT);
+
+    // Apply controls for this step, then advance the world
+    void step(const ControlState& controls, float deltaTime);
+
+    // Advance the world with whatever input was already applied to the vehicle
+    void step(float deltaTime);
+
+    // Respawn the vehicle and all powerups and forget the vehicle's obstacle contacts. Traffic
+    // carries on: a reset is the player's respawn, not a restart of the world
+    void reset() noexcept;
+
+    [[nodiscard]] Vehicle& getVehicle() noexcept { return vehicle_; }
+    [[nodiscard]] const Vehicle& getVehicle() const noexcept { return vehicle_; }
+    [[nodiscard]] const ObstacleManager& getObstacleManager() const noexcept { return obstacleManager_; }
+    [[nodiscard]] const PowerupManager& getPowerupManager() const noexcept { return powerupManager_; }
+    // Other cars, spawned from the world seed; they sit still unless given controls
+    [[nodiscard]] VehicleManager& getTraffic() noexcept { return traffic_; }
+    [[nodiscard]] const VehicleManager& getTraffic() const noexcept { return traffic_; }
+
+    [[nodiscard]] std::uint32_t getSeed() const noexcept { return seed_; }
+    [[nodiscard]] std::uint64_t getTickCount() const noexcept { return tickCount_; }
+    [[nodiscard]] std::uint32_t getResetCount() const noexcept { return resetCount_; }
+
+private:
+    void generateTraffic(int count, float playAreaSize);
+
+    std::uint32_t seed_;
+    Vehicle vehicle_;
+    ObstacleManager obstacleManager_;
+    PowerupManager powerupManager_;
+    VehicleManager traffic_;
+
+    ControlState previousControls_;
+    std::uint64_t tickCount_;
+    std::uint32_t resetCount_;
+};
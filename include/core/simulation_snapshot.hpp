@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "core/change_list.hpp"
+#include "core/transform_state.hpp"
+#include "core/interfaces/IVehicleState.hpp"
+#include "core/game_config.hpp"
+
+class Simulation;
+
+/**
+ * Plain copy of everything the renderer, audio and UI need from the vehicle.
+ */
+struct VehicleSnapshot {
+    TransformState previous;   // Start of the last step
+    TransformState current;    // End of the last step
+    float velocity = 0.0f;
+    float steeringInput = 0.0f;
+    float driftAngle = 0.0f;
+    float nitrousTimeRemaining = 0.0f;
+    float rpm = 0.0f;
+    float scale = 1.0f;
+    int gear = 1;
+    bool drifting = false;
+    bool hasNitrous = false;
+    bool nitrousActive = false;
+};
+
+/**
+ * One published simulation state, handed from the simulation thread to the render thread.
+ * Fixed size and trivially copyable so it can live in a TripleBuffer.
+ */
+struct SimulationSnapshot {
+    std::uint64_t tick = 0;
+    std::int64_t tickTimeNanoseconds = 0;  // steady_clock time the last step finished
+    float stepSize = 0.0f;
+    std::uint32_t resetCount = 0;          // Bumped on every respawn so the render side can react
+
+    VehicleSnapshot vehicle;
+
+    // Active flags in PowerupManager order, only the first powerupCount entries are valid
+    std::uint32_t powerupCount = 0;
+    std::array<std::uint8_t, GameConfig::Powerup::MAX_COUNT> powerupActive{};
+    // Which of those flags changed; renderers replay this instead of scanning every flag
+    ChangeList<GameConfig::Powerup::CHANGE_LIST_SIZE> powerupChanges;
+};
+
+// Copy the current simulation state into a snapshot
+void captureSnapshot(const Simulation& simulation, SimulationSnapshot& snapshot) noexcept;
+
+/**
+ * IVehicleState over a VehicleSnapshot, so renderers, audio and UI keep their interfaces.
+ */
+class VehicleStateView : public IVehicleState {
+public:
+    VehicleStateView() = default;
+    explicit VehicleStateView(const VehicleSnapshot& snapshot) : snapshot_(&snapshot) {}
+
+    void bind(const VehicleSnapshot& snapshot) noexcept { snapshot_ = &snapshot; }
+
+    [[nodiscard]] float getScale() const noexcept override { return snapshot_->scale; }
+    [[nodiscard]] float getVelocity() const noexcept override { return snapshot_->velocity; }
+    [[nodiscard]] float getSteeringInput() const noexcept override { return snapshot_->steeringInput; }
+    [[nodiscard]] bool isDrifting() const noexcept override { return snapshot_->drifting; }
+    [[nodiscard]] float getDriftAngle() const noexcept override { return snapshot_->driftAngle; }
+    [[nodiscard]] bool hasNitrous() const noexcept override { return snapshot_->hasNitrous; }
+    [[nodiscard]] bool isNitrousActive() const noexcept override { return snapshot_->nitrousActive; }
+    [[nodiscard]] float getNitrousTimeRemaining() const noexcept override { return snapshot_->nitrousTimeRemaining; }
+    [[nodiscard]] int getCurrentGear() const noexcept override { return snapshot_->gear; }
+    [[nodiscard]] float getRPM() const noexcept override { return snapshot_->rpm; }
+
+private:
+    static inline const VehicleSnapshot EMPTY_SNAPSHOT{};
+    const VehicleSnapshot* snapshot_ = &EMPTY_SNAPSHOT;
+};
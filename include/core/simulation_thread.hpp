@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include "core/simulation.hpp"
+#include "core/simulation_snapshot.hpp"
+#include "core/triple_buffer.hpp"
+#include "core/fixed_timestep.hpp"
+
+class InputRecording;
+
+/**
+ * Runs a Simulation at a fixed tick rate on its own thread.
+ * Input comes in through submitControls(), state goes out through a triple-buffered
+ * snapshot, so a slow render frame never delays a physics tick and vice versa.
+ * While running, the Simulation must only be touched by this thread.
+ */
+class SimulationThread {
+public:
+    explicit SimulationThread(Simulation& simulation, float tickRate = GameConfig::Timing::TICK_RATE);
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    void start();
+    void stop() noexcept;
+    [[nodiscard]] bool isRunning() const noexcept { return running_.load(std::memory_order_acquire); }
+
+    // Record the controls of every tick (the recording must outlive the thread); call before start()
+    void setRecording(InputRecording* recording) noexcept { recording_ = recording; }
+
+    // Called from the input/render thread. Drift, nitrous and reset presses are kept
+    // until a tick has seen them, even if they are released before the next tick.
+    void submitControls(const ControlState& controls) noexcept;
+
+    // Render thread: pick up the newest snapshot (returns false if nothing new) and read it
+    bool updateSnapshot() noexcept { return snapshots_.update(); }
+    [[nodiscard]] const SimulationSnapshot& getSnapshot() const noexcept { return snapshots_.read(); }
+
+    // Blend factor between the snapshot's previous and current vehicle transform at time now
+    [[nodiscard]] float getInterpolationAlpha(std::int64_t nowNanoseconds) const noexcept;
+
+    [[nodiscard]] float getStepSize() const noexcept { return stepSize_; }
+
+    // Snapshots the render thread never picked up because a newer one replaced them
+    [[nodiscard]] std::uint64_t getSkippedSnapshots() const noexcept { return skippedSnapshots_.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] static std::int64_t nowNanoseconds() noexcept;
+
+private:
+    void run();
+    void publish();
+    [[nodiscard]] ControlState takeControls() noexcept;
+
+    Simulation& simulation_;
+    FixedTimestep timestep_;
+    const float stepSize_;
+
+    TripleBuffer<SimulationSnapshot> snapshots_;
+
+    // ControlState packed into bits: held keys, and presses not yet seen by a tick
+    std::atomic<std::uint32_t> heldControls_;
+    std::atomic<std::uint32_t> pendingPresses_;
+
+    InputRecording* recording_;
+
+    std::atomic<bool> running_;
+    std::atomic<std::uint64_t> skippedSnapshots_;
+    std::thread thread_;
+};
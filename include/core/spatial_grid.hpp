@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "core/game_config.hpp"
+
+/**
+ * Static uniform grid over circles on the ground plane, built once and queried many times.
+ * Cells are stored back to back (counting sort), and each entry carries its own centre and
+ * radius so the broadphase walks contiguous memory instead of chasing object pointers.
+ * A circle that straddles cells is listed in each of them, so a query may visit it more than once.
+ */
+class SpatialGrid {
+public:
+    struct Entry {
+        float x;
+        float z;
+        float radius;
+        std::uint32_t index;  // Caller's id, e.g. position in the obstacle list
+    };
+
+    explicit SpatialGrid(float cellSize = GameConfig::Obstacle::GRID_CELL_SIZE);
+
+    // Replace the contents; bounds are taken from the entries
+    void build(const std::vector<Entry>& entries);
+    void clear() noexcept;
+
+    // Call visit(const Entry&) for every entry in the cells touched by the box
+    template <typename Visitor>
+    void forEachCandidate(float minX, float minZ, float maxX, float maxZ, Visitor&& visit) const {
+        if (cellStart_.empty() || maxX < originX_ || maxZ < originZ_ || minX > limitX_ || minZ > limitZ_) {
+            return;
+        }
+        const int firstColumn = cellCoordinate(minX - originX_, columns_);
+        const int lastColumn = cellCoordinate(maxX - originX_, columns_);
+        const int firstRow = cellCoordinate(minZ - originZ_, rows_);
+        const int lastRow = cellCoordinate(maxZ - originZ_, rows_);
+
+        for (int row = firstRow; row <= lastRow; ++row) {
+            const std::size_t rowOffset = static_cast<std::size_t>(row) * static_cast<std::size_t>(columns_);
+            // A row of cells is one contiguous run of entries
+            const std::uint32_t begin = cellStart_[rowOffset + firstColumn];
+            const std::uint32_t end = cellStart_[rowOffset + lastColumn + 1];
+            for (std::uint32_t i = begin; i < end; ++i) {
+                visit(entries_[i]);
+            }
+        }
+    }
+
+    // Same, for the cells touched by a circle
+    template <typename Visitor>
+    void forEachCandidate(float x, float z, float radius, Visitor&& visit) const {
+        forEachCandidate(x - radius, z - radius, x + radius, z + radius, std::forward<Visitor>(visit));
+    }
+
+    // Effective cell edge; larger than requested when the map would need too many cells
+    [[nodiscard]] float getCellSize() const noexcept { return 1.0f / inverseCellSize_; }
+    [[nodiscard]] int getColumns() const noexcept { return columns_; }
+    [[nodiscard]] int getRows() const noexcept { return rows_; }
+    [[nodiscard]] std::size_t getEntryCount() const noexcept { return entries_.size(); }
+
+private:
+    // Clamped cell index along one axis; offsets past the far edge map to the last cell
+    [[nodiscard]] int cellCoordinate(float offset, int cellCount) const noexcept {
+        if (offset <= 0.0f) {
+            return 0;
+        }
+        const float cell = offset * inverseCellSize_;
+        return cell >= static_cast<float>(cellCount - 1) ? cellCount - 1 : static_cast<int>(cell);
+    }
+
+    float cellSize_;  // Requested cell edge
+    float inverseCellSize_;
+    float originX_;
+    float originZ_;
+    float limitX_;
+    float limitZ_;
+    int columns_;
+    int rows_;
+
+    std::vector<std::uint32_t> cellStart_;  // columns * rows + 1 offsets into entries_
+    std::vector<Entry> entries_;
+};
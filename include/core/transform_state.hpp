@@ -0,0 +1,28 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include "core/vehicle_tuning.hpp"
+
+/**
+ * Position and heading of an object at one simulation step.
+ * Renderers blend the last two of these so motion stays smooth between fixed steps.
+ */
+struct TransformState {
+    std::array<float, 3> position = {0.0f, 0.0f, 0.0f};
+    float rotation = 0.0f;
+
+    [[nodiscard]] bool operator==(const TransformState& other) const noexcept = default;
+};
+
+// Blend from previous (alpha 0) to current (alpha 1), turning the short way round
+[[nodiscard]] inline TransformState interpolateTransform(const TransformState& previous, const TransformState& current, float alpha) noexcept {
+    TransformState result;
+    for (std::size_t i = 0; i < 3; ++i) {
+        result.position[i] = previous.position[i] + (current.position[i] - previous.position[i]) * alpha;
+    }
+
+    float rotationDelta = std::remainder(current.rotation - previous.rotation, VehicleTuning::TWO_PI);
+    result.rotation = previous.rotation + rotationDelta * alpha;
+    return result;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * Lock-free single-producer/single-consumer triple buffer.
+ * The writer always has a private buffer to fill and never waits for the reader; the reader
+ * always gets the newest complete value and never sees a half-written one.
+ * Buffers are recycled, so the writer must fill every field it cares about before publish().
+ */
+template <typename T>
+class TripleBuffer {
+    static_assert(std::is_trivially_copyable_v<T>, "TripleBuffer is meant for plain snapshot structs");
+
+public:
+    TripleBuffer() = default;
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // Writer side: fill this, then publish()
+    [[nodiscard]] T& writeBuffer() noexcept { return buffers_[writeIndex_]; }
+
+    // Hand the write buffer to the reader. Returns false if the previous one was never picked up.
+    bool publish() noexcept {
+        const std::uint8_t previous = shared_.exchange(static_cast<std::uint8_t>(writeIndex_ | FRESH_BIT), std::memory_order_acq_rel);
+        writeIndex_ = previous & INDEX_MASK;
+        return (previous & FRESH_BIT) == 0;
+    }
+
+    // Reader side: swap in the newest published value. Returns true if there was one.
+    bool update() noexcept {
+        if ((shared_.load(std::memory_order_relaxed) & FRESH_BIT) == 0) {
+            return false;
+        }
+        const std::uint8_t previous = shared_.exchange(readIndex_, std::memory_order_acq_rel);
+        readIndex_ = previous & INDEX_MASK;
+        return true;
+    }
+
+    // Value from the last update(); default-constructed until the first publish
+    [[nodiscard]] const T& read() const noexcept { return buffers_[readIndex_]; }
+
+private:
+    static constexpr std::uint8_t INDEX_MASK = 0x3;
+    static constexpr std::uint8_t FRESH_BIT = 0x4;
+
+    std::array<T, 3> buffers_{};
+
+    // Index of the buffer in the middle, plus whether it holds an unread value.
+    // Writer and reader indices sit on their own cache lines so the two threads don't fight over them.
+    alignas(64) std::atomic<std::uint8_t> shared_{1};
+    alignas(64) std::uint8_t writeIndex_ = 0;
+    alignas(64) std::uint8_t readIndex_ = 2;
+};
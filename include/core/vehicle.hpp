@@ -40,6 +40,8 @@ public:
     [[nodiscard]] float getVelocity() const noexcept override;
     [[nodiscard]] static constexpr float getMaxSpeed() noexcept { return VehicleTuning::MAX_SPEED; }
     [[nodiscard]] float getDriftAngle() const noexcept override;
+    // Direction the car travels in: its heading, turned by the drift angle while drifting
+    [[nodiscard]] float getMovementAngle() const noexcept;
     [[nodiscard]] int getCurrentGear() const noexcept override;
     [[nodiscard]] float getRPM() const noexcept override;
     [[nodiscard]] float getSteeringInput() const noexcept override;
@@ -72,7 +74,7 @@ private:
     void updateRPM() noexcept;
     void updateDrift(float deltaTime) noexcept;
     void updatePosition(float deltaTime) noexcept;
-    void decayAcceleration() noexcept;
+    void decayAcceleration(float deltaTime) noexcept;
 
     float velocity_;
     float acceleration_;
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "core/control_state.hpp"
+#include "core/simd.hpp"
+
+/**
+ * Many vehicles stored as structure-of-arrays and stepped together.
+ * Runs the same physics as Vehicle driven through applyControls(), 8 lanes at a time
+ * with AVX2 or 16 with AVX-512, for large fleets (AI training, load tests).
+ *
+ * Accuracy: the scalar level is bit-identical to Vehicle. The vector levels replace
+ * std::log/sin/cos with polynomial approximations (about 2 ulp), so after 10 simulated
+ * seconds positions stay within VEHICLE_BATCH_POSITION_TOLERANCE metres of Vehicle.
+ * Lanes are independent: no collisions, obstacles or powerup pickups happen here.
+ */
+class VehicleBatch {
+public:
+    explicit VehicleBatch(SimdLevel level = detectSimdLevel());
+
+    // Spawn a vehicle like Vehicle(x, y, z) and return its index
+    std::size_t add(float x, float y, float z);
+    void reserve(std::size_t count);
+    [[nodiscard]] std::size_t size() const noexcept { return velocity_.size(); }
+
+    // Controls used by the next step(); reset is ignored, call reset(index) instead
+    void setControls(std::size_t index, const ControlState& controls) noexcept;
+    void setAccelerationMultiplier(std::size_t index, float multiplier) noexcept;
+    void pickupNitrous(std::size_t index) noexcept;
+
+    void reset(std::size_t index) noexcept;
+    void resetAll() noexcept;
+
+    void step(float deltaTime) noexcept;
+
+    // Requests above what the CPU supports fall back to the best available level
+    void setSimdLevel(SimdLevel level) noexcept;
+    [[nodiscard]] SimdLevel getSimdLevel() const noexcept { return simdLevel_; }
+
+    // Per-vehicle state, same meaning as the Vehicle getters
+    [[nodiscard]] std::array<float, 3> getPosition(std::size_t index) const noexcept;
+    [[nodiscard]] float getRotation(std::size_t index) const noexcept { return rotation_[index]; }
+    [[nodiscard]] float getVelocity(std::size_t index) const noexcept { return velocity_[index]; }
+    [[nodiscard]] float getSteeringInput(std::size_t index) const noexcept { return steeringInput_[index]; }
+    [[nodiscard]] float getDriftAngle(std::size_t index) const noexcept { return driftAngle_[index]; }
+    [[nodiscard]] bool isDrifting(std::size_t index) const noexcept { return drifting_[index] != 0; }
+    [[nodiscard]] bool hasNitrous(std::size_t index) const noexcept { return hasNitrous_[index] != 0; }
+    [[nodiscard]] bool isNitrousActive(std::size_t index) const noexcept { return nitrousActive_[index] != 0; }
+    [[nodiscard]] float getNitrousTimeRemaining(std::size_t index) const noexcept { return nitrousTimeRemaining_[index]; }
+    [[nodiscard]] int getCurrentGear(std::size_t index) const noexcept { return gear_[index]; }
+    [[nodiscard]] float getRPM(std::size_t index) const noexcept { return rpm_[index]; }
+    [[nodiscard]] float getAccelerationMultiplier(std::size_t index) const noexcept { return accelMultiplier_[index]; }
+
+    // Contiguous views for bulk readers (observation vectors, rendering)
+    [[nodiscard]] const std::vector<float>& getPositionsX() const noexcept { return positionX_; }
+    [[nodiscard]] const std::vector<float>& getPositionsZ() const noexcept { return positionZ_; }
+    [[nodiscard]] const std::vector<float>& getRotations() const noexcept { return rotation_; }
+    [[nodiscard]] const std::vector<float>& getVelocities() const noexcept { return velocity_; }
+
+private:
+    SimdLevel simdLevel_;
+
+    // Spawn transform
+    std::vector<float> initialX_;
+    std::vector<float> initialZ_;
+
+    // Simulation state
+    std::vector<float> positionX_;
+    std::vector<float> positionY_;
+    std::vector<float> positionZ_;
+    std::vector<float> rotation_;
+    std::vector<float> velocity_;
+    std::vector<float> steeringInput_;
+    std::vector<float> driftAngle_;
+    std::vector<float> nitrousTimeRemaining_;
+    std::vector<float> rpm_;
+    std::vector<std::int32_t> gear_;
+    std::vector<std::uint8_t> drifting_;
+    std::vector<std::uint8_t> hasNitrous_;
+    std::vector<std::uint8_t> nitrousActive_;
+    std::vector<float> accelMultiplier_;
+
+    // Controls
+    std::vector<float> throttle_;
+    std::vector<std::uint8_t> turnLeft_;
+    std::vector<std::uint8_t> turnRight_;
+    std::vector<std::uint8_t> driftHeld_;
+    std::vector<std::uint8_t> nitrousHeld_;
+    std::vector<std::uint8_t> driftHeldPrevious_;
+    std::vector<std::uint8_t> nitrousHeldPrevious_;
+};
+
+// Documented vector-path accuracy over 600 steps at 60 Hz, checked by the tests
+inline constexpr float VEHICLE_BATCH_POSITION_TOLERANCE = 0.01f;
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "core/contact_solver.hpp"
+#include "core/control_state.hpp"
+#include "core/game_object_manager.hpp"
+#include "core/job_system.hpp"
+#include "core/obstacle_manager.hpp"
+#include "core/vehicle.hpp"
+
+/**
+ * Hosts any number of vehicles driven through applyControls() and collides them with each
+ * other. The broadphase is sweep and prune along x: every vehicle's bounding-circle interval
+ * is kept in one sorted endpoint list, re-sorted each tick by insertion sort. Cars move little
+ * between ticks, so the list is nearly sorted and the sort costs close to one pass; a sweep
+ * over it then yields the pairs whose intervals overlap on both axes. Those go through
+ * checkCircleCollision and are pushed apart with an equal-mass impulse.
+ * Vehicle updates and obstacle collisions are independent per vehicle and run in parallel
+ * chunks on a JobSystem; the results don't depend on the thread count.
+ */
+class VehicleManager : public GameObjectManager {
+public:
+    using Pair = std::pair<std::uint32_t, std::uint32_t>;
+
+    explicit VehicleManager(JobSystem& jobs = JobSystem::instance());
+
+    // Spawn a vehicle like Vehicle(x, y, z) and return its index
+    std::size_t add(float x, float y, float z);
+    void reserve(std::size_t count);
+
+    // Controls used by the following update(); reset is ignored, the caller owns respawns
+    void setControls(std::size_t index, const ControlState& controls) noexcept;
+
+    // Apply each vehicle's controls and advance it
+    void update(float deltaTime) override;
+
+    // Every vehicle against the static world after a step of deltaTime, each warm starting
+    // from its own contacts
+    void handleObstacleCollisions(const ObstacleManager& obstacles, float deltaTime);
+
+    // Push apart every pair of managed vehicles that overlaps
+    void resolveCollisions();
+
+    // One vehicle not managed here (the player) against all managed ones
+    void handleCollisions(Vehicle& vehicle) override;
+
+    // Respawn every vehicle and release all controls
+    void reset() noexcept override;
+
+    [[nodiscard]] size_t getCount() const noexcept override { return vehicles_.size(); }
+    [[nodiscard]] const std::vector<std::unique_ptr<Vehicle>>& getVehicles() const noexcept { return vehicles_; }
+    [[nodiscard]] Vehicle& getVehicle(std::size_t index) noexcept { return *vehicles_[index]; }
+    [[nodiscard]] const Vehicle& getVehicle(std::size_t index) const noexcept { return *vehicles_[index]; }
+
+    // Broadphase pairs of the last resolveCollisions(), lower index first, in sweep order
+    [[nodiscard]] const std::vector<Pair>& getPairs() const noexcept { return pairs_; }
+    // Endpoint swaps the last re-sort needed; stays small while the scene is coherent
+    [[nodiscard]] std::size_t getSwapCount() const noexcept { return swapCount_; }
+
+private:
+    // Interval end on the x axis; the vehicle index is packed with a max flag in the low bit
+    struct Endpoint {
+        float value;
+        std::uint32_t key;
+
+        [[nodiscard]] std::uint32_t vehicle() const noexcept { return key >> 1; }
+        [[nodiscard]] bool isMax() const noexcept { return (key & 1u) != 0; }
+    };
+
+    // Refresh every interval from the current positions and restore the order
+    void updateBroadphase();
+    void findPairs();
+
+    JobSystem& jobs_;
+
+    std::vector<std::unique_ptr<Vehicle>> vehicles_;
+    std::vector<ControlState> controls_;
+    std::vector<ControlState> previousControls_;
+    std::vector<ContactSolver> contactSolvers_;
+
+    // Sweep and prune state; the z interval is only checked for pairs that overlap on x
+    std::vector<Endpoint> endpoints_;
+    std::vector<float> minZ_;
+    std::vector<float> maxZ_;
+    float maxSpan_ = 0.0f;  // Widest x interval, bounds how far back a query has to look
+    std::size_t swapCount_ = 0;
+
+    // Scratch kept between ticks to avoid reallocating
+    std::vector<std::uint32_t> active_;
+    std::vector<Pair> pairs_;
+    std::vector<ObstacleManager::CollisionScratch> obstacleScratch_;  // One per chunk of handleObstacleCollisions()
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cmath>
 #include <numbers>
 #include "object_sizes.hpp"
 
@@ -23,6 +24,9 @@ inline constexpr float FRICTION_COEFFICIENT = 0.9982f;
 inline constexpr float DRIFT_FRICTION_COEFFICIENT = 0.992f;
 inline constexpr float MIN_SPEED_THRESHOLD = 0.1f;
 
+// FRICTION_*, DRIFT_DECAY_RATE and STEERING_DECAY_RATE are per-step factors tuned at this rate
+inline constexpr float REFERENCE_FRAME_RATE = 60.0f;
+
 // Steering
 inline constexpr float STEERING_DECAY_RATE = 0.85f;
 inline constexpr float STEERING_ZERO_THRESHOLD = 0.01f;
@@ -89,6 +93,11 @@ inline constexpr float GEAR_ACCELERATION_MULTIPLIERS[NUM_GEARS] = {
     1.5f, 1.2f, 1.0f, 0.8f
 };
 
+// Scale a per-reference-frame decay factor to an arbitrary time step
+[[nodiscard]] inline float decayFactor(float ratePerFrame, float deltaTime) noexcept {
+    return std::pow(ratePerFrame, deltaTime * REFERENCE_FRAME_RATE);
+}
+
 static_assert(sizeof(GEAR_SPEEDS) / sizeof(GEAR_SPEEDS[0]) == NUM_GEARS + 1);
 static_assert(sizeof(GEAR_ACCELERATION_MULTIPLIERS) / sizeof(GEAR_ACCELERATION_MULTIPLIERS[0]) == NUM_GEARS);
 
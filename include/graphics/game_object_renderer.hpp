@@ -1,29 +1,52 @@
 #pragma once
 
 #include <threepp/threepp.hpp>
+#include <cstdint>
 #include <memory>
 #include "core/game_object.hpp"
+#include "graphics/render_resource_cache.hpp"
 
 /**
  * Base renderer for game objects.
  * Synchronizes 3D visual representation with logical game object state.
+ *
+ * Objects that never move can be made static: their matrices are then computed once per
+ * update() call instead of by threepp on every render traversal.
  */
 class GameObjectRenderer {
 public:
-    GameObjectRenderer(threepp::Scene& scene, const GameObject& gameObject);
+    GameObjectRenderer(threepp::Scene& scene, RenderResourceCache& resources, const GameObject& gameObject);
     virtual ~GameObjectRenderer();
 
-    // Update visual representation to match game object state
+    // Update visual representation to match game object state; a no-op while the object's
+    // version is unchanged
     virtual void update();
 
     void setVisible(bool visible);
 
+    // Static objects only recompute their matrices when update() is called
+    void setStatic(bool isStatic);
+    [[nodiscard]] bool isStatic() const noexcept { return isStatic_; }
+
+    // Compute the matrices under root now and stop automatic updates for the whole subtree;
+    // call again after moving anything in it. Returns the number of nodes frozen.
+    static std::size_t freezeTransforms(threepp::Object3D& root);
+    // Back to automatic per-frame updates
+    static void thawTransforms(threepp::Object3D& root);
+
 protected:
     // Override to create custom 3D models
     virtual void createModel();
 
+    // Place the object group at a given transform
+    void syncTransform(const TransformState& transform);
+
     threepp::Scene& scene_;
+    RenderResourceCache& resources_;
     const GameObject& gameObject_;
     std::shared_ptr<threepp::Group> objectGroup_;
     std::shared_ptr<threepp::Mesh> bodyMesh_;
+    bool isStatic_ = false;
+    std::uint32_t syncedVersion_ = 0;
+    bool synced_ = false;
 };
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <threepp/threepp.hpp>
+#include <memory>
+#include <vector>
+#include "loaders/mesh_data.hpp"
+
+/**
+ * threepp geometries, materials and scene graphs built from MeshData.
+ */
+namespace ModelBuilder {
+    // GPU-side resources for a mesh: one geometry per part, one material per MeshMaterial
+    [[nodiscard]] std::vector<std::shared_ptr<threepp::BufferGeometry>> createGeometries(const MeshData& mesh);
+    [[nodiscard]] std::vector<std::shared_ptr<threepp::Material>> createMaterials(const MeshData& mesh);
+
+    // New scene graph (a Group with one Mesh per part) sharing the given geometries and materials
+    [[nodiscard]] std::shared_ptr<threepp::Group> buildGroup(
+        const MeshData& mesh,
+        const std::vector<std::shared_ptr<threepp::BufferGeometry>>& geometries,
+        const std::vector<std::shared_ptr<threepp::Material>>& materials);
+}
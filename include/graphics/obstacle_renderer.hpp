@@ -1,23 +1,63 @@
 #pragma once
 
-#include "graphics/game_object_renderer.hpp"
-#include "core/obstacle.hpp"
+#include <threepp/threepp.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "core/lod_selector.hpp"
+#include "core/obstacle_manager.hpp"
+#include "graphics/render_resource_cache.hpp"
 
 /**
- * Renders obstacles (walls and trees) with appropriate 3D models.
+ * Renders all obstacles with a fixed number of draw calls.
+ * The perimeter walls are merged into a few static meshes, one per map chunk, so the ones
+ * behind the camera are frustum culled. Trees are instanced per level of detail: each frame
+ * update() looks up the trees near the camera in the obstacle grid, drops those outside the
+ * view frustum and sorts the rest into full, low-poly and billboard instances by distance.
+ * Tree shadows come from a separate set of low-poly proxies holding every tree.
  */
-class ObstacleRenderer : public GameObjectRenderer {
+class ObstacleRenderer {
 public:
-    ObstacleRenderer(threepp::Scene& scene, const Obstacle& obstacle);
+    ObstacleRenderer(threepp::Scene& scene, RenderResourceCache& resources, const ObstacleManager& obstacles);
+    ~ObstacleRenderer();
 
-    void update() override;
+    ObstacleRenderer(const ObstacleRenderer&) = delete;
+    ObstacleRenderer& operator=(const ObstacleRenderer&) = delete;
 
-protected:
-    void createModel() override;
+    // Pick visible trees and their detail for this camera; without frustumCull every tree
+    // in range is kept (for views that don't look through this camera)
+    void update(threepp::Camera& camera, bool frustumCull = true);
+
+    // Shadow-only stand-ins for the trees
+    [[nodiscard]] threepp::Object3D& getShadowProxyGroup() noexcept { return *shadowProxyGroup_; }
 
 private:
-    void createWallMesh();
-    void createTreeMesh();
+    static constexpr std::size_t TREE_MESH_LEVELS = 2;  // Full and low-poly
+    static constexpr std::uint8_t TREE_BILLBOARD_LEVEL = TREE_MESH_LEVELS;
+
+    struct TreeMeshes {
+        std::shared_ptr<threepp::InstancedMesh> trunk;
+        std::shared_ptr<threepp::InstancedMesh> foliage;
+    };
+
+    void createWallMeshes(const std::vector<const Obstacle*>& walls);
+    void createTreeMeshes(const std::vector<const Obstacle*>& trees);
+    [[nodiscard]] std::shared_ptr<threepp::BufferGeometry> createBillboardGeometry() const;
+
+    threepp::Scene& scene_;
+    RenderResourceCache& resources_;
+    const ObstacleManager& obstacles_;
+    std::shared_ptr<threepp::Group> objectGroup_;
+    std::shared_ptr<threepp::Group> shadowProxyGroup_;
+
+    // Trees by level of detail
+    LodSelector treeLod_;
+    std::array<TreeMeshes, TREE_MESH_LEVELS> treeMeshes_;
+    std::shared_ptr<threepp::InstancedMesh> treeBillboards_;
 
-    const Obstacle& obstacle_;
+    // Per obstacle index: tree level from the last update (culled when out of range)
+    std::vector<std::uint8_t> treeLevels_;
+    std::vector<std::uint32_t> nearby_;          // Obstacles in range this update
+    std::vector<std::uint32_t> previousNearby_;  // And the one before
 };
@@ -1,18 +1,40 @@
 #pragma once
 
-#include "graphics/game_object_renderer.hpp"
+#include <threepp/threepp.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
 #include "core/powerup.hpp"
+#include "core/simulation_snapshot.hpp"
+#include "graphics/render_resource_cache.hpp"
 
 /**
- * Renders powerups with distinctive visual appearance (glowing cylinder).
+ * Renders all powerups as one instanced glowing cylinder.
+ * Picked-up powerups are hidden by collapsing their instance instead of adding draw calls.
  */
-class PowerupRenderer : public GameObjectRenderer {
+class PowerupRenderer {
 public:
-    PowerupRenderer(threepp::Scene& scene, const Powerup& powerup);
+    PowerupRenderer(threepp::Scene& scene, RenderResourceCache& resources,
+                    const std::vector<std::unique_ptr<Powerup>>& powerups);
+    ~PowerupRenderer();
 
-protected:
-    void createModel() override;
+    PowerupRenderer(const PowerupRenderer&) = delete;
+    PowerupRenderer& operator=(const PowerupRenderer&) = delete;
+
+    void setVisible(std::size_t index, bool visible);
+
+    // Apply the visibility changes since the last sync; touches every powerup only on the first
+    // call or after falling further behind than the snapshot's change list reaches
+    void sync(const SimulationSnapshot& snapshot);
+    [[nodiscard]] std::size_t getCount() const noexcept { return positions_.size(); }
 
 private:
-    const Powerup& powerup_;
+    threepp::Scene& scene_;
+    std::shared_ptr<threepp::InstancedMesh> mesh_;
+    std::vector<std::array<float, 3>> positions_;
+    std::vector<bool> visible_;
+    float heightOffset_;
+    std::uint64_t syncedSerial_ = 0;
+    bool fullSyncNeeded_ = true;
 };
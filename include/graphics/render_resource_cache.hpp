@@ -0,0 +1,119 @@
+#pragma once
+
+#include <threepp/threepp.hpp>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "core/resource_cache.hpp"
+#include "loaders/async_mesh_loader.hpp"
+#include "loaders/mesh_library.hpp"
+
+/**
+ * Shared geometries and materials for all renderers.
+ * Identical requests (same shape parameters, same material properties) get the same
+ * GPU buffers and program state instead of a fresh copy per object.
+ * Materials handed out here are shared: don't modify them per object.
+ *
+ * Model files go through a MeshLibrary, so each OBJ is parsed at most once per process
+ * (and after the first run it is read from its binary cache instead). requestModel does that
+ * work on a background thread; finishModel then creates the GPU-side objects on the caller's.
+ */
+class RenderResourceCache {
+public:
+    // Segment count of 0 means threepp's default for that shape
+    static constexpr unsigned int DEFAULT_SEGMENTS = 0;
+
+    struct LoadedModel {
+        std::shared_ptr<threepp::Group> group;  // Fresh scene graph, nullptr if loading failed
+        std::shared_ptr<const MeshData> data;   // Bounds and pivot center, precomputed
+
+        explicit operator bool() const noexcept { return group != nullptr; }
+    };
+
+    struct PendingModel {
+        std::string path;
+        AsyncMeshLoader::MeshFuture data;
+
+        [[nodiscard]] bool isReady() const { return isMeshReady(data); }
+    };
+
+    RenderResourceCache();
+
+    RenderResourceCache(const RenderResourceCache&) = delete;
+    RenderResourceCache& operator=(const RenderResourceCache&) = delete;
+
+    [[nodiscard]] std::shared_ptr<threepp::BufferGeometry> box(float width, float height, float depth);
+    [[nodiscard]] std::shared_ptr<threepp::BufferGeometry> cylinder(float radiusTop, float radiusBottom, float height,
+                                                                    unsigned int radialSegments = DEFAULT_SEGMENTS);
+    // Segments are around the equator; half as many from pole to pole
+    [[nodiscard]] std::shared_ptr<threepp::BufferGeometry> sphere(float radius, unsigned int segments = DEFAULT_SEGMENTS);
+    [[nodiscard]] std::shared_ptr<threepp::BufferGeometry> plane(float width, float height);
+
+    [[nodiscard]] std::shared_ptr<threepp::MeshPhongMaterial> phongMaterial(unsigned int color, unsigned int emissive = 0x000000,
+                                                                           float emissiveIntensity = 1.0f);
+
+    // New instance of a model file; geometries and materials are shared between instances
+    [[nodiscard]] LoadedModel loadModel(const std::string& path);
+
+    // Start reading and parsing a model file in the background
+    [[nodiscard]] PendingModel requestModel(const std::string& path);
+
+    // Instance of a requested model; blocks until the background load is done, so poll isReady() first
+    [[nodiscard]] LoadedModel finishModel(const PendingModel& pending);
+
+    [[nodiscard]] const ResourceCacheStats& getGeometryStats() const noexcept { return geometries_.getStats(); }
+    [[nodiscard]] const ResourceCacheStats& getMaterialStats() const noexcept { return materials_.getStats(); }
+
+    // One line per cache with requests, hit rate and memory saved
+    void logStats() const;
+
+private:
+    enum class Shape : unsigned int {
+        BOX,
+        CYLINDER,
+        SPHERE,
+        PLANE
+    };
+
+    struct GeometryKey {
+        Shape shape;
+        std::array<float, 3> dimensions;
+        unsigned int segments;
+
+        bool operator==(const GeometryKey&) const = default;
+    };
+
+    struct GeometryKeyHash {
+        std::size_t operator()(const GeometryKey& key) const noexcept;
+    };
+
+    struct MaterialKey {
+        unsigned int color;
+        unsigned int emissive;
+        float emissiveIntensity;
+
+        bool operator==(const MaterialKey&) const = default;
+    };
+
+    struct MaterialKeyHash {
+        std::size_t operator()(const MaterialKey& key) const noexcept;
+    };
+
+    ResourceCache<GeometryKey, threepp::BufferGeometry, GeometryKeyHash> geometries_;
+    ResourceCache<MaterialKey, threepp::MeshPhongMaterial, MaterialKeyHash> materials_;
+
+    struct ModelResources {
+        std::shared_ptr<const MeshData> data;
+        std::vector<std::shared_ptr<threepp::BufferGeometry>> geometries;
+        std::vector<std::shared_ptr<threepp::Material>> materials;
+    };
+
+    [[nodiscard]] LoadedModel instantiate(const std::string& path, std::shared_ptr<const MeshData> data);
+
+    MeshLibrary meshLibrary_;
+    AsyncMeshLoader asyncLoader_;  // After meshLibrary_: its worker must stop first
+    std::unordered_map<std::string, ModelResources> models_;
+};
@@ -5,6 +5,7 @@
 
 #include <threepp/threepp.hpp>
 #include <memory>
+#include "graphics/render_resource_cache.hpp"
 
 // Camera modes
 enum class CameraMode {
@@ -12,9 +13,19 @@ enum class CameraMode {
     INTERIOR  // First-person cockpit camera
 };
 
+// Minimap modes
+enum class MinimapMode {
+    VECTOR,    // 2D map around the vehicle drawn from the obstacle grid
+    OVERVIEW,  // 2D map of the whole arena
+    SCENE      // Top-down render of the 3D scene
+};
+
 /**
  * Manages 3D scene, cameras, lighting, and rendering.
  * Supports multiple camera modes with smooth interpolation and FOV adjustments.
+ *
+ * The sun's shadow map covers only the region around the vehicle and follows it, so each frame
+ * draws the casters near the car into a small map instead of the whole arena into a large one.
  */
 class SceneManager {
 public:
@@ -29,6 +40,7 @@ public:
     [[nodiscard]] threepp::Scene& getScene() noexcept;
     [[nodiscard]] threepp::Camera& getCamera() noexcept;
     [[nodiscard]] threepp::GLRenderer& getRenderer() noexcept;
+    [[nodiscard]] RenderResourceCache& getResourceCache() noexcept { return resourceCache_; }
 
     // Setup methods
     void setupLighting();
@@ -43,6 +55,15 @@ public:
                                   float driftAngle = 0.0f);
     void updateMinimapCamera(float targetX, float targetZ, float vehicleScale);
     void updateCameraFOV(bool nitrousActive, float vehicleVelocity = 0.0f);
+    void updateShadowRegion(float targetX, float targetZ, float vehicleScale);
+
+    // Meshes under root cast shadows but are never drawn, for casters whose visible meshes
+    // change per frame (culling, LOD)
+    void registerShadowProxies(threepp::Object3D& root);
+
+    // How many scene nodes have frozen transforms (see GameObjectRenderer::freezeTransforms) and
+    // what that saves: the per-frame matrix pass is timed with them frozen and thawed
+    void logTransformStats() const;
 
     // Camera mode control
     void setCameraMode(CameraMode mode) noexcept;
@@ -52,6 +73,13 @@ public:
     void setCameraYaw(float yaw);
     void setCameraYawTarget(float yaw);
 
+    // Minimap mode control
+    [[nodiscard]] MinimapMode getMinimapMode() const noexcept { return minimapMode_; }
+    void toggleMinimapMode() noexcept;
+    // Half extent of the world square around the vehicle shown by the minimap
+    [[nodiscard]] float getMinimapViewSize() const noexcept { return minimapViewSize_; }
+
+
     // Rendering
     void render();
     void renderMinimap();
@@ -59,10 +87,12 @@ public:
 
 private:
     std::unique_ptr<threepp::GLRenderer> renderer_;
+    RenderResourceCache resourceCache_;
     std::shared_ptr<threepp::Scene> scene_;
     std::shared_ptr<threepp::PerspectiveCamera> camera_;
     std::shared_ptr<threepp::OrthographicCamera> minimapCamera_;
     std::shared_ptr<threepp::Mesh> groundMesh_;
+    std::shared_ptr<threepp::DirectionalLight> sunLight_;
 
     // Camera follow parameters (scaled by vehicle size)
     float cameraDistance_;
@@ -86,6 +116,10 @@ private:
     // Camera mode
     CameraMode cameraMode_;
 
+    // Minimap
+    MinimapMode minimapMode_;
+    float minimapViewSize_;
+
     // Current camera state for smooth interpolation
     float currentCameraX_;
     float currentCameraY_;
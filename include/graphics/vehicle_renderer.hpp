@@ -8,6 +8,7 @@
 #include "graphics/game_object_renderer.hpp"
 #include "core/interfaces/IVehicleState.hpp"
 #include <string>
+#include <vector>
 
 /**
  * Renders the vehicle with support for custom OBJ models.
@@ -15,10 +16,14 @@
  */
 class VehicleRenderer : public GameObjectRenderer {
   public:
-    VehicleRenderer(threepp::Scene& scene, const IVehicleState& vehicleState);
+    // vehicle supplies the fixed size; everything that changes is read from vehicleState,
+    // which may be a snapshot view while the simulation runs on another thread
+    VehicleRenderer(threepp::Scene& scene, RenderResourceCache& resources, const GameObject& vehicle,
+                    const IVehicleState& vehicleState);
 
-    // Load 3D model from OBJ file
-    bool loadModel(const std::string& modelPath);
+    // Start loading a 3D model from an OBJ file in the background; the fallback box is shown
+    // until update() finds it ready and swaps it in
+    void requestModel(const std::string& modelPath);
 
     // Revert to fallback box geometry
     void unloadModel();
@@ -26,8 +31,9 @@ class VehicleRenderer : public GameObjectRenderer {
     // Apply runtime scale to the vehicle model
     void applyScale(float scale);
 
-    // Update visual representation with wheel and steering animations
-    void update(bool leftPressed = false, bool rightPressed = false);
+    // Update visual representation with wheel and steering animations,
+    // placing the vehicle at an (interpolated) transform
+    void update(const TransformState& transform, bool leftPressed = false, bool rightPressed = false);
 
     // Steering wheel position in vehicle-local coordinates (for camera placement)
     [[nodiscard]] std::array<float, 3> getSteeringWheelPosition() const noexcept;
@@ -60,12 +66,24 @@ class VehicleRenderer : public GameObjectRenderer {
     std::shared_ptr<threepp::Group> wheelRLPivot_;
     std::shared_ptr<threepp::Group> wheelRRPivot_;
 
+    // Models still loading on the resource cache's worker thread
+    enum class Part { BODY, WHEEL_FL, WHEEL_FR, WHEEL_RL, WHEEL_RR, STEERING_WHEEL };
+    struct PendingPart {
+        Part part;
+        RenderResourceCache::PendingModel model;
+    };
+    std::vector<PendingPart> pendingParts_;
+
     // Helper methods
-    bool loadWheelModels(const std::string& wheelsDir);
+    void requestParts();
+    void attachPendingParts();
+    void attachBody(const RenderResourceCache::LoadedModel& model);
+
+    void attachWheel(Part part, const RenderResourceCache::LoadedModel& model);
     void unloadWheelModels();
     void applyWheelScaleAndPosition(float appliedScale);
 
-    bool loadSteeringWheel(const std::string& steeringWheelPath);
+    void attachSteeringWheel(const RenderResourceCache::LoadedModel& model);
     void unloadSteeringWheel();
     void applySteeringWheelScaleAndPosition(float appliedScale);
 
@@ -82,6 +100,9 @@ class VehicleRenderer : public GameObjectRenderer {
     // Spin axis detection
     enum class WheelSpinAxis { X, Y, Z };
 
+    // The smallest bounding box extent is the wheel's thickness, so it spins around that axis
+    [[nodiscard]] static WheelSpinAxis thinnestAxis(const std::array<float, 3>& size) noexcept;
+
     // Steering wheel geometry and rotation axis
     std::array<float,3> steeringWheelCenter_ = {0.0f, 0.0f, 0.0f};
     WheelSpinAxis steeringWheelRotationAxis_ = WheelSpinAxis::X;
@@ -1,36 +1,34 @@
 #pragma once
 
 #include <threepp/threepp.hpp>
-#include <functional>
-#include "core/interfaces/IControllable.hpp"
+#include "core/control_state.hpp"
 #include "graphics/scene_manager.hpp"
 
 /**
  * Handles keyboard input and translates it to game controls.
  * Implements WASD movement, space for drift, arrow keys for camera, and action keys.
+ * Driving keys are collected into a ControlState that the fixed-step loop applies every tick.
  */
 class InputHandler : public threepp::KeyListener {
 public:
-    explicit InputHandler(IControllable& controllable, SceneManager& sceneManager);
+    explicit InputHandler(SceneManager& sceneManager);
 
     void onKeyPressed(threepp::KeyEvent evt) override;
     void onKeyReleased(threepp::KeyEvent evt) override;
 
-    // Apply continuous input (e.g., acceleration)
-    void update(float deltaTime);
+    // Held keys plus any drift/nitrous/reset press since the last poll, so quick taps are not lost
+    [[nodiscard]] ControlState pollControls() noexcept;
 
-    // Set callback for reset event
-    void setResetCallback(std::function<void()> callback);
+    // True once per press of the profiler key
+    [[nodiscard]] bool consumeProfilerToggle() noexcept;
 
     // Current steering input state for visual feedback
     [[nodiscard]] bool isLeftPressed() const noexcept { return steerLeftPressed_; }
     [[nodiscard]] bool isRightPressed() const noexcept { return steerRightPressed_; }
 
 private:
-    void onReset();
     void updateCamera();
 
-    IControllable& controllable_;
     SceneManager& sceneManager_;
 
     // Key state tracking
@@ -43,7 +41,12 @@ private:
     bool leftArrowPressed_;
     bool rightArrowPressed_;
     bool downArrowPressed_;
-    bool shiftPressed_;
-
-    std::function<void()> resetCallback_;
+    bool spacePressed_;
+    bool fPressed_;
+
+    // Presses waiting for the next poll
+    bool driftTapped_;
+    bool nitrousTapped_;
+    bool resetTapped_;
+    bool profilerToggleTapped_;
 };
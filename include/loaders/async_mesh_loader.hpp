@@ -0,0 +1,53 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include "loaders/mesh_library.hpp"
+
+/**
+ * Loads models through a MeshLibrary on a background worker, so reading and parsing
+ * files never blocks the render thread. Callers poll the returned future each frame and
+ * do the GPU-side work themselves once it is ready.
+ */
+class AsyncMeshLoader {
+public:
+    using MeshFuture = std::shared_future<std::shared_ptr<const MeshData>>;
+
+    explicit AsyncMeshLoader(MeshLibrary& library);
+    ~AsyncMeshLoader();
+
+    AsyncMeshLoader(const AsyncMeshLoader&) = delete;
+    AsyncMeshLoader& operator=(const AsyncMeshLoader&) = delete;
+
+    // Queue a load; requests for the same path share one future. The value is nullptr on failure,
+    // and a request after a failed load tries again
+    [[nodiscard]] MeshFuture request(const std::string& path);
+
+    [[nodiscard]] std::size_t getPendingCount() const;
+
+private:
+    void run();
+
+    MeshLibrary& library_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<std::pair<std::string, std::promise<std::shared_ptr<const MeshData>>>> queue_;
+    std::unordered_map<std::string, MeshFuture> requested_;
+    bool stopping_;
+
+    std::thread worker_;  // Last member: starts once everything above exists
+};
+
+// True once the future holds a value (never blocks)
+[[nodiscard]] inline bool isMeshReady(const AsyncMeshLoader::MeshFuture& future) {
+    return future.valid() && future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
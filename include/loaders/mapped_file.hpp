@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * Read-only memory mapping of a whole file (mmap / MapViewOfFile).
+ * The contents are paged in by the OS on access instead of copied through a stream.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // False if the file is missing, empty or could not be mapped
+    [[nodiscard]] bool isOpen() const noexcept { return data_ != nullptr; }
+    [[nodiscard]] const unsigned char* data() const noexcept { return data_; }
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+private:
+    void close() noexcept;
+
+    const unsigned char* data_ = nullptr;
+    std::size_t size_ = 0;
+#if defined(_WIN32)
+    void* fileHandle_ = nullptr;
+    void* mappingHandle_ = nullptr;
+#endif
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include "loaders/mesh_data.hpp"
+
+/**
+ * Compact binary copy of a parsed model, written next to the source file the first
+ * time it is loaded and memory-mapped on later runs instead of parsing text again.
+ *
+ * The header stores a fingerprint of the source OBJ and its MTL; a changed source,
+ * another format version or a damaged file reads as a miss and the model is re-parsed.
+ * Floats are stored in native byte order, the cache is not meant to be shipped.
+ */
+namespace MeshCache {
+    inline constexpr std::uint32_t FORMAT_VERSION = 1;
+
+    // <source>.meshcache
+    [[nodiscard]] std::string cachePathFor(const std::string& sourcePath);
+
+    // Size and modification time of the OBJ and the MTL with the same stem; 0 if the OBJ is missing
+    [[nodiscard]] std::uint64_t sourceStamp(const std::string& sourcePath);
+
+    // Returns false if the file could not be written
+    bool write(const std::string& cachePath, const MeshData& mesh, std::uint64_t stamp);
+
+    // Empty on a missing, stale or malformed cache
+    [[nodiscard]] std::optional<MeshData> read(const std::string& cachePath, std::uint64_t expectedStamp);
+}
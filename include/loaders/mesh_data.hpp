@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Renderer-independent copy of a loaded model: materials plus non-indexed triangle
+ * parts, ready to be uploaded as vertex buffers. Bounds are stored with the data so
+ * callers get the pivot center and extents without walking every vertex again.
+ */
+struct MeshMaterial {
+    std::string name;
+    std::array<float, 3> diffuse{1.0f, 1.0f, 1.0f};
+    std::array<float, 3> specular{0.066f, 0.066f, 0.066f};
+    std::array<float, 3> emissive{0.0f, 0.0f, 0.0f};
+    float shininess = 30.0f;
+    float opacity = 1.0f;
+
+    bool operator==(const MeshMaterial&) const = default;
+};
+
+struct MeshPart {
+    std::string name;
+    std::uint32_t materialIndex = 0;
+    std::vector<float> positions;  // xyz per vertex
+    std::vector<float> normals;    // xyz per vertex, or empty
+    std::vector<float> uvs;        // uv per vertex, or empty
+
+    bool operator==(const MeshPart&) const = default;
+};
+
+struct MeshData {
+    std::vector<MeshMaterial> materials;
+    std::vector<MeshPart> parts;
+    std::array<float, 3> boundsMin{0.0f, 0.0f, 0.0f};
+    std::array<float, 3> boundsMax{0.0f, 0.0f, 0.0f};
+
+    // Recompute boundsMin/boundsMax from every part's positions
+    void computeBounds() noexcept;
+
+    [[nodiscard]] std::array<float, 3> getCenter() const noexcept;
+    [[nodiscard]] std::array<float, 3> getSize() const noexcept;
+    [[nodiscard]] std::size_t getVertexCount() const noexcept;
+    [[nodiscard]] bool empty() const noexcept { return parts.empty(); }
+
+    bool operator==(const MeshData&) const = default;
+};
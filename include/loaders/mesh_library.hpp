@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include "loaders/mesh_data.hpp"
+
+/**
+ * Process-wide front door for model files.
+ * Each path is parsed at most once per process once it loads; the result is kept in memory and in a
+ * MeshCache file, so later runs map the binary copy instead of parsing text.
+ * Safe to call from several threads; loads of different files are serialised.
+ */
+class MeshLibrary {
+public:
+    // Turns a model file into MeshData, empty on failure
+    using Parser = std::function<std::optional<MeshData>(const std::string& path)>;
+
+    struct Stats {
+        std::size_t memoryHits = 0;
+        std::size_t diskHits = 0;
+        std::size_t parses = 0;
+        std::size_t failures = 0;
+    };
+
+    explicit MeshLibrary(Parser parser, bool useDiskCache = true);
+
+    // Shared, immutable mesh for path; nullptr if it could not be loaded (tried again next call)
+    [[nodiscard]] std::shared_ptr<const MeshData> load(const std::string& path);
+
+    [[nodiscard]] Stats getStats() const;
+
+private:
+    Parser parser_;
+    bool useDiskCache_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<const MeshData>> meshes_;  // Successful loads only
+    Stats stats_;
+};
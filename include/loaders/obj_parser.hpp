@@ -0,0 +1,28 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "loaders/mesh_data.hpp"
+
+/**
+ * Wavefront OBJ/MTL reader producing the same parts and materials that
+ * threepp's OBJLoader gives for the same file.
+ *
+ * The text is split into chunks on line boundaries and the chunks are parsed in parallel:
+ * one pass counts vertex records so every chunk knows where its vertices go, a second
+ * reads numbers with std::from_chars straight into the shared arrays, and a third expands
+ * faces. Objects and materials that span chunks are stitched back together in file order.
+ */
+namespace ObjParser {
+    // 0 threads means one per hardware thread; mtllib files are looked up next to the OBJ
+    [[nodiscard]] std::optional<MeshData> parseFile(const std::string& path, unsigned int threadCount = 0);
+
+    // Empty if the text has no faces
+    [[nodiscard]] std::optional<MeshData> parse(std::string_view text, const std::string& materialDirectory,
+                                                unsigned int threadCount = 0);
+
+    // newmtl entries with Kd, Ks, Ke, Ns, d and Tr; everything else keeps the MeshMaterial defaults
+    [[nodiscard]] std::vector<MeshMaterial> parseMaterials(std::string_view text);
+}
@@ -2,6 +2,7 @@
 
 #include <threepp/threepp.hpp>
 #include "core/interfaces/IVehicleState.hpp"
+#include "core/profiler.hpp"
 
 /**
  * Renders ImGui dashboard overlay with speedometer, RPM gauge, and gear indicator.
@@ -14,6 +15,10 @@ public:
     // Render UI elements (call between ImGui::NewFrame() and ImGui::Render())
     void render(const IVehicleState& vehicle, const threepp::WindowSize& size);
 
+    // Frame time percentiles, frame history and a flame view of the last frame's zones;
+    // returns true when the user asked for a trace dump
+    bool renderProfiler(const Profiler& profiler);
+
 private:
     // Smoothed display state for realistic gauge needles
     float displayedSpeedRatio_ = 0.0f;
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "core/obstacle_manager.hpp"
+#include "core/powerup_manager.hpp"
+#include "core/simulation_snapshot.hpp"
+#include "core/transform_state.hpp"
+
+/**
+ * Top-down 2D minimap drawn with ImGui draw-list primitives (north up, like the minimap camera).
+ * Only obstacles inside the visible window are fetched, through the obstacle grid, so it costs
+ * a handful of primitives instead of a second pass over the lit, shadowed 3D scene, and a
+ * whole-map overview is as cheap as the close-up.
+ */
+class MinimapOverlay {
+public:
+    // World square shown on the map
+    struct View {
+        float centerX = 0.0f;
+        float centerZ = 0.0f;
+        float halfSize = 1.0f;
+    };
+
+    // Obstacles and powerup positions never change after construction, so reading them from
+    // the render thread is safe; powerup visibility comes from the snapshot
+    MinimapOverlay(const ObstacleManager& obstacles, const PowerupManager& powerups);
+
+    // Draw into the screen square at (screenX, screenY) (pixels, top-left origin)
+    void render(const View& view, float screenX, float screenY, float screenSize, const SimulationSnapshot& snapshot,
+                const TransformState& vehicle, const std::array<float, 3>& vehicleSize);
+
+private:
+    const ObstacleManager& obstacles_;
+    const PowerupManager& powerups_;
+    std::vector<std::uint32_t> visible_;  // Reused between frames
+};
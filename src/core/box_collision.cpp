@@ -0,0 +1,84 @@
+#include "core/box_collision.hpp"
+#include "box_collision_kernel.hpp"
+#include <cmath>
+
+std::size_t BoxCollisionKernels::sweepScalar(const BoxLanes& lanes, std::size_t begin, const Mover& mover) noexcept {
+    return sweepLanes<ScalarOps>(lanes, begin, mover);
+}
+
+OrientedBox OrientedBox::of(const GameObject& object) noexcept {
+    const auto& position = object.getPosition();
+    const auto& size = object.getSize();
+    const float rotation = object.getRotation();
+    return {position[0], position[2], std::cos(rotation), -std::sin(rotation), size[0] / 2.0f, size[2] / 2.0f};
+}
+
+BoxCollisionBatch::BoxCollisionBatch(SimdLevel level)
+    : simdLevel_(clampSimdLevel(level)) {
+}
+
+std::size_t BoxCollisionBatch::add(const OrientedBox& box) {
+    centerX_.push_back(box.centerX);
+    centerZ_.push_back(box.centerZ);
+    axisX_.push_back(box.axisX);
+    axisZ_.push_back(box.axisZ);
+    halfExtentX_.push_back(box.halfExtentX);
+    halfExtentZ_.push_back(box.halfExtentZ);
+
+    timeOfImpact_.push_back(NO_IMPACT);
+    penetration_.push_back(0.0f);
+    normalX_.push_back(0.0f);
+    normalZ_.push_back(0.0f);
+
+    return centerX_.size() - 1;
+}
+
+void BoxCollisionBatch::clear() noexcept {
+    for (auto* lane : {&centerX_, &centerZ_, &axisX_, &axisZ_, &halfExtentX_, &halfExtentZ_,
+                       &timeOfImpact_, &penetration_, &normalX_, &normalZ_}) {
+        lane->clear();
+    }
+}
+
+void BoxCollisionBatch::reserve(std::size_t count) {
+    for (auto* lane : {&centerX_, &centerZ_, &axisX_, &axisZ_, &halfExtentX_, &halfExtentZ_,
+                       &timeOfImpact_, &penetration_, &normalX_, &normalZ_}) {
+        lane->reserve(count);
+    }
+}
+
+void BoxCollisionBatch::sweep(const OrientedBox& mover, float moveX, float moveZ) noexcept {
+    const BoxCollisionKernels::BoxLanes lanes{
+        size(),
+        centerX_.data(), centerZ_.data(), axisX_.data(), axisZ_.data(), halfExtentX_.data(), halfExtentZ_.data(),
+        timeOfImpact_.data(), penetration_.data(), normalX_.data(), normalZ_.data()
+    };
+    const BoxCollisionKernels::Mover moving{
+        mover.centerX, mover.centerZ, moveX, moveZ,
+        mover.axisX, mover.axisZ, mover.halfExtentX, mover.halfExtentZ,
+        NO_IMPACT
+    };
+
+    std::size_t done = 0;
+    switch (simdLevel_) {
+#if defined(CARSIM_HAS_AVX512_KERNELS)
+        case SimdLevel::AVX512:
+            done = BoxCollisionKernels::sweepAvx512(lanes, moving);
+            break;
+#endif
+#if defined(CARSIM_HAS_AVX2_KERNELS)
+        case SimdLevel::AVX2:
+            done = BoxCollisionKernels::sweepAvx2(lanes, moving);
+            break;
+#endif
+        default:
+            break;
+    }
+
+    // Remainder that does not fill a vector, or everything on the scalar level
+    BoxCollisionKernels::sweepScalar(lanes, done, moving);
+}
+
+void BoxCollisionBatch::setSimdLevel(SimdLevel level) noexcept {
+    simdLevel_ = clampSimdLevel(level);
+}
@@ -0,0 +1,7 @@
+// Built with AVX2 enabled (see src/core/CMakeLists.txt); only called after runtime detection
+#define CARSIM_SIMD_AVX2
+#include "box_collision_kernel.hpp"
+
+std::size_t BoxCollisionKernels::sweepAvx2(const BoxLanes& lanes, const Mover& mover) noexcept {
+    return sweepLanes<Avx2Ops>(lanes, 0, mover);
+}
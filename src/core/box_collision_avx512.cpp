@@ -0,0 +1,7 @@
+// Built with AVX-512F enabled (see src/core/CMakeLists.txt); only called after runtime detection
+#define CARSIM_SIMD_AVX512
+#include "box_collision_kernel.hpp"
+
+std::size_t BoxCollisionKernels::sweepAvx512(const BoxLanes& lanes, const Mover& mover) noexcept {
+    return sweepLanes<Avx512Ops>(lanes, 0, mover);
+}
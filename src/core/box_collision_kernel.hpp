@@ -0,0 +1,173 @@
+#pragma once
+
+// Moving box against static boxes over structure-of-arrays lanes.
+//
+// Private to src/core: included once by the scalar, AVX2 and AVX-512
+// translation units, each instantiating sweepLanes with its own ops policy.
+// Only add, sub, mul, div, abs, min, max and compares are used, all exactly
+// rounded, so every level produces the same bits as long as the compiler is
+// not allowed to fuse multiplies and adds (see src/core/CMakeLists.txt).
+
+#include <cstddef>
+#include "simd_ops.hpp"
+
+namespace BoxCollisionKernels {
+
+/**
+ * Raw views of the BoxCollisionBatch arrays handed to the kernels.
+ */
+struct BoxLanes {
+    std::size_t count;
+
+    const float* centerX;
+    const float* centerZ;
+    const float* axisX;
+    const float* axisZ;
+    const float* halfExtentX;
+    const float* halfExtentZ;
+
+    float* timeOfImpact;
+    float* penetration;
+    float* normalX;
+    float* normalZ;
+};
+
+/**
+ * The box being moved, shared by every lane.
+ */
+struct Mover {
+    float startX;
+    float startZ;
+    float moveX;
+    float moveZ;
+    float axisX;
+    float axisZ;
+    float halfExtentX;
+    float halfExtentZ;
+    float noImpact;  // Time written for boxes that are never touched
+};
+
+// Each entry point sweeps lanes [0, n) for some n <= count that is a multiple of its width
+// and returns n; the caller finishes the tail with the scalar kernel.
+std::size_t sweepScalar(const BoxLanes& lanes, std::size_t begin, const Mover& mover) noexcept;
+std::size_t sweepAvx2(const BoxLanes& lanes, const Mover& mover) noexcept;
+std::size_t sweepAvx512(const BoxLanes& lanes, const Mover& mover) noexcept;
+
+} // namespace BoxCollisionKernels
+
+namespace {
+
+// Stand-in for "always" and "never" in the overlap interval, far outside [0, 1]
+constexpr float BOX_UNBOUNDED_TIME = 1e30f;
+
+// Projected speeds below this count as not moving along the axis
+constexpr float BOX_MIN_AXIS_RATE = 1e-9f;
+
+// Accumulated over the four candidate separating axes of one lane
+template <class Ops>
+struct AxisResult {
+    typename Ops::F penetration;
+    typename Ops::F normalX;
+    typename Ops::F normalZ;
+    typename Ops::F entry;  // Latest time any axis starts overlapping
+    typename Ops::F exit;   // Earliest time any axis stops overlapping
+};
+
+// One separating axis: radius is the sum of both boxes' projected half extents on it
+template <class Ops>
+void testAxis(typename Ops::F axisX, typename Ops::F axisZ, typename Ops::F radius,
+              typename Ops::F startX, typename Ops::F startZ, typename Ops::F moveX, typename Ops::F moveZ,
+              AxisResult<Ops>& result) noexcept {
+    using F = typename Ops::F;
+    const F zero = Ops::set(0.0f);
+
+    const F startDistance = Ops::add(Ops::mul(startX, axisX), Ops::mul(startZ, axisZ));
+    const F rate = Ops::add(Ops::mul(moveX, axisX), Ops::mul(moveZ, axisZ));
+    const F endDistance = Ops::add(startDistance, rate);
+
+    // Overlap at the end of the move, resolved toward the side the mover is on
+    const F depth = Ops::sub(radius, Ops::abs(endDistance));
+    const auto shallower = Ops::lt(depth, result.penetration);
+    const auto negativeSide = Ops::lt(endDistance, zero);
+    result.penetration = Ops::select(shallower, depth, result.penetration);
+    result.normalX = Ops::select(shallower, Ops::select(negativeSide, Ops::neg(axisX), axisX), result.normalX);
+    result.normalZ = Ops::select(shallower, Ops::select(negativeSide, Ops::neg(axisZ), axisZ), result.normalZ);
+
+    // Part of the move during which |startDistance + t * rate| <= radius
+    const auto still = Ops::lt(Ops::abs(rate), Ops::set(BOX_MIN_AXIS_RATE));
+    const F safeRate = Ops::select(still, Ops::set(1.0f), rate);
+    const F towardNegative = Ops::div(Ops::sub(Ops::neg(radius), startDistance), safeRate);
+    const F towardPositive = Ops::div(Ops::sub(radius, startDistance), safeRate);
+
+    const auto apart = Ops::gt(Ops::abs(startDistance), radius);
+    const F stillEntry = Ops::select(apart, Ops::set(BOX_UNBOUNDED_TIME), Ops::set(-BOX_UNBOUNDED_TIME));
+    const F stillExit = Ops::neg(stillEntry);
+
+    result.entry = Ops::max(result.entry, Ops::select(still, stillEntry, Ops::min(towardNegative, towardPositive)));
+    result.exit = Ops::min(result.exit, Ops::select(still, stillExit, Ops::max(towardNegative, towardPositive)));
+}
+
+template <class Ops>
+void sweepLanesAt(const BoxCollisionKernels::BoxLanes& l, std::size_t i, const BoxCollisionKernels::Mover& mover) noexcept {
+    using F = typename Ops::F;
+
+    const F boxAxisX = Ops::load(l.axisX + i);
+    const F boxAxisZ = Ops::load(l.axisZ + i);
+    const F boxHalfX = Ops::load(l.halfExtentX + i);
+    const F boxHalfZ = Ops::load(l.halfExtentZ + i);
+
+    const F moverAxisX = Ops::set(mover.axisX);
+    const F moverAxisZ = Ops::set(mover.axisZ);
+    const F moverHalfX = Ops::set(mover.halfExtentX);
+    const F moverHalfZ = Ops::set(mover.halfExtentZ);
+
+    // Each box's local z axis is its x axis turned a quarter, so the four cross projections
+    // come down to |cos| and |sin| of the angle between the boxes
+    const F cosine = Ops::abs(Ops::add(Ops::mul(boxAxisX, moverAxisX), Ops::mul(boxAxisZ, moverAxisZ)));
+    const F sine = Ops::abs(Ops::sub(Ops::mul(boxAxisX, moverAxisZ), Ops::mul(boxAxisZ, moverAxisX)));
+
+    // Mover relative to the box
+    const F startX = Ops::sub(Ops::set(mover.startX), Ops::load(l.centerX + i));
+    const F startZ = Ops::sub(Ops::set(mover.startZ), Ops::load(l.centerZ + i));
+    const F moveX = Ops::set(mover.moveX);
+    const F moveZ = Ops::set(mover.moveZ);
+
+    AxisResult<Ops> result{
+        Ops::set(BOX_UNBOUNDED_TIME), Ops::set(0.0f), Ops::set(0.0f),
+        Ops::set(-BOX_UNBOUNDED_TIME), Ops::set(BOX_UNBOUNDED_TIME)
+    };
+
+    // Box axes first, so a tie between a wall face and the vehicle's side pushes off the wall
+    testAxis<Ops>(boxAxisX, boxAxisZ,
+                  Ops::add(boxHalfX, Ops::add(Ops::mul(moverHalfX, cosine), Ops::mul(moverHalfZ, sine))),
+                  startX, startZ, moveX, moveZ, result);
+    testAxis<Ops>(Ops::neg(boxAxisZ), boxAxisX,
+                  Ops::add(boxHalfZ, Ops::add(Ops::mul(moverHalfX, sine), Ops::mul(moverHalfZ, cosine))),
+                  startX, startZ, moveX, moveZ, result);
+    testAxis<Ops>(moverAxisX, moverAxisZ,
+                  Ops::add(moverHalfX, Ops::add(Ops::mul(boxHalfX, cosine), Ops::mul(boxHalfZ, sine))),
+                  startX, startZ, moveX, moveZ, result);
+    testAxis<Ops>(Ops::neg(moverAxisZ), moverAxisX,
+                  Ops::add(moverHalfZ, Ops::add(Ops::mul(boxHalfX, sine), Ops::mul(boxHalfZ, cosine))),
+                  startX, startZ, moveX, moveZ, result);
+
+    // Touching at some point of the move when every axis overlaps at once
+    const auto touches = Ops::mand(Ops::le(result.entry, result.exit),
+                                   Ops::mand(Ops::le(result.entry, Ops::set(1.0f)), Ops::ge(result.exit, Ops::set(0.0f))));
+    Ops::store(l.timeOfImpact + i, Ops::select(touches, result.entry, Ops::set(mover.noImpact)));
+    Ops::store(l.penetration + i, result.penetration);
+    Ops::store(l.normalX + i, result.normalX);
+    Ops::store(l.normalZ + i, result.normalZ);
+}
+
+template <class Ops>
+std::size_t sweepLanes(const BoxCollisionKernels::BoxLanes& lanes, std::size_t begin,
+                       const BoxCollisionKernels::Mover& mover) noexcept {
+    std::size_t i = begin;
+    for (; i + Ops::WIDTH <= lanes.count; i += Ops::WIDTH) {
+        sweepLanesAt<Ops>(lanes, i, mover);
+    }
+    return i;
+}
+
+} // namespace
@@ -0,0 +1,111 @@
+#include "core/contact_solver.hpp"
+#include "core/game_config.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+bool ContactSolver::solve(Vehicle& vehicle, const std::vector<Contact>& contacts, float deltaTime) {
+    if (contacts.empty()) {
+        impulses_.clear();
+        return false;
+    }
+
+    // Velocity as a vector along the direction of travel
+    const float movementAngle = vehicle.getMovementAngle();
+    const float directionX = std::sin(movementAngle);
+    const float directionZ = std::cos(movementAngle);
+    float velocityX = directionX * vehicle.getVelocity();
+    float velocityZ = directionZ * vehicle.getVelocity();
+
+    // Set up the rows, warm started from last tick's impulses on the same obstacles
+    rows_.clear();
+    auto cached = impulses_.begin();
+    for (const Contact& contact : contacts) {
+        // A gap may close within the step but no faster; only a touching contact bounces. The
+        // sweep parks a vehicle that hit something a skin short of it, which counts as touching.
+        float targetNormalSpeed;
+        if (contact.penetration <= -GameConfig::Collision::CONTACT_SKIN) {
+            targetNormalSpeed = deltaTime > 0.0f ? contact.penetration / deltaTime
+                                                 : -std::numeric_limits<float>::infinity();
+        } else {
+            const float approachSpeed = velocityX * contact.normalX + velocityZ * contact.normalZ;
+            targetNormalSpeed = approachSpeed < -GameConfig::Collision::RESTITUTION_MIN_SPEED
+                ? -GameConfig::Collision::RESTITUTION * approachSpeed
+                : 0.0f;
+        }
+
+        cached = std::lower_bound(cached, impulses_.end(), contact.obstacle,
+                                  [](const Impulse& impulse, std::uint32_t obstacle) { return impulse.obstacle < obstacle; });
+        const bool persists = cached != impulses_.end() && cached->obstacle == contact.obstacle;
+        rows_.push_back({contact.normalX, contact.normalZ, targetNormalSpeed,
+                         persists ? cached->normal : 0.0f, persists ? cached->tangent : 0.0f});
+    }
+    for (const Row& row : rows_) {
+        velocityX += row.normalX * row.normalImpulse - row.normalZ * row.tangentImpulse;
+        velocityZ += row.normalZ * row.normalImpulse + row.normalX * row.tangentImpulse;
+    }
+
+    // Gauss-Seidel over the rows; clamping the accumulated impulse (not each delta) lets a
+    // later row undo an earlier one's overshoot, including a stale warm start
+    for (int iteration = 0; iteration < GameConfig::Collision::SOLVER_ITERATIONS; ++iteration) {
+        for (Row& row : rows_) {
+            const float normalSpeed = velocityX * row.normalX + velocityZ * row.normalZ;
+            const float normalImpulse = (std::max)(row.normalImpulse + row.targetNormalSpeed - normalSpeed, 0.0f);
+            const float normalDelta = normalImpulse - row.normalImpulse;
+            row.normalImpulse = normalImpulse;
+            velocityX += row.normalX * normalDelta;
+            velocityZ += row.normalZ * normalDelta;
+
+            // Tangent is the normal turned a quarter
+            const float tangentSpeed = velocityZ * row.normalX - velocityX * row.normalZ;
+            const float frictionLimit = GameConfig::Collision::FRICTION * row.normalImpulse;
+            const float tangentImpulse = std::clamp(row.tangentImpulse - tangentSpeed, -frictionLimit, frictionLimit);
+            const float tangentDelta = tangentImpulse - row.tangentImpulse;
+            row.tangentImpulse = tangentImpulse;
+            velocityX -= row.normalZ * tangentDelta;
+            velocityZ += row.normalX * tangentDelta;
+        }
+    }
+
+    // Push out of every overlap beyond the slop, each contact seeing the others' corrections
+    float offsetX = 0.0f;
+    float offsetZ = 0.0f;
+    for (int iteration = 0; iteration < GameConfig::Collision::SOLVER_ITERATIONS; ++iteration) {
+        bool corrected = false;
+        for (const Contact& contact : contacts) {
+            const float remaining = contact.penetration - (offsetX * contact.normalX + offsetZ * contact.normalZ)
+                                  - GameConfig::Collision::PENETRATION_SLOP;
+            if (remaining > 0.0f) {
+                offsetX += contact.normalX * remaining;
+                offsetZ += contact.normalZ * remaining;
+                corrected = true;
+            }
+        }
+        if (!corrected) {
+            break;
+        }
+    }
+
+    impulses_.clear();
+    for (std::size_t i = 0; i < contacts.size(); ++i) {
+        impulses_.push_back({contacts[i].obstacle, rows_[i].normalImpulse, rows_[i].tangentImpulse});
+    }
+
+    // The car can't slide sideways: keep what is left along its direction of travel
+    const float velocity = velocityX * directionX + velocityZ * directionZ;
+    const bool moved = offsetX != 0.0f || offsetZ != 0.0f;
+    const bool slowed = velocity != vehicle.getVelocity();
+    if (moved) {
+        const auto& position = vehicle.getPosition();
+        vehicle.setPosition(position[0] + offsetX, position[1], position[2] + offsetZ);
+    }
+    if (slowed) {
+        vehicle.setVelocity(velocity);
+    }
+    return moved || slowed;
+}
+
+void ContactSolver::clear() noexcept {
+    impulses_.clear();
+    rows_.clear();
+}
@@ -0,0 +1,49 @@
+#include "core/control_state.hpp"
+
+std::uint32_t packControls(const ControlState& controls) noexcept {
+    return (controls.forward ? ControlBit::FORWARD : 0u) |
+           (controls.backward ? ControlBit::BACKWARD : 0u) |
+           (controls.left ? ControlBit::LEFT : 0u) |
+           (controls.right ? ControlBit::RIGHT : 0u) |
+           (controls.drift ? ControlBit::DRIFT : 0u) |
+           (controls.nitrous ? ControlBit::NITROUS : 0u) |
+           (controls.reset ? ControlBit::RESET : 0u);
+}
+
+ControlState unpackControls(std::uint32_t bits) noexcept {
+    ControlState controls;
+    controls.forward = (bits & ControlBit::FORWARD) != 0;
+    controls.backward = (bits & ControlBit::BACKWARD) != 0;
+    controls.left = (bits & ControlBit::LEFT) != 0;
+    controls.right = (bits & ControlBit::RIGHT) != 0;
+    controls.drift = (bits & ControlBit::DRIFT) != 0;
+    controls.nitrous = (bits & ControlBit::NITROUS) != 0;
+    controls.reset = (bits & ControlBit::RESET) != 0;
+    return controls;
+}
+
+void applyControls(IControllable& target, const ControlState& current, const ControlState& previous, float deltaTime) noexcept {
+    // Same priorities as the keyboard: forward wins over brake
+    if (current.forward) {
+        target.accelerateForward();
+    } else if (current.backward) {
+        target.accelerateBackward();
+    }
+
+    if (current.left) {
+        target.turn(deltaTime);
+    }
+    if (current.right) {
+        target.turn(-deltaTime);
+    }
+
+    if (current.drift && !previous.drift) {
+        target.startDrift();
+    } else if (!current.drift && previous.drift) {
+        target.stopDrift();
+    }
+
+    if (current.nitrous && !previous.nitrous) {
+        target.activateNitrous();
+    }
+}
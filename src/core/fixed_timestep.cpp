@@ -0,0 +1,48 @@
+#include "core/fixed_timestep.hpp"
+#include <algorithm>
+#include <cmath>
+
+FixedTimestep::FixedTimestep(float tickRate, int maxStepsPerFrame)
+    : stepSize_(1.0f / GameConfig::Timing::TICK_RATE),
+      maxStepsPerFrame_((std::max)(1, maxStepsPerFrame)),
+      accumulator_(0.0),
+      droppedTime_(0.0) {
+    setTickRate(tickRate);
+}
+
+int FixedTimestep::advance(float frameTime) noexcept {
+    // Negative or NaN frame times would stall the loop, huge ones would freeze it
+    if (!(frameTime > 0.0f)) {
+        return 0;
+    }
+    accumulator_ += (std::min)(frameTime, GameConfig::Timing::MAX_FRAME_TIME);
+
+    const int steps = static_cast<int>(std::floor(accumulator_ / stepSize_));
+    if (steps <= maxStepsPerFrame_) {
+        accumulator_ -= steps * static_cast<double>(stepSize_);
+        return steps;
+    }
+
+    // Too far behind: run the cap and keep only the fraction of a step for interpolation
+    accumulator_ -= maxStepsPerFrame_ * static_cast<double>(stepSize_);
+    const double leftover = std::fmod(accumulator_, static_cast<double>(stepSize_));
+    droppedTime_ += accumulator_ - leftover;
+    accumulator_ = leftover;
+    return maxStepsPerFrame_;
+}
+
+float FixedTimestep::getAlpha() const noexcept {
+    return (std::clamp)(static_cast<float>(accumulator_ / stepSize_), 0.0f, 1.0f);
+}
+
+void FixedTimestep::setTickRate(float tickRate) noexcept {
+    const float clamped = (std::clamp)(tickRate, GameConfig::Timing::MIN_TICK_RATE, GameConfig::Timing::MAX_TICK_RATE);
+    stepSize_ = 1.0f / clamped;
+    // Keep the leftover time meaningful at the new rate
+    accumulator_ = (std::min)(accumulator_, static_cast<double>(stepSize_));
+}
+
+void FixedTimestep::reset() noexcept {
+    accumulator_ = 0.0;
+    droppedTime_ = 0.0;
+}
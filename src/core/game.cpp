@@ -1,21 +1,51 @@
 #include "core/game.hpp"
 #include "core/game_config.hpp"
 #include "core/logger.hpp"
+#include "core/profiler.hpp"
 #include <iostream>
+#include <utility>
+
+namespace {
+    constexpr const char* PROFILER_TRACE_PATH = "carsim_trace.json";
+}
 
 Game::Game(threepp::Canvas& canvas)
     : canvas_(canvas),
+      lastResetCount_(0),
       audioEnabled_(true),
+      profilerVisible_(false),
       shouldExit_(false),
       clock_(),
       lastWindowWidth_(0),
       lastWindowHeight_(0) {
 }
 
+Game::~Game() {
+    if (!recording_ || !simulationThread_) {
+        return;
+    }
+
+    // The recording is written by the simulation thread until it stops
+    simulationThread_->stop();
+    recording_->setTickCount(simulation_->getTickCount());
+    try {
+        recording_->saveToFile(recordingPath_);
+        Logger::info(Logger::Tag::GENERAL, "Saved input recording (", recording_->getTickCount(), " ticks) to ",
+                     recordingPath_);
+    } catch (const std::exception& e) {
+        Logger::error(e.what());
+    }
+}
+
+void Game::recordInputTo(std::string path) {
+    recordingPath_ = std::move(path);
+}
+
 void Game::initialize() {
     Logger::info("Initializing game...");
 
     initializeScene();
+    initializeSimulation();
     initializeVehicle();
     initializeObstacles();
     initializePowerups();
@@ -23,6 +53,12 @@ void Game::initialize() {
     initializeAudio();
     initializeUI();
 
+    sceneManager_->getResourceCache().logStats();
+    sceneManager_->logTransformStats();
+
+    // From here on the simulation belongs to its thread; the rest of Game reads snapshots
+    simulationThread_->start();
+
     Logger::info("Game initialization complete.");
     std::cout << "Game initialization complete." << std::endl;
 }
@@ -40,81 +76,68 @@ void Game::initializeScene() {
     sceneManager_->setupMinimapCamera(aspectRatio);
 }
 
-void Game::initializeVehicle() {
-    // Create vehicle at spawn point
-    vehicle_ = std::make_unique<Vehicle>(
-        GameConfig::World::SPAWN_POINT_X,
-        GameConfig::World::SPAWN_POINT_Y,
-        GameConfig::World::SPAWN_POINT_Z
+void Game::initializeSimulation() {
+    // Vehicle, obstacles and powerups live in the render-less simulation
+    simulation_ = std::make_unique<Simulation>(
+        GameConfig::World::PLAY_AREA_SIZE,
+        GameConfig::Obstacle::DEFAULT_TREE_COUNT,
+        GameConfig::Powerup::DEFAULT_COUNT
     );
 
-    // Create vehicle renderer
-    vehicleRenderer_ = std::make_unique<VehicleRenderer>(sceneManager_->getScene(), *vehicle_);
+    simulationThread_ = std::make_unique<SimulationThread>(*simulation_, GameConfig::Timing::TICK_RATE);
+    vehicleView_.bind(simulationThread_->getSnapshot().vehicle);
+
+    if (!recordingPath_.empty()) {
+        InputRecording::World world;
+        world.seed = simulation_->getSeed();
+        world.playAreaSize = GameConfig::World::PLAY_AREA_SIZE;
+        world.treeCount = GameConfig::Obstacle::DEFAULT_TREE_COUNT;
+        world.powerupCount = GameConfig::Powerup::DEFAULT_COUNT;
+        world.stepSize = simulationThread_->getStepSize();
+        recording_ = std::make_unique<InputRecording>(world);
+        simulationThread_->setRecording(recording_.get());
+        Logger::info(Logger::Tag::GENERAL, "Recording input to ", recordingPath_, " (world seed ", world.seed, ")");
+    }
+}
+
+void Game::initializeVehicle() {
+    Vehicle& vehicle = simulation_->getVehicle();
 
-    // Load custom model
-    vehicleRenderer_->loadModel(GameConfig::Assets::CAR_MODEL_PATH);
+    // Create vehicle renderer; its live state comes from the simulation snapshot
+    vehicleRenderer_ = std::make_unique<VehicleRenderer>(sceneManager_->getScene(), sceneManager_->getResourceCache(),
+                                                         vehicle, vehicleView_);
 
-    // Apply scale to the vehicle renderer
-    vehicleRenderer_->applyScale(vehicle_->getScale());
+    // Load custom model in the background; the placeholder box is drawn until it arrives
+    vehicleRenderer_->requestModel(GameConfig::Assets::CAR_MODEL_PATH);
 
-    // Set up reset callback
-    vehicle_->setResetCameraCallback([this]() {
-        sceneManager_->setCameraMode(CameraMode::FOLLOW);
-    });
+    // Apply scale to the vehicle renderer (also used for the model once it arrives)
+    vehicleRenderer_->applyScale(vehicle.getScale());
 }
 
 void Game::initializeObstacles() {
-    // Create obstacle manager
-    obstacleManager_ = std::make_unique<ObstacleManager>(
-        GameConfig::World::PLAY_AREA_SIZE,
-        GameConfig::Obstacle::DEFAULT_TREE_COUNT
-    );
-
-    // Get obstacles from manager
-    const auto& obstacles = obstacleManager_->getObstacles();
+    // One renderer batches every wall and tree from the simulation's obstacles
+    obstacleRenderer_ = std::make_unique<ObstacleRenderer>(sceneManager_->getScene(), sceneManager_->getResourceCache(),
+                                                           simulation_->getObstacleManager());
 
-    // Create renderers for all obstacles
-    for (const auto& obstacle : obstacles) {
-        auto renderer = std::make_unique<ObstacleRenderer>(sceneManager_->getScene(), *obstacle);
-        renderer->update(); // Set initial position
-        obstacleRenderers_.push_back(std::move(renderer));
-    }
+    // Trees cast their shadows through proxies, whatever detail level is drawn
+    sceneManager_->registerShadowProxies(obstacleRenderer_->getShadowProxyGroup());
 }
 
 void Game::initializePowerups() {
-    // Create powerup manager
-    powerupManager_ = std::make_unique<PowerupManager>(
-        GameConfig::Powerup::DEFAULT_COUNT,
-        GameConfig::World::PLAY_AREA_SIZE
-    );
-
-    // Get powerups from manager
-    const auto& powerups = powerupManager_->getPowerups();
+    // Get powerups from the simulation
+    const auto& powerups = simulation_->getPowerupManager().getPowerups();
 
-    // Create renderers for all powerups
-    for (const auto& powerup : powerups) {
-        auto renderer = std::make_unique<PowerupRenderer>(sceneManager_->getScene(), *powerup);
-        renderer->update(); // Set initial position
-        powerupRenderers_.push_back(std::move(renderer));
-    }
+    // All powerups share one instanced mesh
+    powerupRenderer_ = std::make_unique<PowerupRenderer>(sceneManager_->getScene(), sceneManager_->getResourceCache(),
+                                                         powerups);
 }
 
 void Game::initializeInput() {
-    inputHandler_ = std::make_unique<InputHandler>(*vehicle_, *sceneManager_);
+    // Driving keys reach the vehicle through the simulation, which also handles reset
+    inputHandler_ = std::make_unique<InputHandler>(*sceneManager_);
 
     // Register input handler with canvas
     canvas_.addKeyListener(*inputHandler_);
-
-    // Set reset callback
-    inputHandler_->setResetCallback([this]() {
-        // Reset vehicle position
-        vehicle_->reset();
-
-        // Reset all powerups
-        if (powerupManager_) {
-            powerupManager_->reset();
-        }
-    });
 }
 
 void Game::initializeAudio() {
@@ -128,11 +151,14 @@ void Game::initializeAudio() {
 
 void Game::initializeUI() {
     imguiLayer_ = std::make_unique<ImGuiLayer>();
+    minimapOverlay_ = std::make_unique<MinimapOverlay>(simulation_->getObstacleManager(),
+                                                       simulation_->getPowerupManager());
 }
 
-void Game::update(float deltaTime) {
-    // Cap deltaTime to avoid physics bugs on lag spikes (100ms max = 10 FPS min)
-    deltaTime = std::clamp(deltaTime, 0.0f, 0.1f);
+void Game::update([[maybe_unused]] float deltaTime) {
+    CARSIM_PROFILE_ZONE("Game::update");
+
+    // The simulation keeps its own clock on the simulation thread, frame time is not needed here
 
     // Handle window resizing
     auto size = canvas_.size();
@@ -144,77 +170,93 @@ void Game::update(float deltaTime) {
         }
     }
 
-    updateGameState(deltaTime);
+    updateGameState();
     updateCamera();
     updateAudio();
 }
 
-void Game::updateGameState(float deltaTime) {
-    if (inputHandler_) {
-        inputHandler_->update(deltaTime);
+void Game::updateGameState() {
+    CARSIM_PROFILE_ZONE("Game::updateGameState");
+    if (!simulationThread_) {
+        return;
     }
 
-    if (vehicle_) {
-        vehicle_->update(deltaTime);
+    // Physics ticks on its own thread, this frame only hands over input and reads the result
+    if (inputHandler_) {
+        simulationThread_->submitControls(inputHandler_->pollControls());
     }
 
-    if (vehicleRenderer_ && vehicle_) {
-        vehicleRenderer_->update(inputHandler_ ? inputHandler_->isLeftPressed() : false,
-                                inputHandler_ ? inputHandler_->isRightPressed() : false);
-    }
+    simulationThread_->updateSnapshot();
+    const SimulationSnapshot& snapshot = simulationThread_->getSnapshot();
+    vehicleView_.bind(snapshot.vehicle);
 
-    if (obstacleManager_ && vehicle_) {
-        obstacleManager_->handleCollisions(*vehicle_);
+    // Respawn happened on the simulation thread, camera changes stay on this one
+    if (snapshot.resetCount != lastResetCount_) {
+        lastResetCount_ = snapshot.resetCount;
+        sceneManager_->setCameraMode(CameraMode::FOLLOW);
     }
 
-    if (powerupManager_) {
-        powerupManager_->update(deltaTime);
-    }
+    const float alpha = simulationThread_->getInterpolationAlpha(SimulationThread::nowNanoseconds());
+    vehicleTransform_ = interpolateTransform(snapshot.vehicle.previous, snapshot.vehicle.current, alpha);
 
-    if (powerupManager_ && vehicle_) {
-        powerupManager_->handleCollisions(*vehicle_);
+    if (vehicleRenderer_) {
+        vehicleRenderer_->update(vehicleTransform_,
+                                inputHandler_ ? inputHandler_->isLeftPressed() : false,
+                                inputHandler_ ? inputHandler_->isRightPressed() : false);
     }
 
-    for (auto& renderer : powerupRenderers_) {
-        if (renderer) {
-            renderer->update();
-        }
+    // Only the powerups that were collected or respawned since the last frame
+    if (powerupRenderer_) {
+        powerupRenderer_->sync(snapshot);
     }
 
     // Obstacles don't need updating - they're static
 }
 
 void Game::updateCamera() {
-    if (!sceneManager_ || !vehicle_) {
+    CARSIM_PROFILE_ZONE("Game::updateCamera");
+    if (!sceneManager_) {
         return;
     }
 
-    auto pos = vehicle_->getPosition();
-    float rotation = vehicle_->getRotation();
-    float scale = vehicle_->getScale();
-    bool nitrousActive = vehicle_->isNitrousActive();
-    float velocity = vehicle_->getVelocity();
-    float driftAngle = vehicle_->getDriftAngle();
+    // Follow the same in-between transform the vehicle is drawn at
+    const IVehicleState& vehicle = vehicleView_;
+    auto pos = vehicleTransform_.position;
+    float rotation = vehicleTransform_.rotation;
+    float scale = vehicle.getScale();
+    bool nitrousActive = vehicle.isNitrousActive();
+    float velocity = vehicle.getVelocity();
+    float driftAngle = vehicle.getDriftAngle();
 
     sceneManager_->updateCameraFollowTarget(pos[0], pos[1], pos[2], rotation, scale,
                                            nitrousActive, velocity, driftAngle);
     sceneManager_->updateMinimapCamera(pos[0], pos[2], scale);
+    sceneManager_->updateShadowRegion(pos[0], pos[2], scale);
     sceneManager_->updateCameraFOV(nitrousActive, velocity);
+
+    // The 3D minimap looks around the vehicle, not through the main camera
+    if (obstacleRenderer_) {
+        obstacleRenderer_->update(sceneManager_->getCamera(),
+                                  sceneManager_->getMinimapMode() != MinimapMode::SCENE);
+    }
 }
 
 void Game::updateAudio() {
-    if (audioEnabled_ && audioManager_ && vehicle_) {
-        audioManager_->update(*vehicle_);
+    CARSIM_PROFILE_ZONE("Game::updateAudio");
+    if (audioEnabled_ && audioManager_) {
+        audioManager_->update(vehicleView_);
     }
 }
 
 void Game::render() {
+    CARSIM_PROFILE_ZONE("Game::render");
     renderMainView();
     renderMinimap();
     renderUI();
 }
 
 void Game::renderMainView() {
+    CARSIM_PROFILE_ZONE("Game::renderMainView");
     if (!sceneManager_) return;
 
     auto& renderer = sceneManager_->getRenderer();
@@ -230,7 +272,9 @@ void Game::renderMainView() {
 }
 
 void Game::renderMinimap() {
-    if (!sceneManager_) return;
+    CARSIM_PROFILE_ZONE("Game::renderMinimap");
+    // The 2D modes are drawn with the UI instead
+    if (!sceneManager_ || sceneManager_->getMinimapMode() != MinimapMode::SCENE) return;
 
     auto& renderer = sceneManager_->getRenderer();
     auto size = canvas_.size();
@@ -250,7 +294,8 @@ void Game::renderMinimap() {
 }
 
 void Game::renderUI() {
-    if (!imguiLayer_ || !vehicle_) return;
+    CARSIM_PROFILE_ZONE("Game::renderUI");
+    if (!imguiLayer_) return;
 
     auto& renderer = sceneManager_->getRenderer();
     auto size = canvas_.size();
@@ -259,5 +304,41 @@ void Game::renderUI() {
     renderer.setViewport(0, 0, size.width(), size.height());
 
     // Render ImGui overlay
-    imguiLayer_->render(*vehicle_, size);
+    imguiLayer_->render(vehicleView_, size);
+    renderMinimapOverlay();
+
+    if (inputHandler_ && inputHandler_->consumeProfilerToggle()) {
+        profilerVisible_ = !profilerVisible_;
+    }
+    if (profilerVisible_ && imguiLayer_->renderProfiler(Profiler::instance())) {
+        if (Profiler::instance().writeChromeTrace(PROFILER_TRACE_PATH)) {
+            Logger::info(Logger::Tag::GENERAL, "Wrote profiler trace to ", PROFILER_TRACE_PATH);
+        } else {
+            Logger::warning(Logger::Tag::GENERAL, "Failed to write profiler trace to ", PROFILER_TRACE_PATH);
+        }
+    }
+}
+
+void Game::renderMinimapOverlay() {
+    if (!minimapOverlay_ || !simulationThread_) return;
+
+    const MinimapMode mode = sceneManager_->getMinimapMode();
+    if (mode == MinimapMode::SCENE) return;
+
+    MinimapOverlay::View view;
+    float screenSize = static_cast<float>(GameConfig::UI::MINIMAP_SIZE);
+    if (mode == MinimapMode::VECTOR) {
+        view.centerX = vehicleTransform_.position[0];
+        view.centerZ = vehicleTransform_.position[2];
+        view.halfSize = sceneManager_->getMinimapViewSize();
+    } else {
+        view.halfSize = GameConfig::World::PLAY_AREA_SIZE * 0.5f + GameConfig::UI::MINIMAP_OVERVIEW_MARGIN;
+        screenSize = static_cast<float>(GameConfig::UI::MINIMAP_OVERVIEW_SIZE);
+    }
+
+    const auto& size = simulation_->getVehicle().getSize();
+    const float scale = vehicleView_.getScale();
+    const float padding = static_cast<float>(GameConfig::UI::MINIMAP_PADDING);
+    minimapOverlay_->render(view, padding, padding, screenSize, simulationThread_->getSnapshot(), vehicleTransform_,
+                            {size[0] * scale, size[1] * scale, size[2] * scale});
 }
@@ -9,11 +9,14 @@ namespace {
 GameObject::GameObject(float x, float y, float z)
     : position_({x, y, z}),
       initialPosition_({x, y, z}),
+      previousPosition_({x, y, z}),
       rotation_(0.0f),
       initialRotation_(0.0f),
+      previousRotation_(0.0f),
       size_({1.0f, 1.0f, 1.0f}),
       collisionRadius_(0.0f),
-      active_(true) {
+      active_(true),
+      version_(0) {
     updateCollisionRadius();
 }
 
@@ -28,6 +31,19 @@ void GameObject::reset() noexcept {
     position_ = initialPosition_;
     rotation_ = initialRotation_;
     active_ = true;
+    markChanged();
+
+    // Teleport, nothing to interpolate from
+    storePreviousTransform();
+}
+
+void GameObject::storePreviousTransform() noexcept {
+    previousPosition_ = position_;
+    previousRotation_ = rotation_;
+}
+
+TransformState GameObject::getInterpolatedTransform(float alpha) const noexcept {
+    return interpolateTransform({previousPosition_, previousRotation_}, {position_, rotation_}, alpha);
 }
 
 const std::array<float, 3>& GameObject::getPosition() const noexcept {
@@ -47,17 +63,29 @@ bool GameObject::isActive() const noexcept {
 }
 
 void GameObject::setPosition(float x, float y, float z) noexcept {
+    if (position_[0] == x && position_[1] == y && position_[2] == z) {
+        return;
+    }
     position_[0] = x;
     position_[1] = y;
     position_[2] = z;
+    markChanged();
 }
 
 void GameObject::setRotation(float rotation) noexcept {
+    if (rotation_ == rotation) {
+        return;
+    }
     rotation_ = rotation;
+    markChanged();
 }
 
 void GameObject::setActive(bool active) noexcept {
+    if (active_ == active) {
+        return;
+    }
     active_ = active;
+    markChanged();
 }
 
 bool GameObject::checkCircleCollision(const GameObject& other, float& overlapDistance, float& normalX, float& normalZ) const noexcept {
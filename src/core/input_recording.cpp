@@ -0,0 +1,204 @@
+#include "core/input_recording.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    constexpr std::array<char, 4> MAGIC = {'C', 'S', 'R', 'P'};
+    constexpr std::uint16_t FORMAT_VERSION = 1;
+    constexpr std::uint32_t VALID_CONTROL_BITS = (ControlBit::RESET << 1) - 1;
+
+    // Each byte carries 7 bits of the value, high bit set when more follow
+    constexpr int VARINT_MAX_BYTES = 10;
+    constexpr std::uint8_t VARINT_CONTINUE = 0x80;
+    constexpr std::uint8_t VARINT_PAYLOAD = 0x7F;
+
+    template <typename T>
+    void writeLittleEndian(std::ostream& output, T value) {
+        const auto bits = static_cast<std::uint64_t>(value);
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            output.put(static_cast<char>((bits >> (8 * i)) & 0xFF));
+        }
+    }
+
+    void writeVarint(std::ostream& output, std::uint64_t value) {
+        while (value >= VARINT_CONTINUE) {
+            output.put(static_cast<char>((value & VARINT_PAYLOAD) | VARINT_CONTINUE));
+            value >>= 7;
+        }
+        output.put(static_cast<char>(value));
+    }
+
+    std::uint8_t readByte(std::istream& input) {
+        const int byte = input.get();
+        if (byte == std::char_traits<char>::eof()) {
+            throw std::runtime_error("Recording is truncated");
+        }
+        return static_cast<std::uint8_t>(byte);
+    }
+
+    template <typename T>
+    T readLittleEndian(std::istream& input) {
+        std::uint64_t bits = 0;
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            bits |= static_cast<std::uint64_t>(readByte(input)) << (8 * i);
+        }
+        return static_cast<T>(bits);
+    }
+
+    std::uint64_t readVarint(std::istream& input) {
+        std::uint64_t value = 0;
+        for (int i = 0; i < VARINT_MAX_BYTES; ++i) {
+            const std::uint8_t byte = readByte(input);
+            value |= static_cast<std::uint64_t>(byte & VARINT_PAYLOAD) << (7 * i);
+            if ((byte & VARINT_CONTINUE) == 0) {
+                return value;
+            }
+        }
+        throw std::runtime_error("Recording has an overlong tick delta");
+    }
+}
+
+InputRecording::InputRecording(const World& world)
+    : world_(world) {
+}
+
+void InputRecording::record(std::uint64_t tick, const ControlState& controls) {
+    if (!commands_.empty() && tick < commands_.back().tick) {
+        throw std::invalid_argument("Recorded ticks must not go backwards");
+    }
+    tickCount_ = (std::max)(tickCount_, tick + 1);
+
+    if (!commands_.empty()) {
+        Command& last = commands_.back();
+        if (last.controls == controls) {
+            return;
+        }
+        if (last.tick == tick) {
+            last.controls = controls;
+            return;
+        }
+    }
+    commands_.push_back({tick, controls});
+}
+
+void InputRecording::setTickCount(std::uint64_t tickCount) noexcept {
+    const std::uint64_t minimum = commands_.empty() ? 0 : commands_.back().tick + 1;
+    tickCount_ = (std::max)(tickCount, minimum);
+}
+
+ControlState InputRecording::controlsAt(std::uint64_t tick) const noexcept {
+    // Last command at or before the tick
+    const auto it = std::upper_bound(commands_.begin(), commands_.end(), tick,
+                                     [](std::uint64_t value, const Command& command) { return value < command.tick; });
+    return it == commands_.begin() ? ControlState{} : std::prev(it)->controls;
+}
+
+void InputRecording::save(std::ostream& output) const {
+    output.write(MAGIC.data(), MAGIC.size());
+    writeLittleEndian(output, FORMAT_VERSION);
+    writeLittleEndian(output, world_.seed);
+    writeLittleEndian(output, std::bit_cast<std::uint32_t>(world_.playAreaSize));
+    writeLittleEndian(output, static_cast<std::uint32_t>(world_.treeCount));
+    writeLittleEndian(output, static_cast<std::uint32_t>(world_.powerupCount));
+    writeLittleEndian(output, std::bit_cast<std::uint32_t>(world_.stepSize));
+    writeLittleEndian(output, tickCount_);
+    writeLittleEndian(output, static_cast<std::uint64_t>(commands_.size()));
+
+    std::uint64_t previousTick = 0;
+    for (const Command& command : commands_) {
+        writeVarint(output, command.tick - previousTick);
+        output.put(static_cast<char>(packControls(command.controls)));
+        previousTick = command.tick;
+    }
+
+    if (!output) {
+        throw std::runtime_error("Failed to write recording");
+    }
+}
+
+void InputRecording::saveToFile(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot open recording file for writing: " + path);
+    }
+    save(file);
+}
+
+InputRecording InputRecording::load(std::istream& input) {
+    std::array<char, 4> magic{};
+    input.read(magic.data(), magic.size());
+    if (!input || magic != MAGIC) {
+        throw std::runtime_error("Not an input recording");
+    }
+    const auto version = readLittleEndian<std::uint16_t>(input);
+    if (version != FORMAT_VERSION) {
+        throw std::runtime_error("Unsupported recording version " + std::to_string(version));
+    }
+
+    InputRecording recording;
+    recording.world_.seed = readLittleEndian<std::uint32_t>(input);
+    recording.world_.playAreaSize = std::bit_cast<float>(readLittleEndian<std::uint32_t>(input));
+    recording.world_.treeCount = static_cast<std::int32_t>(readLittleEndian<std::uint32_t>(input));
+    recording.world_.powerupCount = static_cast<std::int32_t>(readLittleEndian<std::uint32_t>(input));
+    recording.world_.stepSize = std::bit_cast<float>(readLittleEndian<std::uint32_t>(input));
+    const auto tickCount = readLittleEndian<std::uint64_t>(input);
+    const auto commandCount = readLittleEndian<std::uint64_t>(input);
+
+    if (!(recording.world_.stepSize > 0.0f) || !(recording.world_.playAreaSize > 0.0f)) {
+        throw std::runtime_error("Recording has an invalid world");
+    }
+
+    std::uint64_t tick = 0;
+    for (std::uint64_t i = 0; i < commandCount; ++i) {
+        const std::uint64_t delta = readVarint(input);
+        if (i > 0 && delta == 0) {
+            throw std::runtime_error("Recording has two commands for tick " + std::to_string(tick));
+        }
+        tick += delta;
+        const std::uint8_t bits = readByte(input);
+        if ((bits & ~VALID_CONTROL_BITS) != 0) {
+            throw std::runtime_error("Recording has unknown control bits");
+        }
+        recording.commands_.push_back({tick, unpackControls(bits)});
+    }
+    recording.setTickCount(tickCount);
+    return recording;
+}
+
+InputRecording InputRecording::loadFromFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot open recording file: " + path);
+    }
+    return load(file);
+}
+
+InputReplay::InputReplay(InputRecording recording)
+    : recording_(std::move(recording)),
+      simulation_(recording_.getWorld().playAreaSize,
+                  recording_.getWorld().treeCount,
+                  recording_.getWorld().powerupCount,
+                  recording_.getWorld().seed) {
+}
+
+bool InputReplay::step() {
+    if (isFinished()) {
+        return false;
+    }
+    simulation_.step(recording_.controlsAt(simulation_.getTickCount()), recording_.getWorld().stepSize);
+    return true;
+}
+
+void InputReplay::run() {
+    while (step()) {
+    }
+}
+
+bool InputReplay::isFinished() const noexcept {
+    return simulation_.getTickCount() >= recording_.getTickCount();
+}
@@ -0,0 +1,157 @@
+#include "core/input_script.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+    [[noreturn]] void throwParseError(int lineNumber, const std::string& reason) {
+        throw std::runtime_error("InputScript line " + std::to_string(lineNumber) + ": " + reason);
+    }
+
+    void applyKeyToken(std::string token, ControlState& controls, int lineNumber) {
+        std::transform(token.begin(), token.end(), token.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+
+        if (token == "-") {
+            return;
+        }
+        if (token == "SPACE") {
+            controls.drift = true;
+            return;
+        }
+
+        for (char key : token) {
+            switch (key) {
+                case 'W': controls.forward = true; break;
+                case 'S': controls.backward = true; break;
+                case 'A': controls.left = true; break;
+                case 'D': controls.right = true; break;
+                case 'F': controls.nitrous = true; break;
+                case 'R': controls.reset = true; break;
+                default:
+                    throwParseError(lineNumber, "unknown key '" + token + "'");
+            }
+        }
+    }
+}
+
+InputScript::InputScript(std::vector<Segment> segments)
+    : segments_(std::move(segments)) {
+    segmentEnds_.reserve(segments_.size());
+
+    double end = 0.0;
+    for (const auto& segment : segments_) {
+        end += segment.duration;
+        segmentEnds_.push_back(end);
+    }
+}
+
+InputScript InputScript::parse(std::istream& input) {
+    std::vector<Segment> segments;
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(input, line)) {
+        lineNumber++;
+
+        if (auto comment = line.find('#'); comment != std::string::npos) {
+            line.erase(comment);
+        }
+
+        std::istringstream tokens(line);
+        std::string durationToken;
+        if (!(tokens >> durationToken)) {
+            continue;  // Blank or comment-only line
+        }
+
+        Segment segment{};
+        try {
+            segment.duration = std::stof(durationToken);
+        } catch (const std::exception&) {
+            throwParseError(lineNumber, "expected a duration, got '" + durationToken + "'");
+        }
+
+        if (!std::isfinite(segment.duration) || segment.duration <= 0.0f) {
+            throwParseError(lineNumber, "duration must be positive");
+        }
+
+        std::string key;
+        while (tokens >> key) {
+            applyKeyToken(key, segment.controls, lineNumber);
+        }
+
+        segments.push_back(segment);
+    }
+
+    return InputScript(std::move(segments));
+}
+
+InputScript InputScript::loadFromFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("InputScript: cannot open '" + path + "'");
+    }
+    return parse(file);
+}
+
+InputScript InputScript::defaultLap() {
+    ControlState straight;
+    straight.forward = true;
+
+    ControlState leftTurn = straight;
+    leftTurn.left = true;
+
+    ControlState drift = leftTurn;
+    drift.drift = true;
+
+    ControlState boost = straight;
+    boost.nitrous = true;
+
+    ControlState brake;
+    brake.backward = true;
+
+    return InputScript({
+        {3.0f, straight},
+        {1.2f, leftTurn},
+        {2.0f, straight},
+        {0.8f, drift},
+        {0.5f, boost},
+        {2.5f, straight},
+        {1.5f, leftTurn},
+        {1.0f, brake},
+        {0.5f, ControlState{}}
+    });
+}
+
+ControlState InputScript::controlsAt(double time) const noexcept {
+    if (segments_.empty()) {
+        return {};
+    }
+
+    const double duration = segmentEnds_.back();
+    time = std::fmod(time, duration);
+    if (time < 0.0) {
+        time += duration;
+    }
+
+    auto it = std::upper_bound(segmentEnds_.begin(), segmentEnds_.end(), time);
+    if (it == segmentEnds_.end()) {
+        return segments_.back().controls;
+    }
+    return segments_[static_cast<size_t>(it - segmentEnds_.begin())].controls;
+}
+
+double InputScript::getDuration() const noexcept {
+    return segmentEnds_.empty() ? 0.0 : segmentEnds_.back();
+}
+
+bool InputScript::empty() const noexcept {
+    return segments_.empty();
+}
+
+const std::vector<InputScript::Segment>& InputScript::getSegments() const noexcept {
+    return segments_;
+}
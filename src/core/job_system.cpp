@@ -0,0 +1,222 @@
+#include "core/job_system.hpp"
+#include "core/profiler.hpp"
+#include <string>
+
+namespace {
+    // Chunks per thread when parallelFor picks the size: enough for stealing to even out
+    // uneven chunks, few enough that queueing stays cheap next to the work
+    constexpr std::size_t CHUNKS_PER_THREAD = 4;
+
+    // Pool and index of the calling thread, set once by each worker
+    thread_local const JobSystem* currentSystem = nullptr;
+    thread_local unsigned int currentThreadIndex = 0;
+
+    // Shared by the jobs of one TaskGraph run
+    struct GraphRun {
+        JobSystem* system;
+        JobSystem::TaskGraph* graph;
+        std::atomic<std::size_t>* pending;
+    };
+}
+
+JobSystem::TaskGraph::TaskId JobSystem::TaskGraph::add(const char* name, std::function<void()> work) {
+    nodes_.push_back({name, std::move(work), {}, 0});
+    return static_cast<TaskId>(nodes_.size() - 1);
+}
+
+void JobSystem::TaskGraph::precede(TaskId before, TaskId after) {
+    nodes_[before].successors.push_back(after);
+    nodes_[after].dependencyCount++;
+}
+
+void JobSystem::TaskGraph::clear() noexcept {
+    nodes_.clear();
+}
+
+JobSystem::JobSystem(unsigned int threadCount) {
+    if (threadCount == 0) {
+        threadCount = (std::max)(1u, std::thread::hardware_concurrency());
+    }
+
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+    workers_.reserve(threadCount - 1);
+    for (unsigned int i = 1; i < threadCount; ++i) {
+        workers_.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        const std::lock_guard<std::mutex> lock(sleepMutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+JobSystem& JobSystem::instance() {
+    static JobSystem system;
+    return system;
+}
+
+unsigned int JobSystem::getCurrentThreadIndex() const noexcept {
+    return currentSystem == this ? currentThreadIndex : 0;
+}
+
+std::size_t JobSystem::defaultChunkSize(std::size_t count) const noexcept {
+    const std::size_t chunks = static_cast<std::size_t>(getThreadCount()) * CHUNKS_PER_THREAD;
+    return (std::max)(std::size_t{1}, (count + chunks - 1) / chunks);
+}
+
+void JobSystem::run(TaskGraph& graph) {
+    const std::size_t nodeCount = graph.nodes_.size();
+    if (nodeCount == 0) {
+        return;
+    }
+    if (graph.remainingSize_ != nodeCount) {
+        graph.remaining_ = std::make_unique<std::atomic<std::uint32_t>[]>(nodeCount);
+        graph.remainingSize_ = nodeCount;
+    }
+
+    std::atomic<std::size_t> pending{nodeCount};
+    GraphRun context{this, &graph, &pending};
+
+    // Reset every counter before the first task can finish and touch a successor's
+    std::vector<Job> roots;
+    for (std::size_t i = 0; i < nodeCount; ++i) {
+        graph.remaining_[i].store(graph.nodes_[i].dependencyCount, std::memory_order_relaxed);
+        if (graph.nodes_[i].dependencyCount == 0) {
+            roots.push_back({graph.nodes_[i].name, &JobSystem::invokeGraphNode, &context, i, i + 1, &pending});
+        }
+    }
+    push(roots.data(), roots.size());
+    wait(pending);
+}
+
+void JobSystem::invokeGraphNode(void* context, std::size_t node, std::size_t) {
+    const auto& run = *static_cast<GraphRun*>(context);
+    TaskGraph& graph = *run.graph;
+    graph.nodes_[node].work();
+
+    // The last predecessor to finish releases a successor; queued before this job counts as
+    // done, so pending can't reach zero while work is left
+    for (const TaskGraph::TaskId successor : graph.nodes_[node].successors) {
+        if (graph.remaining_[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            const Job job{graph.nodes_[successor].name, &JobSystem::invokeGraphNode, context, successor, successor + 1,
+                          run.pending};
+            run.system->push(&job, 1);
+        }
+    }
+}
+
+void JobSystem::setTaskObserver(TaskObserver observer) {
+    observer_ = std::move(observer);
+}
+
+JobSystem::Stats JobSystem::getStats() const noexcept {
+    return {executed_.load(std::memory_order_relaxed), stolen_.load(std::memory_order_relaxed)};
+}
+
+void JobSystem::push(const Job* jobs, std::size_t count) {
+    if (count == 0) {
+        return;
+    }
+    {
+        Queue& queue = *queues_[getCurrentThreadIndex()];
+        const std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.insert(queue.jobs.end(), jobs, jobs + count);
+    }
+    queuedJobs_.fetch_add(count, std::memory_order_release);
+
+    // Taking the lock orders this against a worker checking queuedJobs_ before it sleeps
+    {
+        const std::lock_guard<std::mutex> lock(sleepMutex_);
+    }
+    if (count == 1) {
+        wake_.notify_one();
+    } else {
+        wake_.notify_all();
+    }
+}
+
+bool JobSystem::tryRunOne(unsigned int threadIndex) {
+    Job job{};
+    bool found = false;
+    {
+        // Own deque from the back: the job pushed last is the one most likely still in cache
+        Queue& own = *queues_[threadIndex];
+        const std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty()) {
+            job = own.jobs.back();
+            own.jobs.pop_back();
+            found = true;
+        }
+    }
+    // Others from the front, starting next door so thieves spread out
+    for (std::size_t offset = 1; !found && offset < queues_.size(); ++offset) {
+        Queue& victim = *queues_[(threadIndex + offset) % queues_.size()];
+        const std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            job = victim.jobs.front();
+            victim.jobs.pop_front();
+            found = true;
+            stolen_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    if (!found) {
+        return false;
+    }
+
+    queuedJobs_.fetch_sub(1, std::memory_order_relaxed);
+    execute(job, threadIndex);
+    return true;
+}
+
+void JobSystem::execute(const Job& job, unsigned int threadIndex) {
+    {
+        CARSIM_PROFILE_ZONE(job.name);
+        if (observer_) {
+            const std::int64_t start = Profiler::nowNanoseconds();
+            job.invoke(job.context, job.begin, job.end);
+            observer_({job.name, threadIndex, start, Profiler::nowNanoseconds()});
+        } else {
+            job.invoke(job.context, job.begin, job.end);
+        }
+    }
+    executed_.fetch_add(1, std::memory_order_relaxed);
+
+    // Last touch of the job: the waiter may return and free everything it points to
+    job.pending->fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void JobSystem::wait(const std::atomic<std::size_t>& pending) {
+    const unsigned int threadIndex = getCurrentThreadIndex();
+    while (pending.load(std::memory_order_acquire) != 0) {
+        if (!tryRunOne(threadIndex)) {
+            // The rest is running elsewhere
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::workerLoop(unsigned int threadIndex) {
+    currentSystem = this;
+    currentThreadIndex = threadIndex;
+    CARSIM_PROFILE_THREAD("Job worker " + std::to_string(threadIndex));
+
+    while (true) {
+        if (tryRunOne(threadIndex)) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        wake_.wait(lock, [this] { return stopping_ || queuedJobs_.load(std::memory_order_acquire) > 0; });
+        if (stopping_ && queuedJobs_.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
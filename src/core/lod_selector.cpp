@@ -0,0 +1,43 @@
+#include "core/lod_selector.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace {
+    constexpr std::size_t MAX_LEVELS = 254;  // Levels are stored as bytes, one value is "culled"
+    constexpr float MAX_HYSTERESIS = 0.5f;
+}
+
+LodSelector::LodSelector(std::vector<float> switchDistances, float hysteresis)
+    : switchDistances_(std::move(switchDistances)),
+      hysteresis_(std::clamp(hysteresis, 0.0f, MAX_HYSTERESIS)) {
+    if (switchDistances_.size() > MAX_LEVELS) {
+        switchDistances_.resize(MAX_LEVELS);
+    }
+    std::sort(switchDistances_.begin(), switchDistances_.end());
+}
+
+std::uint8_t LodSelector::levelAt(float distance, float distanceScale) const noexcept {
+    std::uint8_t level = 0;
+    while (level < switchDistances_.size() && distance >= switchDistances_[level] * distanceScale) {
+        ++level;
+    }
+    return level;
+}
+
+std::uint8_t LodSelector::select(std::uint8_t current, float distance) const noexcept {
+    // Coarser once past the widened boundaries, finer once inside the narrowed ones
+    const std::uint8_t outward = levelAt(distance, 1.0f + hysteresis_);
+    const std::uint8_t inward = levelAt(distance, 1.0f - hysteresis_);
+
+    if (current < outward) {
+        return outward;
+    }
+    if (current > inward) {
+        return inward;
+    }
+    return current;
+}
+
+float LodSelector::getMaxDistance() const noexcept {
+    return switchDistances_.empty() ? 0.0f : switchDistances_.back() * (1.0f + hysteresis_);
+}
@@ -0,0 +1,186 @@
+#include "core/logger.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <iostream>
+
+namespace {
+    constexpr std::chrono::milliseconds DRAIN_INTERVAL(2);  // Drain thread sleep while the ring is empty
+    constexpr std::chrono::microseconds FLUSH_POLL_INTERVAL(100);
+    constexpr std::string_view TRUNCATION_MARK = "...";
+}
+
+namespace Logger {
+
+std::string_view toString(Level level) noexcept {
+    switch (level) {
+        case Level::DEBUG: return "DEBUG";
+        case Level::INFO: return "INFO";
+        case Level::WARNING: return "WARNING";
+        case Level::ERROR: return "ERROR";
+    }
+    return "";
+}
+
+std::string_view toString(Tag tag) noexcept {
+    switch (tag) {
+        case Tag::GENERAL: return "general";
+        case Tag::CORE: return "core";
+        case Tag::PHYSICS: return "physics";
+        case Tag::COLLISION: return "collision";
+        case Tag::LOADERS: return "loaders";
+        case Tag::GRAPHICS: return "graphics";
+        case Tag::AUDIO: return "audio";
+        case Tag::INPUT: return "input";
+        case Tag::UI: return "ui";
+    }
+    return "";
+}
+
+std::string format(const Record& record) {
+    std::string line;
+    line.reserve(record.length + 24);
+    line += '[';
+    line += toString(record.level);
+    line += "] ";
+    if (record.tag != Tag::GENERAL) {
+        line += '[';
+        line += toString(record.tag);
+        line += "] ";
+    }
+    line += record.message();
+    return line;
+}
+
+void MessageBuilder::appendText(std::string_view text) noexcept {
+    const std::size_t available = Record::TEXT_CAPACITY - record_.length;
+    if (text.size() <= available) {
+        std::copy(text.begin(), text.end(), record_.text.begin() + record_.length);
+        record_.length = static_cast<std::uint16_t>(record_.length + text.size());
+        return;
+    }
+
+    // Fill up, then overwrite the tail with the mark (later appends find no room and stop)
+    std::copy_n(text.begin(), available, record_.text.begin() + record_.length);
+    std::copy(TRUNCATION_MARK.begin(), TRUNCATION_MARK.end(), record_.text.end() - TRUNCATION_MARK.size());
+    record_.length = static_cast<std::uint16_t>(Record::TEXT_CAPACITY);
+}
+
+AsyncWriter::AsyncWriter(WriteFunction write, FlushFunction flush, std::size_t capacity)
+    : write_(std::move(write)),
+      flush_(std::move(flush)),
+      mask_(std::bit_ceil((std::max)(capacity, std::size_t{2})) - 1),
+      slots_(std::make_unique<Slot[]>(mask_ + 1)) {
+    // A slot is free for the producer at position p while its sequence equals p
+    for (std::size_t i = 0; i <= mask_; ++i) {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    thread_ = std::thread(&AsyncWriter::run, this);
+}
+
+AsyncWriter::~AsyncWriter() {
+    running_.store(false, std::memory_order_release);
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+AsyncWriter& AsyncWriter::instance() {
+    static AsyncWriter writer(
+        [](const Record& record) {
+            // Errors go to stderr, which is unbuffered anyway
+            std::ostream& out = record.level == Level::ERROR ? std::cerr : std::cout;
+            out << format(record) << '\n';
+        },
+        [] { std::cout.flush(); });
+    return writer;
+}
+
+AsyncWriter::Slot* AsyncWriter::claim() noexcept {
+    std::uint64_t position = writePosition_.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot& slot = slots_[position & mask_];
+        const std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence == position) {
+            if (writePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                return &slot;
+            }
+        } else if (sequence < position) {
+            // The consumer hasn't freed this slot from the previous lap: full
+            return nullptr;
+        } else {
+            position = writePosition_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void AsyncWriter::publish(Slot& slot) noexcept {
+    // Claimed at sequence p; p + 1 tells the consumer the record is complete
+    slot.sequence.store(slot.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+std::size_t AsyncWriter::drain() {
+    std::uint64_t position = readPosition_.load(std::memory_order_relaxed);
+    std::size_t count = 0;
+    for (;;) {
+        Slot& slot = slots_[position & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+            break;
+        }
+        write_(slot.record);
+        // Free the slot for the producer one lap ahead
+        slot.sequence.store(position + mask_ + 1, std::memory_order_release);
+        ++position;
+        ++count;
+    }
+    readPosition_.store(position, std::memory_order_release);
+    return count;
+}
+
+void AsyncWriter::reportDropped() {
+    const std::uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+    if (dropped == reportedDropped_) {
+        return;
+    }
+
+    Record record;
+    record.level = Level::WARNING;
+    MessageBuilder builder(record);
+    builder.append(dropped - reportedDropped_);
+    builder.append(" log messages dropped, the queue was full");
+    write_(record);
+    reportedDropped_ = dropped;
+}
+
+void AsyncWriter::run() {
+    bool unflushed = false;
+    for (;;) {
+        // Read the flag first so the final pass sees everything written before shutdown
+        const bool running = running_.load(std::memory_order_acquire);
+        if (drain() > 0) {
+            unflushed = true;
+            continue;
+        }
+
+        reportDropped();
+        if (unflushed && flush_) {
+            flush_();
+        }
+        unflushed = false;
+        flushedPosition_.store(readPosition_.load(std::memory_order_relaxed), std::memory_order_release);
+
+        if (!running) {
+            break;
+        }
+        std::this_thread::sleep_for(DRAIN_INTERVAL);
+    }
+}
+
+void AsyncWriter::flush() {
+    const std::uint64_t target = writePosition_.load(std::memory_order_acquire);
+    while (flushedPosition_.load(std::memory_order_acquire) < target && running_.load(std::memory_order_acquire)) {
+        std::this_thread::sleep_for(FLUSH_POLL_INTERVAL);
+    }
+}
+
+}
@@ -15,6 +15,7 @@ Obstacle::Obstacle(float x, float y, float z, ObstacleType type, WallOrientation
     } else if (type_ == ObstacleType::TREE) {
         size_ = {ObjectSizes::TREE_COLLISION_RADIUS * 2.0f, ObjectSizes::TREE_HEIGHT, ObjectSizes::TREE_COLLISION_RADIUS * 2.0f};
     }
+    updateCollisionRadius();
 }
 
 ObstacleType Obstacle::getType() const noexcept {
@@ -1,19 +1,72 @@
 #include "core/obstacle_manager.hpp"
 #include "core/game_config.hpp"
-#include "core/random_position_generator.hpp"
+#include "core/job_system.hpp"
+#include "core/logger.hpp"
+#include "core/poisson_disk_sampler.hpp"
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <iterator>
+#include <limits>
+#include <string>
 
+namespace {
+    constexpr std::uint32_t NO_HIT = (std::numeric_limits<std::uint32_t>::max)();
 
-ObstacleManager::ObstacleManager(float playAreaSize, int treeCount) {
+    // Below this the step is treated as standing still and only the contacts are solved
+    constexpr float MIN_SWEEP_DISTANCE = 1e-4f;
+
+    // Wall segments whose ends are this close count as one straight wall
+    constexpr float WALL_JOIN_TOLERANCE = 0.01f;
+
+    // Circle centres closer than this have no usable direction between them
+    constexpr float MIN_CENTRE_DISTANCE = 0.001f;
+
+    // First time in [0, 1] at which |offset + t * move| = radiusSum, negative when the circles
+    // already touch at t = 0, NO_IMPACT when they never do
+    float sweptCircleTime(float offsetX, float offsetZ, float moveX, float moveZ, float moveLengthSquared,
+                          float radiusSum) noexcept {
+        const float c = offsetX * offsetX + offsetZ * offsetZ - radiusSum * radiusSum;
+        if (c <= 0.0f) {
+            return -1.0f;
+        }
+        const float b = offsetX * moveX + offsetZ * moveZ;
+        if (b >= 0.0f || moveLengthSquared <= 0.0f) {
+            return BoxCollisionBatch::NO_IMPACT;  // Moving away or standing still
+        }
+        const float discriminant = b * b - moveLengthSquared * c;
+        if (discriminant < 0.0f) {
+            return BoxCollisionBatch::NO_IMPACT;  // Passes by
+        }
+        const float time = (-b - std::sqrt(discriminant)) / moveLengthSquared;
+        return time <= 1.0f ? time : BoxCollisionBatch::NO_IMPACT;
+    }
+}
+
+ObstacleManager::ObstacleManager(float playAreaSize, int treeCount, std::uint32_t seed) {
     const int segmentsPerSide = static_cast<int>(playAreaSize / GameConfig::Obstacle::WALL_SEGMENT_LENGTH);
     obstacles_.reserve(segmentsPerSide * 4 + treeCount);
 
-    generateWalls(playAreaSize);
-    generateTrees(treeCount, playAreaSize);
+    // Walls and trees don't depend on each other, nor do the two indices built from both
+    std::vector<std::unique_ptr<Obstacle>> trees;
+    JobSystem::TaskGraph graph;
+    const auto walls = graph.add("Generate walls", [&] { generateWalls(playAreaSize); });
+    const auto sampleTrees = graph.add("Generate trees", [&] { trees = generateTrees(treeCount, playAreaSize, seed); });
+    const auto merge = graph.add("Merge obstacles", [&] {
+        std::move(trees.begin(), trees.end(), std::back_inserter(obstacles_));
+    });
+    const auto grid = graph.add("Build obstacle grid", [this] { buildGrid(); });
+    const auto wallRuns = graph.add("Build wall runs", [this] { buildWallRuns(); });
+    graph.precede(walls, merge);
+    graph.precede(sampleTrees, merge);
+    graph.precede(merge, grid);
+    graph.precede(merge, wallRuns);
+    JobSystem::instance().run(graph);
 }
 
 void ObstacleManager::update(float deltaTime) {
-    // Nothing to do - obstacles don't move
+    // Obstacles don't move; the step is only kept for the contact solver
+    stepTime_ = deltaTime;
 }
 
 void ObstacleManager::generateWalls(float playAreaSize) {
@@ -31,75 +84,260 @@ void ObstacleManager::generateWalls(float playAreaSize) {
     }
 }
 
-void ObstacleManager::generateTrees(int count, float playAreaSize) {
-    RandomPositionGenerator posGen(playAreaSize, GameConfig::Obstacle::MIN_TREE_DISTANCE_FROM_WALL);
+std::vector<std::unique_ptr<Obstacle>> ObstacleManager::generateTrees(int count, float playAreaSize, std::uint32_t seed) const {
+    PoissonDiskSampler sampler(playAreaSize, GameConfig::Obstacle::MIN_TREE_DISTANCE_FROM_WALL,
+                               GameConfig::Obstacle::MIN_DISTANCE_BETWEEN_TREES, seed);
+    // Don't spawn too close to the center (player spawn)
+    sampler.setExclusionRadius(GameConfig::Obstacle::MIN_TREE_DISTANCE_FROM_CENTER);
+
+    const auto treePositions = sampler.generate(static_cast<std::size_t>((std::max)(count, 0)));
+    if (treePositions.size() < static_cast<std::size_t>((std::max)(count, 0))) {
+        Logger::warning(Logger::Tag::CORE, "Play area only fits ", treePositions.size(), " of ", count,
+                        " trees at the minimum spacing");
+    }
+
+    std::vector<std::unique_ptr<Obstacle>> trees;
+    trees.reserve(treePositions.size());
+    for (const auto& pos : treePositions) {
+        trees.push_back(std::make_unique<Obstacle>(
+            pos[0],
+            GameConfig::Obstacle::TREE_HEIGHT,
+            pos[1],
+            ObstacleType::TREE
+        ));
+    }
+    return trees;
+}
+
+void ObstacleManager::buildGrid() {
+    std::vector<SpatialGrid::Entry> entries;
+    entries.reserve(obstacles_.size());
+    for (std::size_t i = 0; i < obstacles_.size(); ++i) {
+        const auto& position = obstacles_[i]->getPosition();
+        entries.push_back({position[0], position[2], obstacles_[i]->getCollisionRadius(), static_cast<std::uint32_t>(i)});
+    }
+    grid_.build(entries);
+}
 
-    std::vector<std::array<float, 2>> treePositions;
+void ObstacleManager::buildWallRuns() {
+    // Wall segments lined up end to end along one side, sorted so each run is contiguous
+    std::vector<std::uint32_t> walls;
+    for (std::uint32_t i = 0; i < obstacles_.size(); ++i) {
+        if (obstacles_[i]->getType() == ObstacleType::WALL) {
+            walls.push_back(i);
+        }
+    }
+    const auto line = [this](std::uint32_t index) {
+        const Obstacle& wall = *obstacles_[index];
+        const bool horizontal = wall.getOrientation() == WallOrientation::HORIZONTAL;
+        const auto& position = wall.getPosition();
+        return std::array<float, 2>{horizontal ? position[2] : position[0], horizontal ? position[0] : position[2]};
+    };
+    std::sort(walls.begin(), walls.end(), [&](std::uint32_t a, std::uint32_t b) {
+        const auto orientationA = obstacles_[a]->getOrientation();
+        const auto orientationB = obstacles_[b]->getOrientation();
+        return orientationA != orientationB ? orientationA < orientationB : line(a) < line(b);
+    });
 
-    int treesPlaced = 0;
-    int totalAttempts = 0;
-    const int maxTotalAttempts = count * 20;
+    wallRuns_.clear();
+    wallRunOf_.assign(obstacles_.size(), 0);
+    float runStart = 0.0f;
+    float runEnd = 0.0f;
+    for (std::size_t i = 0; i < walls.size(); ++i) {
+        const Obstacle& wall = *obstacles_[walls[i]];
+        OrientedBox box = OrientedBox::of(wall);
+        const bool horizontal = wall.getOrientation() == WallOrientation::HORIZONTAL;
+        const float halfLength = horizontal ? box.halfExtentX : box.halfExtentZ;
+        const auto [across, along] = line(walls[i]);
 
-    while (treesPlaced < count && totalAttempts < maxTotalAttempts) {
-        totalAttempts++;
+        const bool continues = i > 0 && wall.getOrientation() == obstacles_[walls[i - 1]]->getOrientation() &&
+                               across == line(walls[i - 1])[0] && along - halfLength <= runEnd + WALL_JOIN_TOLERANCE;
+        if (continues) {
+            runEnd = (std::max)(runEnd, along + halfLength);
+        } else {
+            wallRuns_.push_back({box, walls[i]});
+            runStart = along - halfLength;
+            runEnd = along + halfLength;
+        }
+        WallRun& run = wallRuns_.back();
+        run.firstIndex = (std::min)(run.firstIndex, walls[i]);
 
-        auto pos = posGen.getRandomPosition();
+        // Stretch the run's box over everything joined so far
+        const float centre = (runStart + runEnd) / 2.0f;
+        const float extent = (runEnd - runStart) / 2.0f;
+        (horizontal ? run.box.centerX : run.box.centerZ) = centre;
+        (horizontal ? run.box.halfExtentX : run.box.halfExtentZ) = extent;
+        wallRunOf_[walls[i]] = static_cast<std::uint32_t>(wallRuns_.size() - 1);
+    }
+}
 
-        // Don't spawn too close to the center (player spawn)
-        float distanceFromCenter = std::sqrt(pos[0] * pos[0] + pos[1] * pos[1]);
-        if (distanceFromCenter < GameConfig::Obstacle::MIN_TREE_DISTANCE_FROM_CENTER) {
-            continue;
+void ObstacleManager::queryBox(float minX, float minZ, float maxX, float maxZ, std::vector<std::uint32_t>& indices) const {
+    indices.clear();
+    grid_.forEachCandidate(minX, minZ, maxX, maxZ, [&](const SpatialGrid::Entry& entry) {
+        // Closest point of the box to the circle centre
+        const float dx = entry.x - std::clamp(entry.x, minX, maxX);
+        const float dz = entry.z - std::clamp(entry.z, minZ, maxZ);
+        if (dx * dx + dz * dz <= entry.radius * entry.radius) {
+            indices.push_back(entry.index);
         }
+    });
 
-        // Make sure there's space between trees
-        bool validPosition = true;
-        for (const auto& existingPos : treePositions) {
-            float dx = pos[0] - existingPos[0];
-            float dz = pos[1] - existingPos[1];
-            float distance = std::sqrt(dx * dx + dz * dz);
+    // Circles spanning several cells are listed once per cell
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+}
 
-            if (distance < GameConfig::Obstacle::MIN_DISTANCE_BETWEEN_TREES) {
-                validPosition = false;
-                break;
-            }
+void ObstacleManager::handleCollisions(Vehicle& vehicle) {
+    handleCollisions(vehicle, stepTime_, contactSolver_, scratch_);
+}
+
+void ObstacleManager::handleCollisions(Vehicle& vehicle, float deltaTime, ContactSolver& contactSolver,
+                                       CollisionScratch& scratch) const {
+    sweep(vehicle, scratch);
+
+    findContacts(vehicle, scratch.contacts, scratch);
+    if (contactSolver.solve(vehicle, scratch.contacts, deltaTime)) {
+        CARSIM_LOG_DEBUG(Logger::Tag::COLLISION, "Vehicle resolved ", scratch.contacts.size(), " contacts, now at (",
+                      vehicle.getPosition()[0], ", ", vehicle.getPosition()[2], ") at ", vehicle.getVelocity(), " m/s");
+    }
+}
+
+void ObstacleManager::sweep(Vehicle& vehicle, CollisionScratch& scratch) const {
+    const auto& start = vehicle.getPreviousPosition();
+    const auto& end = vehicle.getPosition();
+    const float moveX = end[0] - start[0];
+    const float moveZ = end[2] - start[2];
+    const float moveLengthSquared = moveX * moveX + moveZ * moveZ;
+    if (moveLengthSquared < MIN_SWEEP_DISTANCE * MIN_SWEEP_DISTANCE) {
+        return;
+    }
+    const float vehicleRadius = vehicle.getCollisionRadius();
+
+    // Everything near the path of this step
+    queryBox((std::min)(start[0], end[0]) - vehicleRadius, (std::min)(start[2], end[2]) - vehicleRadius,
+             (std::max)(start[0], end[0]) + vehicleRadius, (std::max)(start[2], end[2]) + vehicleRadius,
+             scratch.candidates);
+
+    // Walls are exact boxes, tested against the vehicle's box in one batch
+    gatherWallRuns(scratch);
+    OrientedBox vehicleBox = OrientedBox::of(vehicle);
+    vehicleBox.centerX = start[0];
+    vehicleBox.centerZ = start[2];
+    scratch.wallBatch.sweep(vehicleBox, moveX, moveZ);
+
+    // Earliest contact along the step, ties to the lowest index. Obstacles already touched
+    // at the start are left to the contact solver.
+    std::uint32_t hit = NO_HIT;
+    float hitTime = 1.0f;
+    const auto consider = [&](std::uint32_t index, float time) {
+        if (time >= 0.0f && (time < hitTime || (time == hitTime && index < hit))) {
+            hit = index;
+            hitTime = time;
+        }
+    };
+    for (std::size_t lane = 0; lane < scratch.runCandidates.size(); ++lane) {
+        consider(wallRuns_[scratch.runCandidates[lane]].firstIndex, scratch.wallBatch.getTimeOfImpact(lane));
+    }
+    for (const std::uint32_t index : scratch.candidates) {
+        const Obstacle& obstacle = *obstacles_[index];
+        if (obstacle.getType() != ObstacleType::WALL) {
+            // Trees stay circles
+            const auto& position = obstacle.getPosition();
+            consider(index, sweptCircleTime(start[0] - position[0], start[2] - position[2], moveX, moveZ,
+                                            moveLengthSquared, vehicleRadius + obstacle.getCollisionRadius()));
         }
+    }
+    if (hit == NO_HIT) {
+        return;
+    }
+
+    // A fast vehicle can cross a whole obstacle in one step: stop just short of the contact
+    // and let the solver deal with the velocity
+    const float stopTime = (std::max)(0.0f, hitTime - GameConfig::Collision::CONTACT_SKIN / std::sqrt(moveLengthSquared));
+    vehicle.setPosition(start[0] + moveX * stopTime, end[1], start[2] + moveZ * stopTime);
+    CARSIM_LOG_DEBUG(Logger::Tag::COLLISION, "Vehicle swept into obstacle ", hit, " at (", vehicle.getPosition()[0], ", ",
+                  vehicle.getPosition()[2], "), time of impact ", hitTime);
+}
+
+void ObstacleManager::findContacts(const Vehicle& vehicle, std::vector<Contact>& contacts) {
+    findContacts(vehicle, contacts, scratch_);
+}
+
+void ObstacleManager::findContacts(const Vehicle& vehicle, std::vector<Contact>& contacts, CollisionScratch& scratch) const {
+    contacts.clear();
+    const auto& position = vehicle.getPosition();
+    const float reach = vehicle.getCollisionRadius() + GameConfig::Collision::CONTACT_MARGIN;
+    queryBox(position[0] - reach, position[2] - reach, position[0] + reach, position[2] + reach, scratch.candidates);
 
-        if (validPosition) {
-            obstacles_.push_back(std::make_unique<Obstacle>(
-                pos[0],
-                GameConfig::Obstacle::TREE_HEIGHT,
-                pos[1],
-                ObstacleType::TREE
-            ));
-            treePositions.push_back(pos);
-            treesPlaced++;
+    gatherWallRuns(scratch);
+    scratch.wallBatch.sweep(OrientedBox::of(vehicle), 0.0f, 0.0f);
+
+    for (std::size_t lane = 0; lane < scratch.runCandidates.size(); ++lane) {
+        const Contact contact{wallRuns_[scratch.runCandidates[lane]].firstIndex, scratch.wallBatch.getNormalX(lane),
+                              scratch.wallBatch.getNormalZ(lane), scratch.wallBatch.getPenetration(lane)};
+        if (contact.penetration > -GameConfig::Collision::CONTACT_MARGIN) {
+            contacts.push_back(contact);
+        }
+    }
+    for (const std::uint32_t index : scratch.candidates) {
+        if (obstacles_[index]->getType() != ObstacleType::WALL) {
+            const Contact contact = circleContact(vehicle, index);
+            if (contact.penetration > -GameConfig::Collision::CONTACT_MARGIN) {
+                contacts.push_back(contact);
+            }
         }
     }
+
+    std::sort(contacts.begin(), contacts.end(),
+              [](const Contact& a, const Contact& b) { return a.obstacle < b.obstacle; });
 }
 
-void ObstacleManager::handleCollisions(Vehicle& vehicle) {
-    for (const auto& obstacle : obstacles_) {
-        float overlapDistance, normalX, normalZ;
-
-        if (vehicle.checkCircleCollision(*obstacle, overlapDistance, normalX, normalZ)) {
-            // Push the vehicle out
-            const auto& vehiclePos = vehicle.getPosition();
-            vehicle.setPosition(
-                vehiclePos[0] - normalX * overlapDistance,
-                vehiclePos[1],
-                vehiclePos[2] - normalZ * overlapDistance
-            );
-
-            vehicle.setVelocity(0.0f);
-
-            // Only handle one collision per frame to avoid weird jitter
-            break;
+bool ObstacleManager::findContact(const Vehicle& vehicle, std::uint32_t index, Contact& contact) const {
+    if (obstacles_[index]->getType() == ObstacleType::WALL) {
+        const WallRun& run = wallRuns_[wallRunOf_[index]];
+        BoxCollisionBatch wall(SimdLevel::SCALAR);
+        wall.add(run.box);
+        wall.sweep(OrientedBox::of(vehicle), 0.0f, 0.0f);
+        contact = {run.firstIndex, wall.getNormalX(0), wall.getNormalZ(0), wall.getPenetration(0)};
+    } else {
+        contact = circleContact(vehicle, index);
+    }
+    return contact.penetration > -GameConfig::Collision::CONTACT_MARGIN;
+}
+
+void ObstacleManager::gatherWallRuns(CollisionScratch& scratch) const {
+    scratch.runCandidates.clear();
+    scratch.wallBatch.clear();
+    for (const std::uint32_t index : scratch.candidates) {
+        if (obstacles_[index]->getType() != ObstacleType::WALL) {
+            continue;
         }
+        const std::uint32_t run = wallRunOf_[index];
+        if (std::find(scratch.runCandidates.begin(), scratch.runCandidates.end(), run) == scratch.runCandidates.end()) {
+            scratch.runCandidates.push_back(run);
+            scratch.wallBatch.add(wallRuns_[run].box);
+        }
+    }
+}
+
+Contact ObstacleManager::circleContact(const Vehicle& vehicle, std::uint32_t index) const {
+    const auto& vehiclePos = vehicle.getPosition();
+    const auto& obstaclePos = obstacles_[index]->getPosition();
+    const float offsetX = vehiclePos[0] - obstaclePos[0];
+    const float offsetZ = vehiclePos[2] - obstaclePos[2];
+    const float distance = std::sqrt(offsetX * offsetX + offsetZ * offsetZ);
+    const float penetration = vehicle.getCollisionRadius() + obstacles_[index]->getCollisionRadius() - distance;
+
+    // Same fallback as GameObject::checkCircleCollision for overlapping centres
+    if (distance <= MIN_CENTRE_DISTANCE) {
+        return {index, -1.0f, 0.0f, penetration};
     }
+    return {index, offsetX / distance, offsetZ / distance, penetration};
 }
 
 void ObstacleManager::reset() noexcept {
-    // Static obstacles maintain their state
+    // Static obstacles maintain their state; only the contacts of the old run are forgotten
+    contactSolver_.clear();
 }
 
 const std::vector<std::unique_ptr<Obstacle>>& ObstacleManager::getObstacles() const noexcept {
@@ -0,0 +1,167 @@
+#include "core/poisson_disk_sampler.hpp"
+#include "core/job_system.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace {
+    // Candidates tried around an active point before it is retired (Bridson uses 30)
+    constexpr int CANDIDATES_PER_POINT = 30;
+    constexpr int SEED_ATTEMPTS = 1000;
+    constexpr float TWO_PI = 6.28318530718f;
+    constexpr float SQRT_TWO = 1.41421356237f;
+    constexpr std::int32_t EMPTY_CELL = -1;
+}
+
+PoissonDiskSampler::PoissonDiskSampler(float playAreaSize, float margin, float minDistance, std::uint32_t seed)
+    : seed_(seed),
+      minPos_(-(playAreaSize / 2.0f) + margin),
+      maxPos_((playAreaSize / 2.0f) - margin),
+      minDistance_(minDistance),
+      exclusionRadius_(0.0f) {
+}
+
+bool PoissonDiskSampler::isInRegion(const Region& region, float x, float z) const noexcept {
+    return x >= region.minX && x <= region.maxX && z >= region.minZ && z <= region.maxZ &&
+           x * x + z * z >= exclusionRadius_ * exclusionRadius_;
+}
+
+std::vector<std::array<float, 2>> PoissonDiskSampler::generate(std::size_t count, unsigned int threadCount) const {
+    std::vector<std::array<float, 2>> points = generateAll(threadCount);
+
+    // Any subset keeps the spacing; a random one (partial Fisher-Yates) stays spread over the whole area
+    if (points.size() > count) {
+        CounterRng random(seed_, RandomStream::TREE_SELECTION);
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::size_t pick = i + random.below(static_cast<std::uint32_t>(points.size() - i));
+            std::swap(points[i], points[pick]);
+        }
+        points.resize(count);
+    }
+    return points;
+}
+
+std::vector<std::array<float, 2>> PoissonDiskSampler::generateAll(unsigned int threadCount) const {
+    if (maxPos_ <= minPos_ || minDistance_ <= 0.0f) {
+        return {};
+    }
+
+    // Equal chunks no larger than CHUNK_SIZE; inner edges pulled in by half the spacing
+    const float extent = maxPos_ - minPos_;
+    const int chunksPerAxis = (std::max)(1, static_cast<int>(std::ceil(extent / CHUNK_SIZE)));
+    const float chunkSize = extent / static_cast<float>(chunksPerAxis);
+    const float gap = minDistance_ / 2.0f;
+
+    std::vector<Region> regions;
+    regions.reserve(static_cast<std::size_t>(chunksPerAxis) * chunksPerAxis);
+    for (int row = 0; row < chunksPerAxis; ++row) {
+        for (int column = 0; column < chunksPerAxis; ++column) {
+            regions.push_back({
+                column == 0 ? minPos_ : minPos_ + chunkSize * static_cast<float>(column) + gap,
+                row == 0 ? minPos_ : minPos_ + chunkSize * static_cast<float>(row) + gap,
+                column == chunksPerAxis - 1 ? maxPos_ : minPos_ + chunkSize * static_cast<float>(column + 1) - gap,
+                row == chunksPerAxis - 1 ? maxPos_ : minPos_ + chunkSize * static_cast<float>(row + 1) - gap
+            });
+        }
+    }
+
+    // Chunks run in any order on the JobSystem; each chunk's points depend only on its own stream
+    std::vector<std::vector<std::array<float, 2>>> chunkPoints(regions.size());
+    const std::size_t chunksPerJob = threadCount == 0 ? 0 : (regions.size() + threadCount - 1) / threadCount;
+    JobSystem::instance().parallelFor("Sample tree chunks", regions.size(), chunksPerJob,
+                                      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t chunk = begin; chunk < end; ++chunk) {
+            chunkPoints[chunk] = sampleRegion(regions[chunk],
+                                              CounterRng(seed_, RandomStream::TREES, static_cast<std::uint32_t>(chunk)));
+        }
+    });
+
+    std::vector<std::array<float, 2>> points;
+    for (const auto& chunk : chunkPoints) {
+        points.insert(points.end(), chunk.begin(), chunk.end());
+    }
+    return points;
+}
+
+std::vector<std::array<float, 2>> PoissonDiskSampler::sampleRegion(const Region& region, CounterRng random) const {
+    std::vector<std::array<float, 2>> points;
+    if (region.maxX <= region.minX || region.maxZ <= region.minZ) {
+        return points;
+    }
+
+    // Cell diagonal equals minDistance, so a cell holds at most one point
+    const float cellSize = minDistance_ / SQRT_TWO;
+    const int columns = static_cast<int>(std::ceil((region.maxX - region.minX) / cellSize)) + 1;
+    const int rows = static_cast<int>(std::ceil((region.maxZ - region.minZ) / cellSize)) + 1;
+    std::vector<std::int32_t> grid(static_cast<std::size_t>(columns) * rows, EMPTY_CELL);
+
+    const auto columnOf = [&](float x) {
+        return (std::min)(static_cast<int>((x - region.minX) / cellSize), columns - 1);
+    };
+    const auto rowOf = [&](float z) {
+        return (std::min)(static_cast<int>((z - region.minZ) / cellSize), rows - 1);
+    };
+
+    const float minDistanceSquared = minDistance_ * minDistance_;
+    const auto isFarEnough = [&](float x, float z) {
+        const int column = columnOf(x);
+        const int row = rowOf(z);
+        for (int r = (std::max)(row - 2, 0); r <= (std::min)(row + 2, rows - 1); ++r) {
+            for (int c = (std::max)(column - 2, 0); c <= (std::min)(column + 2, columns - 1); ++c) {
+                const std::int32_t index = grid[static_cast<std::size_t>(r) * columns + c];
+                if (index == EMPTY_CELL) {
+                    continue;
+                }
+                const float dx = points[index][0] - x;
+                const float dz = points[index][1] - z;
+                if (dx * dx + dz * dz < minDistanceSquared) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    std::vector<std::int32_t> active;
+    const auto addPoint = [&](float x, float z) {
+        const auto index = static_cast<std::int32_t>(points.size());
+        points.push_back({x, z});
+        grid[static_cast<std::size_t>(rowOf(z)) * columns + columnOf(x)] = index;
+        active.push_back(index);
+    };
+
+    for (int attempt = 0; attempt < SEED_ATTEMPTS && points.empty(); ++attempt) {
+        const float x = random.uniform(region.minX, region.maxX);
+        const float z = random.uniform(region.minZ, region.maxZ);
+        if (isInRegion(region, x, z)) {
+            addPoint(x, z);
+        }
+    }
+
+    while (!active.empty()) {
+        const std::size_t slot = random.below(static_cast<std::uint32_t>(active.size()));
+        const std::array<float, 2> origin = points[active[slot]];
+
+        bool placed = false;
+        for (int candidate = 0; candidate < CANDIDATES_PER_POINT; ++candidate) {
+            // Uniform by area over the annulus [minDistance, 2 * minDistance]
+            const float radius = minDistance_ * std::sqrt(1.0f + 3.0f * random.uniform());
+            const float angle = TWO_PI * random.uniform();
+            const float x = origin[0] + radius * std::cos(angle);
+            const float z = origin[1] + radius * std::sin(angle);
+
+            if (isInRegion(region, x, z) && isFarEnough(x, z)) {
+                addPoint(x, z);
+                placed = true;
+                break;
+            }
+        }
+
+        if (!placed) {
+            active[slot] = active.back();
+            active.pop_back();
+        }
+    }
+
+    return points;
+}
@@ -7,6 +7,7 @@ Powerup::Powerup(float x, float y, float z, PowerupType type)
     size_[0] = ObjectSizes::POWERUP_SIZE;
     size_[1] = ObjectSizes::POWERUP_SIZE;
     size_[2] = ObjectSizes::POWERUP_SIZE;
+    updateCollisionRadius();
 }
 
 void Powerup::update(float deltaTime) {
@@ -1,19 +1,22 @@
 #include "core/powerup_manager.hpp"
 #include "core/game_config.hpp"
+#include "core/logger.hpp"
 #include "core/random_position_generator.hpp"
 
 
-PowerupManager::PowerupManager(int count, float playAreaSize) {
-    generatePowerups(count, playAreaSize);
+PowerupManager::PowerupManager(int count, float playAreaSize, std::uint32_t seed) {
+    generatePowerups(count, playAreaSize, seed);
 }
 
-void PowerupManager::generatePowerups(int count, float playAreaSize) {
+void PowerupManager::generatePowerups(int count, float playAreaSize, std::uint32_t seed) {
     powerups_.clear();
 
-    RandomPositionGenerator posGen(playAreaSize, GameConfig::Powerup::SPAWN_MARGIN);
+    RandomPositionGenerator posGen(playAreaSize, GameConfig::Powerup::SPAWN_MARGIN, CounterRng(seed, RandomStream::POWERUPS));
 
+    std::vector<std::array<float, 2>> positions;
     for (int i = 0; i < count; ++i) {
-        auto pos = posGen.getRandomPosition();
+        auto pos = posGen.getRandomPositionWithMinDistance(positions, GameConfig::Powerup::MIN_SPACING);
+        positions.push_back(pos);
         auto powerup = std::make_unique<Powerup>(pos[0], GameConfig::Powerup::HEIGHT, pos[1], PowerupType::NITROUS);
         powerups_.push_back(std::move(powerup));
     }
@@ -24,21 +27,32 @@ void PowerupManager::update(float deltaTime) {
 }
 
 void PowerupManager::handleCollisions(Vehicle& vehicle) {
-    for (auto& powerup : powerups_) {
+    for (std::size_t i = 0; i < powerups_.size(); ++i) {
+        const Powerup& powerup = *powerups_[i];
         // Can only collect if: active, don't have nitrous, not using nitrous, and touching it
-        if (powerup->isActive() &&
+        if (powerup.isActive() &&
             !vehicle.hasNitrous() &&
             !vehicle.isNitrousActive() &&
-            vehicle.intersects(*powerup)) {
+            vehicle.intersects(powerup)) {
             vehicle.pickupNitrous();
-            powerup->setActive(false);
+            setActive(i, false);
+            CARSIM_LOG_DEBUG(Logger::Tag::COLLISION, "Vehicle picked up powerup ", i);
         }
     }
 }
 
 void PowerupManager::reset() noexcept {
-    for (auto& powerup : powerups_) {
-        powerup->setActive(true);
+    for (std::size_t i = 0; i < powerups_.size(); ++i) {
+        setActive(i, true);
+    }
+}
+
+void PowerupManager::setActive(std::size_t index, bool active) noexcept {
+    Powerup& powerup = *powerups_[index];
+    const std::uint32_t version = powerup.getVersion();
+    powerup.setActive(active);
+    if (powerup.getVersion() != version) {
+        changes_.record(static_cast<std::uint32_t>(index));
     }
 }
 
@@ -0,0 +1,265 @@
+#include "core/profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+namespace {
+    constexpr double NANOSECONDS_PER_MICROSECOND = 1e3;
+    constexpr float NANOSECONDS_PER_MILLISECOND = 1e6f;
+    constexpr int TRACE_PROCESS_ID = 1;
+
+    std::atomic<std::uint64_t> nextProfilerId{1};
+
+    // The calling thread's buffer in the profiler it last recorded into
+    struct CachedBuffer {
+        std::uint64_t profilerId = 0;
+        void* buffer = nullptr;
+    };
+    thread_local CachedBuffer cachedBuffer;
+
+    float percentile(const std::vector<float>& sorted, float fraction) {
+        const auto index = static_cast<std::size_t>(std::lround(fraction * static_cast<float>(sorted.size() - 1)));
+        return sorted[index];
+    }
+
+    void appendEscaped(std::ostringstream& out, const char* text) {
+        for (const char* c = text; *c != '\0'; ++c) {
+            if (*c == '"' || *c == '\\') {
+                out << '\\';
+            }
+            if (static_cast<unsigned char>(*c) >= 0x20) {
+                out << *c;
+            }
+        }
+    }
+}
+
+Profiler::ScopedZone::ScopedZone(Profiler& profiler, const char* name) noexcept
+    : profiler_(profiler),
+      name_(name),
+      start_(nowNanoseconds()) {
+    ++profiler_.threadBuffer().depth;
+}
+
+Profiler::ScopedZone::~ScopedZone() {
+    ThreadBuffer& buffer = profiler_.threadBuffer();
+    --buffer.depth;
+    profiler_.recordZone(name_, start_, nowNanoseconds());
+}
+
+Profiler::Profiler()
+    : id_(nextProfilerId.fetch_add(1, std::memory_order_relaxed)),
+      frameTimes_(FRAME_HISTORY, 0.0f) {
+}
+
+Profiler::~Profiler() = default;
+
+Profiler& Profiler::instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+std::int64_t Profiler::nowNanoseconds() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+Profiler::ThreadBuffer& Profiler::threadBuffer() {
+    if (cachedBuffer.profilerId == id_) {
+        return *static_cast<ThreadBuffer*>(cachedBuffer.buffer);
+    }
+
+    // First zone of this thread here (or the thread switched profilers): find or add its ring
+    std::lock_guard lock(threadsMutex_);
+    const auto threadId = std::this_thread::get_id();
+    auto it = std::find_if(threads_.begin(), threads_.end(),
+                           [&](const auto& buffer) { return buffer->threadId == threadId; });
+    if (it == threads_.end()) {
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->threadId = threadId;
+        buffer->traceId = static_cast<std::uint32_t>(threads_.size() + 1);
+        buffer->name = "Thread " + std::to_string(buffer->traceId);
+        threads_.push_back(std::move(buffer));
+        it = threads_.end() - 1;
+    }
+    cachedBuffer = {id_, it->get()};
+    return **it;
+}
+
+void Profiler::setThreadName(const std::string& name) {
+    ThreadBuffer& buffer = threadBuffer();
+    std::lock_guard lock(threadsMutex_);
+    buffer.name = name;
+}
+
+void Profiler::recordZone(const char* name, std::int64_t startNanoseconds, std::int64_t endNanoseconds) noexcept {
+    ThreadBuffer& buffer = threadBuffer();
+    const std::uint64_t index = buffer.written.load(std::memory_order_relaxed);
+    Slot& slot = buffer.slots[index % ZONES_PER_THREAD];
+
+    // Mark the slot as being rewritten before touching its fields, then publish the new zone
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.startNanoseconds.store(startNanoseconds, std::memory_order_relaxed);
+    slot.endNanoseconds.store(endNanoseconds, std::memory_order_relaxed);
+    slot.depth.store(buffer.depth, std::memory_order_relaxed);
+    slot.sequence.store(index + 1, std::memory_order_release);
+    buffer.written.store(index + 1, std::memory_order_release);
+}
+
+bool Profiler::readZone(const ThreadBuffer& buffer, std::uint64_t index, Zone& zone) noexcept {
+    const Slot& slot = buffer.slots[index % ZONES_PER_THREAD];
+    if (slot.sequence.load(std::memory_order_acquire) != index + 1) {
+        return false;
+    }
+    zone.name = slot.name.load(std::memory_order_relaxed);
+    zone.startNanoseconds = slot.startNanoseconds.load(std::memory_order_relaxed);
+    zone.endNanoseconds = slot.endNanoseconds.load(std::memory_order_relaxed);
+    zone.depth = slot.depth.load(std::memory_order_relaxed);
+
+    // Still the same zone after the copy, so none of the fields came from a newer one
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence.load(std::memory_order_relaxed) == index + 1;
+}
+
+std::vector<Profiler::Zone> Profiler::readZones(const ThreadBuffer& buffer) {
+    const std::uint64_t end = buffer.written.load(std::memory_order_acquire);
+    const std::uint64_t begin = end > ZONES_PER_THREAD ? end - ZONES_PER_THREAD : 0;
+
+    // The owner keeps recording while we copy; slots it has moved past are skipped
+    std::vector<Zone> zones;
+    zones.reserve(static_cast<std::size_t>(end - begin));
+    Zone zone;
+    for (std::uint64_t i = begin; i < end; ++i) {
+        if (readZone(buffer, i, zone)) {
+            zones.push_back(zone);
+        }
+    }
+    return zones;
+}
+
+void Profiler::endFrame(std::int64_t nowNanoseconds) {
+    if (frameStart_ != 0) {
+        frameTimes_[frameCount_ % FRAME_HISTORY] = static_cast<float>(nowNanoseconds - frameStart_) / NANOSECONDS_PER_MILLISECOND;
+        ++frameCount_;
+
+        // Zones this thread finished during the frame; newest are last, so walk back from the end
+        const ThreadBuffer& buffer = threadBuffer();
+        const std::uint64_t written = buffer.written.load(std::memory_order_relaxed);
+        const std::uint64_t oldest = written > ZONES_PER_THREAD ? written - ZONES_PER_THREAD : 0;
+        lastFrameZones_.clear();
+        Zone zone;
+        for (std::uint64_t i = written; i > oldest; --i) {
+            if (!readZone(buffer, i - 1, zone)) {
+                continue;
+            }
+            if (zone.endNanoseconds < frameStart_) {
+                break;
+            }
+            if (zone.startNanoseconds >= frameStart_) {
+                lastFrameZones_.push_back(zone);
+            }
+        }
+        std::reverse(lastFrameZones_.begin(), lastFrameZones_.end());
+        lastFrameStart_ = frameStart_;
+        lastFrameEnd_ = nowNanoseconds;
+    }
+    frameStart_ = nowNanoseconds;
+}
+
+std::vector<float> Profiler::getFrameTimes() const {
+    const std::size_t count = (std::min)(frameCount_, FRAME_HISTORY);
+    std::vector<float> times;
+    times.reserve(count);
+    for (std::size_t i = frameCount_ - count; i < frameCount_; ++i) {
+        times.push_back(frameTimes_[i % FRAME_HISTORY]);
+    }
+    return times;
+}
+
+Profiler::FrameStats Profiler::getFrameStats() const {
+    FrameStats stats;
+    std::vector<float> times = getFrameTimes();
+    if (times.empty()) {
+        return stats;
+    }
+
+    stats.frameCount = times.size();
+    stats.lastMilliseconds = times.back();
+    std::sort(times.begin(), times.end());
+    stats.p50Milliseconds = percentile(times, 0.50f);
+    stats.p95Milliseconds = percentile(times, 0.95f);
+    stats.p99Milliseconds = percentile(times, 0.99f);
+    return stats;
+}
+
+std::string Profiler::toChromeTrace() const {
+    struct ThreadZones {
+        std::uint32_t traceId;
+        std::string name;
+        std::vector<Zone> zones;
+    };
+    std::vector<ThreadZones> threads;
+    {
+        std::lock_guard lock(threadsMutex_);
+        for (const auto& buffer : threads_) {
+            threads.push_back({buffer->traceId, buffer->name, readZones(*buffer)});
+        }
+    }
+
+    // Timestamps relative to the oldest zone keep the numbers short
+    std::int64_t origin = 0;
+    bool first = true;
+    for (const auto& thread : threads) {
+        for (const Zone& zone : thread.zones) {
+            if (first || zone.startNanoseconds < origin) {
+                origin = zone.startNanoseconds;
+                first = false;
+            }
+        }
+    }
+
+    std::ostringstream out;
+    out.setf(std::ios::fixed);
+    out.precision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool firstEvent = true;
+    const auto separator = [&] {
+        if (!firstEvent) {
+            out << ',';
+        }
+        firstEvent = false;
+    };
+
+    for (const auto& thread : threads) {
+        separator();
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << TRACE_PROCESS_ID << ",\"tid\":" << thread.traceId
+            << ",\"args\":{\"name\":\"";
+        appendEscaped(out, thread.name.c_str());
+        out << "\"}}";
+
+        for (const Zone& zone : thread.zones) {
+            separator();
+            out << "{\"name\":\"";
+            appendEscaped(out, zone.name);
+            out << "\",\"ph\":\"X\",\"pid\":" << TRACE_PROCESS_ID << ",\"tid\":" << thread.traceId
+                << ",\"ts\":" << static_cast<double>(zone.startNanoseconds - origin) / NANOSECONDS_PER_MICROSECOND
+                << ",\"dur\":" << static_cast<double>(zone.endNanoseconds - zone.startNanoseconds) / NANOSECONDS_PER_MICROSECOND
+                << '}';
+        }
+    }
+    out << "]}";
+    return out.str();
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    file << toChromeTrace();
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,74 @@
+#include "core/simd.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace {
+    bool cpuSupportsAvx2() noexcept {
+#if defined(CARSIM_HAS_AVX2_KERNELS)
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_cpu_supports("avx2");
+#elif defined(_MSC_VER)
+        int info[4];
+        __cpuidex(info, 1, 0);
+        const bool osSavesYmm = (info[2] & (1 << 27)) && ((_xgetbv(0) & 0x6) == 0x6);
+        __cpuidex(info, 7, 0);
+        return osSavesYmm && (info[1] & (1 << 5));
+#else
+        return false;
+#endif
+#else
+        return false;
+#endif
+    }
+
+    bool cpuSupportsAvx512() noexcept {
+#if defined(CARSIM_HAS_AVX512_KERNELS)
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_cpu_supports("avx512f");
+#elif defined(_MSC_VER)
+        int info[4];
+        __cpuidex(info, 1, 0);
+        const bool osSavesZmm = (info[2] & (1 << 27)) && ((_xgetbv(0) & 0xe6) == 0xe6);
+        __cpuidex(info, 7, 0);
+        return osSavesZmm && (info[1] & (1 << 16));
+#else
+        return false;
+#endif
+#else
+        return false;
+#endif
+    }
+}
+
+SimdLevel detectSimdLevel() noexcept {
+    static const SimdLevel level = cpuSupportsAvx512() ? SimdLevel::AVX512
+                                 : cpuSupportsAvx2()   ? SimdLevel::AVX2
+                                                       : SimdLevel::SCALAR;
+    return level;
+}
+
+SimdLevel clampSimdLevel(SimdLevel requested) noexcept {
+    const SimdLevel available = detectSimdLevel();
+    return static_cast<int>(requested) <= static_cast<int>(available) ? requested : available;
+}
+
+std::size_t simdLaneCount(SimdLevel level) noexcept {
+    switch (level) {
+        case SimdLevel::AVX512: return 16;
+        case SimdLevel::AVX2: return 8;
+        case SimdLevel::SCALAR: break;
+    }
+    return 1;
+}
+
+const char* simdLevelName(SimdLevel level) noexcept {
+    switch (level) {
+        case SimdLevel::AVX512: return "AVX-512";
+        case SimdLevel::AVX2: return "AVX2";
+        case SimdLevel::SCALAR: break;
+    }
+    return "scalar";
+}
@@ -0,0 +1,324 @@
+#pragma once
+
+// Lane-wise math policies for the batched kernels.
+//
+// Private to src/core. Each kernel translation unit is compiled with its own
+// instruction-set flags, so everything here has internal linkage: an inline
+// function emitted with AVX instructions must never be picked by the linker
+// for the scalar translation unit.
+
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(CARSIM_SIMD_AVX2) || defined(CARSIM_SIMD_AVX512)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Cephes single precision constants shared by the vector log/sincos
+constexpr float SIMD_SQRT_HALF = 0.707106781186547524f;
+constexpr float SIMD_FOUR_OVER_PI = 1.27323954473516f;
+constexpr float SIMD_PI4_PART1 = 0.78515625f;
+constexpr float SIMD_PI4_PART2 = 2.4187564849853515625e-4f;
+constexpr float SIMD_PI4_PART3 = 3.77489497744594108e-8f;
+constexpr float SIMD_LOG2E = 1.44269504088896341f;
+constexpr float SIMD_EXP_LIMIT = 88.0f;
+
+/**
+ * One lane, standard library math.
+ * Used for the tail of every batch and on machines without AVX,
+ * and gives results bit-identical to the scalar game objects.
+ */
+struct ScalarOps {
+    using F = float;
+    using M = bool;
+    static constexpr std::size_t WIDTH = 1;
+
+    static F load(const float* p) noexcept { return *p; }
+    static void store(float* p, F v) noexcept { *p = v; }
+    static F loadInt(const std::int32_t* p) noexcept { return static_cast<float>(*p); }
+    static void storeInt(std::int32_t* p, F v) noexcept { *p = static_cast<std::int32_t>(v); }
+    static M loadMask(const std::uint8_t* p) noexcept { return *p != 0; }
+    static void storeMask(std::uint8_t* p, M m) noexcept { *p = m ? 1 : 0; }
+
+    static F set(float v) noexcept { return v; }
+    static F add(F a, F b) noexcept { return a + b; }
+    static F sub(F a, F b) noexcept { return a - b; }
+    static F mul(F a, F b) noexcept { return a * b; }
+    static F div(F a, F b) noexcept { return a / b; }
+    static F min(F a, F b) noexcept { return b < a ? b : a; }
+    static F max(F a, F b) noexcept { return a < b ? b : a; }
+    static F abs(F a) noexcept { return std::abs(a); }
+    static F neg(F a) noexcept { return -a; }
+    static F sqrt(F a) noexcept { return std::sqrt(a); }
+
+    static M lt(F a, F b) noexcept { return a < b; }
+    static M le(F a, F b) noexcept { return a <= b; }
+    static M gt(F a, F b) noexcept { return a > b; }
+    static M ge(F a, F b) noexcept { return a >= b; }
+    static M ne(F a, F b) noexcept { return a != b; }
+    static M mand(M a, M b) noexcept { return a && b; }
+    static M mor(M a, M b) noexcept { return a || b; }
+    static M mnot(M a) noexcept { return !a; }
+    static bool any(M a) noexcept { return a; }
+    static F select(M m, F a, F b) noexcept { return m ? a : b; }
+
+    static F log(F a) noexcept { return std::log(a); }
+    static F pow(F base, float exponent) noexcept { return std::pow(base, exponent); }
+    static F fmod(F a, F b) noexcept { return std::fmod(a, b); }
+    static void sincos(F a, F& s, F& c) noexcept {
+        s = std::sin(a);
+        c = std::cos(a);
+    }
+};
+
+// Cephes logf for positive normal inputs, written against an ops policy
+template <class Ops>
+typename Ops::F polyLog(typename Ops::F x) noexcept {
+    using F = typename Ops::F;
+
+    F exponent;
+    F m = Ops::frexp(x, exponent);  // m in [0.5, 1)
+
+    const auto small = Ops::lt(m, Ops::set(SIMD_SQRT_HALF));
+    exponent = Ops::select(small, Ops::sub(exponent, Ops::set(1.0f)), exponent);
+    m = Ops::select(small, Ops::sub(Ops::add(m, m), Ops::set(1.0f)), Ops::sub(m, Ops::set(1.0f)));
+
+    const F z = Ops::mul(m, m);
+    F y = Ops::set(7.0376836292E-2f);
+    y = Ops::add(Ops::mul(y, m), Ops::set(-1.1514610310E-1f));
+    y = Ops::add(Ops::mul(y, m), Ops::set(1.1676998740E-1f));
+    y = Ops::add(Ops::mul(y, m), Ops::set(-1.2420140846E-1f));
+    y = Ops::add(Ops::mul(y, m), Ops::set(1.4249322787E-1f));
+    y = Ops::add(Ops::mul(y, m), Ops::set(-1.6668057665E-1f));
+    y = Ops::add(Ops::mul(y, m), Ops::set(2.0000714765E-1f));
+    y = Ops::add(Ops::mul(y, m), Ops::set(-2.4999993993E-1f));
+    y = Ops::add(Ops::mul(y, m), Ops::set(3.3333331174E-1f));
+    y = Ops::mul(Ops::mul(y, m), z);
+
+    y = Ops::add(y, Ops::mul(exponent, Ops::set(-2.12194440e-4f)));
+    y = Ops::sub(y, Ops::mul(z, Ops::set(0.5f)));
+    F result = Ops::add(m, y);
+    return Ops::add(result, Ops::mul(exponent, Ops::set(0.693359375f)));
+}
+
+// Cephes expf, inputs clamped to +-88 so the result stays finite
+template <class Ops>
+typename Ops::F polyExp(typename Ops::F x) noexcept {
+    using F = typename Ops::F;
+
+    x = Ops::min(Ops::max(x, Ops::set(-SIMD_EXP_LIMIT)), Ops::set(SIMD_EXP_LIMIT));
+    const F n = Ops::floor(Ops::add(Ops::mul(x, Ops::set(SIMD_LOG2E)), Ops::set(0.5f)));
+    x = Ops::sub(x, Ops::mul(n, Ops::set(0.693359375f)));
+    x = Ops::sub(x, Ops::mul(n, Ops::set(-2.12194440e-4f)));
+
+    const F z = Ops::mul(x, x);
+    F y = Ops::set(1.9875691500E-4f);
+    y = Ops::add(Ops::mul(y, x), Ops::set(1.3981999507E-3f));
+    y = Ops::add(Ops::mul(y, x), Ops::set(8.3334519073E-3f));
+    y = Ops::add(Ops::mul(y, x), Ops::set(4.1665795894E-2f));
+    y = Ops::add(Ops::mul(y, x), Ops::set(1.6666665459E-1f));
+    y = Ops::add(Ops::mul(y, x), Ops::set(5.0000001201E-1f));
+    y = Ops::add(Ops::add(Ops::mul(y, z), x), Ops::set(1.0f));
+    return Ops::ldexp(y, n);
+}
+
+// a - m * floor(a / m), always in [0, m) for the small integers used below
+template <class Ops>
+typename Ops::F floorMod(typename Ops::F a, float m) noexcept {
+    return Ops::sub(a, Ops::mul(Ops::set(m), Ops::floor(Ops::mul(a, Ops::set(1.0f / m)))));
+}
+
+// Cephes sinf/cosf with shared octant reduction, accurate to a few ulp for |x| < 8192
+template <class Ops>
+void polySinCos(typename Ops::F x, typename Ops::F& sinOut, typename Ops::F& cosOut) noexcept {
+    using F = typename Ops::F;
+
+    const F ax = Ops::abs(x);
+
+    // Octant index, rounded up to even
+    F j = Ops::floor(Ops::mul(ax, Ops::set(SIMD_FOUR_OVER_PI)));
+    j = Ops::add(j, floorMod<Ops>(j, 2.0f));
+
+    F z = Ops::sub(ax, Ops::mul(j, Ops::set(SIMD_PI4_PART1)));
+    z = Ops::sub(z, Ops::mul(j, Ops::set(SIMD_PI4_PART2)));
+    z = Ops::sub(z, Ops::mul(j, Ops::set(SIMD_PI4_PART3)));
+    const F zz = Ops::mul(z, z);
+
+    F sinPoly = Ops::set(-1.9515295891E-4f);
+    sinPoly = Ops::add(Ops::mul(sinPoly, zz), Ops::set(8.3321608736E-3f));
+    sinPoly = Ops::add(Ops::mul(sinPoly, zz), Ops::set(-1.6666654611E-1f));
+    sinPoly = Ops::add(Ops::mul(Ops::mul(sinPoly, zz), z), z);
+
+    F cosPoly = Ops::set(2.443315711809948E-005f);
+    cosPoly = Ops::add(Ops::mul(cosPoly, zz), Ops::set(-1.388731625493765E-003f));
+    cosPoly = Ops::add(Ops::mul(cosPoly, zz), Ops::set(4.166664568298827E-002f));
+    cosPoly = Ops::mul(Ops::mul(cosPoly, zz), zz);
+    cosPoly = Ops::add(Ops::sub(cosPoly, Ops::mul(zz, Ops::set(0.5f))), Ops::set(1.0f));
+
+    const auto swapPolys = Ops::ge(floorMod<Ops>(j, 4.0f), Ops::set(2.0f));
+    const auto flipSin = Ops::ge(floorMod<Ops>(j, 8.0f), Ops::set(4.0f));
+    const auto flipCos = Ops::lt(floorMod<Ops>(Ops::sub(j, Ops::set(2.0f)), 8.0f), Ops::set(4.0f));
+    const auto negativeInput = Ops::lt(x, Ops::set(0.0f));
+
+    F s = Ops::select(swapPolys, cosPoly, sinPoly);
+    F c = Ops::select(swapPolys, sinPoly, cosPoly);
+
+    // Flip sine once for the octant and once for a negative input
+    const auto sinSign = Ops::mor(Ops::mand(flipSin, Ops::mnot(negativeInput)),
+                                  Ops::mand(Ops::mnot(flipSin), negativeInput));
+    sinOut = Ops::select(sinSign, Ops::neg(s), s);
+    cosOut = Ops::select(flipCos, Ops::neg(c), c);
+}
+
+#if defined(CARSIM_SIMD_AVX2)
+
+/**
+ * Eight lanes with AVX2. Masks are all-ones/all-zero float lanes.
+ */
+struct Avx2Ops {
+    using F = __m256;
+    using M = __m256;
+    static constexpr std::size_t WIDTH = 8;
+
+    static F load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+    static void store(float* p, F v) noexcept { _mm256_storeu_ps(p, v); }
+    static F loadInt(const std::int32_t* p) noexcept {
+        return _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+    }
+    static void storeInt(std::int32_t* p, F v) noexcept {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_cvttps_epi32(v));
+    }
+    static M loadMask(const std::uint8_t* p) noexcept {
+        const __m256i wide = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+        return _mm256_castsi256_ps(_mm256_cmpgt_epi32(wide, _mm256_setzero_si256()));
+    }
+    static void storeMask(std::uint8_t* p, M m) noexcept {
+        const int bits = _mm256_movemask_ps(m);
+        for (std::size_t i = 0; i < WIDTH; ++i) {
+            p[i] = static_cast<std::uint8_t>((bits >> i) & 1);
+        }
+    }
+
+    static F set(float v) noexcept { return _mm256_set1_ps(v); }
+    static F add(F a, F b) noexcept { return _mm256_add_ps(a, b); }
+    static F sub(F a, F b) noexcept { return _mm256_sub_ps(a, b); }
+    static F mul(F a, F b) noexcept { return _mm256_mul_ps(a, b); }
+    static F div(F a, F b) noexcept { return _mm256_div_ps(a, b); }
+    static F min(F a, F b) noexcept { return _mm256_min_ps(a, b); }
+    static F max(F a, F b) noexcept { return _mm256_max_ps(a, b); }
+    static F abs(F a) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static F neg(F a) noexcept { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+    static F sqrt(F a) noexcept { return _mm256_sqrt_ps(a); }
+    static F floor(F a) noexcept { return _mm256_floor_ps(a); }
+    static F trunc(F a) noexcept { return _mm256_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+
+    static M lt(F a, F b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static M le(F a, F b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static M gt(F a, F b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static M ge(F a, F b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    static M ne(F a, F b) noexcept { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+    static M mand(M a, M b) noexcept { return _mm256_and_ps(a, b); }
+    static M mor(M a, M b) noexcept { return _mm256_or_ps(a, b); }
+    static M mnot(M a) noexcept { return _mm256_xor_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+    static bool any(M a) noexcept { return _mm256_movemask_ps(a) != 0; }
+    static F select(M m, F a, F b) noexcept { return _mm256_blendv_ps(b, a, m); }
+
+    // Split positive normal x into mantissa in [0.5, 1) and exponent
+    static F frexp(F x, F& exponent) noexcept {
+        const __m256i bits = _mm256_castps_si256(x);
+        const __m256i biased = _mm256_srli_epi32(bits, 23);
+        exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(biased, _mm256_set1_epi32(126)));
+        const __m256i mantissa = _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)),
+                                                 _mm256_set1_epi32(0x3f000000));
+        return _mm256_castsi256_ps(mantissa);
+    }
+
+    // x * 2^n for integral n in the normal exponent range
+    static F ldexp(F x, F n) noexcept {
+        const __m256i bits = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvttps_epi32(n), _mm256_set1_epi32(127)), 23);
+        return _mm256_mul_ps(x, _mm256_castsi256_ps(bits));
+    }
+
+    static F log(F a) noexcept { return polyLog<Avx2Ops>(a); }
+    static F pow(F base, float exponent) noexcept { return polyExp<Avx2Ops>(mul(set(exponent), log(base))); }
+    static F fmod(F a, F b) noexcept { return sub(a, mul(trunc(div(a, b)), b)); }
+    static void sincos(F a, F& s, F& c) noexcept { polySinCos<Avx2Ops>(a, s, c); }
+};
+
+#endif // CARSIM_SIMD_AVX2
+
+#if defined(CARSIM_SIMD_AVX512)
+
+/**
+ * Sixteen lanes with AVX-512F. Masks are k-registers.
+ * Sticks to AVX-512F so it runs on every AVX-512 capable CPU.
+ */
+struct Avx512Ops {
+    using F = __m512;
+    using M = __mmask16;
+    static constexpr std::size_t WIDTH = 16;
+
+    static F load(const float* p) noexcept { return _mm512_loadu_ps(p); }
+    static void store(float* p, F v) noexcept { _mm512_storeu_ps(p, v); }
+    static F loadInt(const std::int32_t* p) noexcept { return _mm512_cvtepi32_ps(_mm512_loadu_si512(p)); }
+    static void storeInt(std::int32_t* p, F v) noexcept { _mm512_storeu_si512(p, _mm512_cvttps_epi32(v)); }
+    static M loadMask(const std::uint8_t* p) noexcept {
+        const __m512i wide = _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        return _mm512_test_epi32_mask(wide, wide);
+    }
+    static void storeMask(std::uint8_t* p, M m) noexcept {
+        _mm512_mask_cvtepi32_storeu_epi8(p, 0xFFFF, _mm512_maskz_set1_epi32(m, 1));
+    }
+
+    static F set(float v) noexcept { return _mm512_set1_ps(v); }
+    static F add(F a, F b) noexcept { return _mm512_add_ps(a, b); }
+    static F sub(F a, F b) noexcept { return _mm512_sub_ps(a, b); }
+    static F mul(F a, F b) noexcept { return _mm512_mul_ps(a, b); }
+    static F div(F a, F b) noexcept { return _mm512_div_ps(a, b); }
+    static F min(F a, F b) noexcept { return _mm512_min_ps(a, b); }
+    static F max(F a, F b) noexcept { return _mm512_max_ps(a, b); }
+    static F abs(F a) noexcept { return _mm512_abs_ps(a); }
+    static F neg(F a) noexcept {
+        return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_set1_epi32(static_cast<int>(0x80000000u))));
+    }
+    static F sqrt(F a) noexcept { return _mm512_sqrt_ps(a); }
+    static F floor(F a) noexcept { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+    static F trunc(F a) noexcept { return _mm512_roundscale_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+
+    static M lt(F a, F b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+    static M le(F a, F b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+    static M gt(F a, F b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+    static M ge(F a, F b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+    static M ne(F a, F b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ); }
+    static M mand(M a, M b) noexcept { return static_cast<M>(a & b); }
+    static M mor(M a, M b) noexcept { return static_cast<M>(a | b); }
+    static M mnot(M a) noexcept { return static_cast<M>(~a); }
+    static bool any(M a) noexcept { return a != 0; }
+    static F select(M m, F a, F b) noexcept { return _mm512_mask_blend_ps(m, b, a); }
+
+    static F frexp(F x, F& exponent) noexcept {
+        const __m512i bits = _mm512_castps_si512(x);
+        const __m512i biased = _mm512_srli_epi32(bits, 23);
+        exponent = _mm512_cvtepi32_ps(_mm512_sub_epi32(biased, _mm512_set1_epi32(126)));
+        const __m512i mantissa = _mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(0x007fffff)),
+                                                 _mm512_set1_epi32(0x3f000000));
+        return _mm512_castsi512_ps(mantissa);
+    }
+
+    static F ldexp(F x, F n) noexcept {
+        const __m512i bits = _mm512_slli_epi32(_mm512_add_epi32(_mm512_cvttps_epi32(n), _mm512_set1_epi32(127)), 23);
+        return _mm512_mul_ps(x, _mm512_castsi512_ps(bits));
+    }
+
+    static F log(F a) noexcept { return polyLog<Avx512Ops>(a); }
+    static F pow(F base, float exponent) noexcept { return polyExp<Avx512Ops>(mul(set(exponent), log(base))); }
+    static F fmod(F a, F b) noexcept { return sub(a, mul(trunc(div(a, b)), b)); }
+    static void sincos(F a, F& s, F& c) noexcept { polySinCos<Avx512Ops>(a, s, c); }
+};
+
+#endif // CARSIM_SIMD_AVX512
+
+} // namespace
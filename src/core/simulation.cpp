@@ -0,0 +1,65 @@
+#include "core/simulation.hpp"
+#include "core/random_position_generator.hpp"
+#include <algorithm>
+
+Simulation::Simulation(float playAreaSize, int treeCount, int powerupCount, std::uint32_t seed, int trafficCount)
+    : seed_(seed),
+      vehicle_(GameConfig::World::SPAWN_POINT_X,
+               GameConfig::World::SPAWN_POINT_Y,
+               GameConfig::World::SPAWN_POINT_Z),
+      obstacleManager_(playAreaSize, treeCount, seed),
+      powerupManager_(powerupCount, playAreaSize, seed),
+      previousControls_(),
+      tickCount_(0),
+      resetCount_(0) {
+    generateTraffic(trafficCount, playAreaSize);
+}
+
+void Simulation::generateTraffic(int count, float playAreaSize) {
+    RandomPositionGenerator posGen(playAreaSize, GameConfig::Traffic::SPAWN_MARGIN, CounterRng(seed_, RandomStream::TRAFFIC));
+
+    std::vector<std::array<float, 2>> positions;
+    traffic_.reserve(static_cast<std::size_t>((std::max)(count, 0)));
+    for (int i = 0; i < count; ++i) {
+        const auto pos = posGen.getRandomPositionWithConstraints(positions, GameConfig::Traffic::MIN_DISTANCE_FROM_SPAWN,
+                                                                 GameConfig::Traffic::MIN_SPACING);
+        positions.push_back(pos);
+        traffic_.add(pos[0], GameConfig::World::SPAWN_POINT_Y, pos[1]);
+    }
+}
+
+void Simulation::step(const ControlState& controls, float deltaTime) {
+    if (controls.reset && !previousControls_.reset) {
+        reset();
+    }
+
+    applyControls(vehicle_, controls, previousControls_, deltaTime);
+    previousControls_ = controls;
+
+    step(deltaTime);
+}
+
+void Simulation::step(float deltaTime) {
+    vehicle_.storePreviousTransform();
+    vehicle_.update(deltaTime);
+    traffic_.update(deltaTime);
+    obstacleManager_.update(deltaTime);
+
+    // Cars push each other first, so the obstacles have the last word and nobody ends up in a wall
+    traffic_.resolveCollisions();
+    traffic_.handleCollisions(vehicle_);
+    obstacleManager_.handleCollisions(vehicle_);
+    traffic_.handleObstacleCollisions(obstacleManager_, deltaTime);
+
+    powerupManager_.update(deltaTime);
+    powerupManager_.handleCollisions(vehicle_);
+
+    tickCount_++;
+}
+
+void Simulation::reset() noexcept {
+    vehicle_.reset();
+    obstacleManager_.reset();  // Contacts from before the respawn must not warm start
+    powerupManager_.reset();
+    resetCount_++;
+}
@@ -0,0 +1,33 @@
+#include "core/simulation_snapshot.hpp"
+#include "core/simulation.hpp"
+#include <algorithm>
+
+void captureSnapshot(const Simulation& simulation, SimulationSnapshot& snapshot) noexcept {
+    snapshot.tick = simulation.getTickCount();
+    snapshot.resetCount = simulation.getResetCount();
+
+    const Vehicle& vehicle = simulation.getVehicle();
+    VehicleSnapshot& out = snapshot.vehicle;
+    out.previous = {vehicle.getPreviousPosition(), vehicle.getPreviousRotation()};
+    out.current = {vehicle.getPosition(), vehicle.getRotation()};
+    out.velocity = vehicle.getVelocity();
+    out.steeringInput = vehicle.getSteeringInput();
+    out.driftAngle = vehicle.getDriftAngle();
+    out.nitrousTimeRemaining = vehicle.getNitrousTimeRemaining();
+    out.rpm = vehicle.getRPM();
+    out.scale = vehicle.getScale();
+    out.gear = vehicle.getCurrentGear();
+    out.drifting = vehicle.isDrifting();
+    out.hasNitrous = vehicle.hasNitrous();
+    out.nitrousActive = vehicle.isNitrousActive();
+
+    // Powerups beyond the snapshot capacity are simulated but not reported
+    const PowerupManager& powerupManager = simulation.getPowerupManager();
+    const auto& powerups = powerupManager.getPowerups();
+    const std::size_t count = (std::min)(powerups.size(), snapshot.powerupActive.size());
+    snapshot.powerupCount = static_cast<std::uint32_t>(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        snapshot.powerupActive[i] = powerups[i]->isActive() ? 1 : 0;
+    }
+    snapshot.powerupChanges = powerupManager.getChanges();
+}
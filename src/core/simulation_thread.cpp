@@ -0,0 +1,116 @@
+#include "core/simulation_thread.hpp"
+#include "core/input_recording.hpp"
+#include "core/logger.hpp"
+#include "core/profiler.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace {
+    // Controls that act on a press edge and must not be missed between ticks
+    constexpr std::uint32_t EDGE_CONTROLS = ControlBit::DRIFT | ControlBit::NITROUS | ControlBit::RESET;
+}
+
+SimulationThread::SimulationThread(Simulation& simulation, float tickRate)
+    : simulation_(simulation),
+      timestep_(tickRate),
+      stepSize_(timestep_.getStepSize()),
+      heldControls_(0),
+      pendingPresses_(0),
+      recording_(nullptr),
+      running_(false),
+      skippedSnapshots_(0) {
+    // Readers get the initial world even before the first tick
+    publish();
+}
+
+SimulationThread::~SimulationThread() {
+    stop();
+}
+
+void SimulationThread::start() {
+    if (running_.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    timestep_.reset();
+    thread_ = std::thread(&SimulationThread::run, this);
+}
+
+void SimulationThread::stop() noexcept {
+    running_.store(false, std::memory_order_release);
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void SimulationThread::submitControls(const ControlState& controls) noexcept {
+    const std::uint32_t bits = packControls(controls);
+    heldControls_.store(bits, std::memory_order_relaxed);
+    if (bits & EDGE_CONTROLS) {
+        pendingPresses_.fetch_or(bits & EDGE_CONTROLS, std::memory_order_relaxed);
+    }
+}
+
+ControlState SimulationThread::takeControls() noexcept {
+    const std::uint32_t held = heldControls_.load(std::memory_order_relaxed);
+    const std::uint32_t pressed = pendingPresses_.exchange(0, std::memory_order_relaxed);
+    return unpackControls(held | pressed);
+}
+
+float SimulationThread::getInterpolationAlpha(std::int64_t nowNanoseconds) const noexcept {
+    const SimulationSnapshot& snapshot = snapshots_.read();
+    if (snapshot.tickTimeNanoseconds == 0 || snapshot.stepSize <= 0.0f) {
+        return 1.0f;
+    }
+    const double sinceTick = static_cast<double>(nowNanoseconds - snapshot.tickTimeNanoseconds) * 1e-9;
+    return (std::clamp)(static_cast<float>(sinceTick / snapshot.stepSize), 0.0f, 1.0f);
+}
+
+std::int64_t SimulationThread::nowNanoseconds() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SimulationThread::publish() {
+    CARSIM_PROFILE_ZONE("SimulationThread::publish");
+    SimulationSnapshot& snapshot = snapshots_.writeBuffer();
+    captureSnapshot(simulation_, snapshot);
+    snapshot.stepSize = stepSize_;
+    snapshot.tickTimeNanoseconds = simulation_.getTickCount() > 0 ? nowNanoseconds() : 0;
+
+    if (!snapshots_.publish()) {
+        skippedSnapshots_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void SimulationThread::run() {
+    Logger::info(Logger::Tag::CORE, "Simulation thread started");
+    CARSIM_PROFILE_THREAD("Simulation");
+
+    using Clock = std::chrono::steady_clock;
+    auto lastTime = Clock::now();
+
+    while (running_.load(std::memory_order_acquire)) {
+        const auto now = Clock::now();
+        const float elapsed = std::chrono::duration<float>(now - lastTime).count();
+        lastTime = now;
+
+        const int steps = timestep_.advance(elapsed);
+        for (int i = 0; i < steps; ++i) {
+            CARSIM_PROFILE_ZONE("Simulation::step");
+            const ControlState controls = takeControls();
+            if (recording_) {
+                recording_->record(simulation_.getTickCount(), controls);
+            }
+            simulation_.step(controls, stepSize_);
+        }
+        if (steps > 0) {
+            publish();
+        }
+
+        // Sleep until the next step is due
+        const float untilNextStep = (1.0f - timestep_.getAlpha()) * stepSize_;
+        std::this_thread::sleep_until(now + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(untilNextStep)));
+    }
+
+    Logger::info(Logger::Tag::CORE, "Simulation thread stopped");
+}
@@ -0,0 +1,87 @@
+#include "core/spatial_grid.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Keeps the offset table bounded on huge, sparse maps; cells grow instead
+    constexpr float MAX_CELLS_PER_AXIS = 4096.0f;
+    constexpr float MIN_CELL_SIZE = 0.01f;
+}
+
+SpatialGrid::SpatialGrid(float cellSize)
+    : cellSize_((std::max)(cellSize, MIN_CELL_SIZE)),
+      inverseCellSize_(1.0f / cellSize_),
+      originX_(0.0f),
+      originZ_(0.0f),
+      limitX_(0.0f),
+      limitZ_(0.0f),
+      columns_(0),
+      rows_(0) {
+}
+
+void SpatialGrid::clear() noexcept {
+    cellStart_.clear();
+    entries_.clear();
+    columns_ = 0;
+    rows_ = 0;
+}
+
+void SpatialGrid::build(const std::vector<Entry>& entries) {
+    clear();
+    if (entries.empty()) {
+        return;
+    }
+
+    float minX = entries.front().x;
+    float minZ = entries.front().z;
+    float maxX = minX;
+    float maxZ = minZ;
+    for (const Entry& entry : entries) {
+        minX = (std::min)(minX, entry.x - entry.radius);
+        minZ = (std::min)(minZ, entry.z - entry.radius);
+        maxX = (std::max)(maxX, entry.x + entry.radius);
+        maxZ = (std::max)(maxZ, entry.z + entry.radius);
+    }
+
+    float cellSize = cellSize_;
+    const float largestExtent = (std::max)(maxX - minX, maxZ - minZ);
+    if (largestExtent / cellSize > MAX_CELLS_PER_AXIS) {
+        cellSize = largestExtent / MAX_CELLS_PER_AXIS;
+    }
+    inverseCellSize_ = 1.0f / cellSize;
+    originX_ = minX;
+    originZ_ = minZ;
+    limitX_ = maxX;
+    limitZ_ = maxZ;
+    columns_ = static_cast<int>((maxX - minX) * inverseCellSize_) + 1;
+    rows_ = static_cast<int>((maxZ - minZ) * inverseCellSize_) + 1;
+
+    // Counting sort: count entries per cell, prefix-sum into offsets, then scatter
+    const std::size_t cellCount = static_cast<std::size_t>(columns_) * static_cast<std::size_t>(rows_);
+    cellStart_.assign(cellCount + 1, 0);
+
+    const auto forEachCoveredCell = [this](const Entry& entry, auto&& action) {
+        const int firstColumn = cellCoordinate(entry.x - entry.radius - originX_, columns_);
+        const int lastColumn = cellCoordinate(entry.x + entry.radius - originX_, columns_);
+        const int firstRow = cellCoordinate(entry.z - entry.radius - originZ_, rows_);
+        const int lastRow = cellCoordinate(entry.z + entry.radius - originZ_, rows_);
+        for (int row = firstRow; row <= lastRow; ++row) {
+            for (int column = firstColumn; column <= lastColumn; ++column) {
+                action(static_cast<std::size_t>(row) * static_cast<std::size_t>(columns_) + column);
+            }
+        }
+    };
+
+    for (const Entry& entry : entries) {
+        forEachCoveredCell(entry, [this](std::size_t cell) { ++cellStart_[cell + 1]; });
+    }
+    for (std::size_t cell = 0; cell < cellCount; ++cell) {
+        cellStart_[cell + 1] += cellStart_[cell];
+    }
+
+    entries_.resize(cellStart_[cellCount]);
+    std::vector<std::uint32_t> cursor(cellStart_.begin(), cellStart_.end() - 1);
+    for (const Entry& entry : entries) {
+        forEachCoveredCell(entry, [this, &entry, &cursor](std::size_t cell) { entries_[cursor[cell]++] = entry; });
+    }
+}
@@ -21,10 +21,12 @@ Vehicle::Vehicle(float x, float y, float z)
     size_[0] = VehicleTuning::VEHICLE_WIDTH;
     size_[1] = VehicleTuning::VEHICLE_HEIGHT;
     size_[2] = VehicleTuning::VEHICLE_LENGTH;
+    updateCollisionRadius();
 
     // Start facing down in minimap (180 degrees)
     rotation_ = VehicleTuning::INITIAL_ROTATION_RADIANS;
     initialRotation_ = VehicleTuning::INITIAL_ROTATION_RADIANS;
+    storePreviousTransform();
 }
 
 void Vehicle::accelerateForward() noexcept {
@@ -60,6 +62,7 @@ void Vehicle::turn(float amount) noexcept {
     if (rotation_ < 0.0f) {
         rotation_ += VehicleTuning::TWO_PI;
     }
+    markChanged();
 }
 
 float Vehicle::calculateTurnRate() const noexcept {
@@ -139,7 +142,7 @@ void Vehicle::update(float deltaTime) {
     updateRPM();
     updateDrift(deltaTime);
     updatePosition(deltaTime);
-    decayAcceleration();
+    decayAcceleration(deltaTime);
 }
 
 void Vehicle::updateNitrous(float deltaTime) noexcept {
@@ -166,8 +169,9 @@ void Vehicle::updateVelocity(float deltaTime) noexcept {
     float frictionMultiplier = VehicleTuning::FRICTION_BASE_VALUE + ((logValue + VehicleTuning::FRICTION_LOG_OFFSET) / VehicleTuning::FRICTION_LOG_OFFSET) * frictionRange;
     frictionMultiplier = (std::clamp)(frictionMultiplier, VehicleTuning::FRICTION_BASE_VALUE, VehicleTuning::FRICTION_COEFFICIENT);
 
+    // Friction factors are tuned per 60 Hz frame, scale them to this step
     float frictionCoefficient = isDrifting_ ? baseFriction : frictionMultiplier;
-    velocity_ *= frictionCoefficient;
+    velocity_ *= VehicleTuning::decayFactor(frictionCoefficient, deltaTime);
 
     float currentMaxSpeed = nitrousActive_ ? VehicleTuning::NITROUS_MAX_SPEED : VehicleTuning::MAX_SPEED;
     velocity_ = std::clamp(velocity_, -VehicleTuning::MAX_REVERSE_SPEED, currentMaxSpeed);
@@ -190,28 +194,26 @@ void Vehicle::updateRPM() noexcept {
 
 void Vehicle::updateDrift(float deltaTime) noexcept {
     if (isDrifting_) {
-        driftAngle_ *= VehicleTuning::DRIFT_DECAY_RATE;
+        driftAngle_ *= VehicleTuning::decayFactor(VehicleTuning::DRIFT_DECAY_RATE, deltaTime);
     }
 }
 
 void Vehicle::updatePosition(float deltaTime) noexcept {
-    // Car slides at an angle while drifting
-    float movementAngle = rotation_;
-    if (isDrifting_) {
-        movementAngle = rotation_ - driftAngle_;
-    }
-
+    const float movementAngle = getMovementAngle();
     const float deltaX = std::sin(movementAngle) * velocity_ * deltaTime;
     const float deltaZ = std::cos(movementAngle) * velocity_ * deltaTime;
     position_[0] += deltaX;
     position_[2] += deltaZ;
+    if (deltaX != 0.0f || deltaZ != 0.0f) {
+        markChanged();
+    }
 }
 
-void Vehicle::decayAcceleration() noexcept {
+void Vehicle::decayAcceleration(float deltaTime) noexcept {
     acceleration_ = 0.0f;
 
     // Steering wheel returns to center
-    steeringInput_ *= VehicleTuning::STEERING_DECAY_RATE;
+    steeringInput_ *= VehicleTuning::decayFactor(VehicleTuning::STEERING_DECAY_RATE, deltaTime);
     if (std::abs(steeringInput_) < VehicleTuning::STEERING_ZERO_THRESHOLD) {
         steeringInput_ = 0.0f;
     }
@@ -252,6 +254,11 @@ float Vehicle::getDriftAngle() const noexcept {
     return driftAngle_;
 }
 
+float Vehicle::getMovementAngle() const noexcept {
+    // Car slides at an angle while drifting
+    return isDrifting_ ? rotation_ - driftAngle_ : rotation_;
+}
+
 int Vehicle::getCurrentGear() const noexcept {
     return currentGear_;
 }
@@ -0,0 +1,132 @@
+#include "core/vehicle_batch.hpp"
+#include "core/vehicle_tuning.hpp"
+#include "vehicle_batch_kernel.hpp"
+#include <algorithm>
+
+std::size_t VehicleBatchKernels::stepScalar(const VehicleLanes& lanes, std::size_t begin, const StepFactors& factors) noexcept {
+    return stepLanes<ScalarOps>(lanes, begin, factors);
+}
+
+VehicleBatch::VehicleBatch(SimdLevel level)
+    : simdLevel_(clampSimdLevel(level)) {
+}
+
+std::size_t VehicleBatch::add(float x, float y, float z) {
+    initialX_.push_back(x);
+    initialZ_.push_back(z);
+
+    positionX_.push_back(x);
+    positionY_.push_back(y);
+    positionZ_.push_back(z);
+    rotation_.push_back(VehicleTuning::INITIAL_ROTATION_RADIANS);
+    velocity_.push_back(0.0f);
+    steeringInput_.push_back(0.0f);
+    driftAngle_.push_back(0.0f);
+    nitrousTimeRemaining_.push_back(0.0f);
+    rpm_.push_back(VehicleTuning::IDLE_RPM);
+    gear_.push_back(1);
+    drifting_.push_back(0);
+    hasNitrous_.push_back(0);
+    nitrousActive_.push_back(0);
+    accelMultiplier_.push_back(1.0f);
+
+    throttle_.push_back(0.0f);
+    turnLeft_.push_back(0);
+    turnRight_.push_back(0);
+    driftHeld_.push_back(0);
+    nitrousHeld_.push_back(0);
+    driftHeldPrevious_.push_back(0);
+    nitrousHeldPrevious_.push_back(0);
+
+    return velocity_.size() - 1;
+}
+
+void VehicleBatch::reserve(std::size_t count) {
+    for (auto* lane : {&initialX_, &initialZ_, &positionX_, &positionY_, &positionZ_, &rotation_, &velocity_,
+                       &steeringInput_, &driftAngle_, &nitrousTimeRemaining_, &rpm_, &accelMultiplier_, &throttle_}) {
+        lane->reserve(count);
+    }
+    for (auto* lane : {&drifting_, &hasNitrous_, &nitrousActive_, &turnLeft_, &turnRight_,
+                       &driftHeld_, &nitrousHeld_, &driftHeldPrevious_, &nitrousHeldPrevious_}) {
+        lane->reserve(count);
+    }
+    gear_.reserve(count);
+}
+
+void VehicleBatch::setControls(std::size_t index, const ControlState& controls) noexcept {
+    // Same priorities as applyControls: forward wins over brake
+    throttle_[index] = controls.forward ? 1.0f : (controls.backward ? -1.0f : 0.0f);
+    turnLeft_[index] = controls.left ? 1 : 0;
+    turnRight_[index] = controls.right ? 1 : 0;
+    driftHeld_[index] = controls.drift ? 1 : 0;
+    nitrousHeld_[index] = controls.nitrous ? 1 : 0;
+}
+
+void VehicleBatch::setAccelerationMultiplier(std::size_t index, float multiplier) noexcept {
+    accelMultiplier_[index] = std::clamp(multiplier, 0.1f, 5.0f);
+}
+
+void VehicleBatch::pickupNitrous(std::size_t index) noexcept {
+    hasNitrous_[index] = 1;
+}
+
+void VehicleBatch::reset(std::size_t index) noexcept {
+    positionX_[index] = initialX_[index];
+    positionZ_[index] = initialZ_[index];
+    rotation_[index] = VehicleTuning::INITIAL_ROTATION_RADIANS;
+    velocity_[index] = 0.0f;
+    steeringInput_[index] = 0.0f;
+    driftAngle_[index] = 0.0f;
+    nitrousTimeRemaining_[index] = 0.0f;
+    rpm_[index] = VehicleTuning::IDLE_RPM;
+    gear_[index] = 1;
+    drifting_[index] = 0;
+    hasNitrous_[index] = 0;
+    nitrousActive_[index] = 0;
+}
+
+void VehicleBatch::resetAll() noexcept {
+    for (std::size_t i = 0; i < size(); ++i) {
+        reset(i);
+    }
+}
+
+void VehicleBatch::step(float deltaTime) noexcept {
+    const VehicleBatchKernels::VehicleLanes lanes{
+        size(),
+        positionX_.data(), positionZ_.data(), rotation_.data(), velocity_.data(),
+        steeringInput_.data(), driftAngle_.data(), nitrousTimeRemaining_.data(), rpm_.data(),
+        gear_.data(), drifting_.data(), hasNitrous_.data(), nitrousActive_.data(), accelMultiplier_.data(),
+        throttle_.data(), turnLeft_.data(), turnRight_.data(), driftHeld_.data(), nitrousHeld_.data(),
+        driftHeldPrevious_.data(), nitrousHeldPrevious_.data()
+    };
+
+    const VehicleBatchKernels::StepFactors factors = VehicleBatchKernels::makeStepFactors(deltaTime);
+
+    std::size_t done = 0;
+    switch (simdLevel_) {
+#if defined(CARSIM_HAS_AVX512_KERNELS)
+        case SimdLevel::AVX512:
+            done = VehicleBatchKernels::stepAvx512(lanes, factors);
+            break;
+#endif
+#if defined(CARSIM_HAS_AVX2_KERNELS)
+        case SimdLevel::AVX2:
+            done = VehicleBatchKernels::stepAvx2(lanes, factors);
+            break;
+#endif
+        default:
+            break;
+    }
+
+    // Remainder that does not fill a vector, or everything on the scalar level
+    VehicleBatchKernels::stepScalar(lanes, done, factors);
+}
+
+void VehicleBatch::setSimdLevel(SimdLevel level) noexcept {
+    simdLevel_ = clampSimdLevel(level);
+}
+
+std::array<float, 3> VehicleBatch::getPosition(std::size_t index) const noexcept {
+    return {positionX_[index], positionY_[index], positionZ_[index]};
+}
@@ -0,0 +1,7 @@
+// Built with AVX2 enabled (see src/core/CMakeLists.txt); only called after runtime detection
+#define CARSIM_SIMD_AVX2
+#include "vehicle_batch_kernel.hpp"
+
+std::size_t VehicleBatchKernels::stepAvx2(const VehicleLanes& lanes, const StepFactors& factors) noexcept {
+    return stepLanes<Avx2Ops>(lanes, 0, factors);
+}
@@ -0,0 +1,7 @@
+// Built with AVX-512F enabled (see src/core/CMakeLists.txt); only called after runtime detection
+#define CARSIM_SIMD_AVX512
+#include "vehicle_batch_kernel.hpp"
+
+std::size_t VehicleBatchKernels::stepAvx512(const VehicleLanes& lanes, const StepFactors& factors) noexcept {
+    return stepLanes<Avx512Ops>(lanes, 0, factors);
+}
@@ -0,0 +1,285 @@
+#pragma once
+
+// Vehicle physics over structure-of-arrays lanes.
+//
+// Private to src/core: included once by the scalar, AVX2 and AVX-512
+// translation units, each instantiating stepLanes with its own ops policy.
+// The lane math follows applyControls() followed by Vehicle::update() line by
+// line, keep the two in sync when tuning the vehicle.
+
+#include <cstddef>
+#include <cstdint>
+#include "core/vehicle_tuning.hpp"
+#include "simd_ops.hpp"
+
+namespace VehicleBatchKernels {
+
+/**
+ * Raw views of the VehicleBatch arrays handed to the kernels.
+ */
+struct VehicleLanes {
+    std::size_t count;
+
+    // Simulation state
+    float* positionX;
+    float* positionZ;
+    float* rotation;
+    float* velocity;
+    float* steeringInput;
+    float* driftAngle;
+    float* nitrousTimeRemaining;
+    float* rpm;
+    std::int32_t* gear;
+    std::uint8_t* drifting;
+    std::uint8_t* hasNitrous;
+    std::uint8_t* nitrousActive;
+    const float* accelMultiplier;
+
+    // Controls for this step; the *Previous arrays hold last step's buttons for edge detection
+    const float* throttle;  // +1 forward, -1 backward, 0 coasting
+    const std::uint8_t* turnLeft;
+    const std::uint8_t* turnRight;
+    const std::uint8_t* driftHeld;
+    const std::uint8_t* nitrousHeld;
+    std::uint8_t* driftHeldPrevious;
+    std::uint8_t* nitrousHeldPrevious;
+};
+
+/**
+ * Values shared by every lane for one step, computed once with std::pow
+ * so that all levels decay by exactly the same factors.
+ */
+struct StepFactors {
+    float deltaTime;
+    float decayExponent;  // deltaTime in reference frames, for the per-lane friction factor
+    float driftFriction;
+    float driftDecay;
+    float steeringDecay;
+};
+
+[[nodiscard]] inline StepFactors makeStepFactors(float deltaTime) noexcept {
+    return {
+        deltaTime,
+        deltaTime * VehicleTuning::REFERENCE_FRAME_RATE,
+        VehicleTuning::decayFactor(VehicleTuning::DRIFT_FRICTION_COEFFICIENT, deltaTime),
+        VehicleTuning::decayFactor(VehicleTuning::DRIFT_DECAY_RATE, deltaTime),
+        VehicleTuning::decayFactor(VehicleTuning::STEERING_DECAY_RATE, deltaTime)
+    };
+}
+
+// Each entry point steps lanes [0, n) for some n <= count that is a multiple of its width
+// and returns n; the caller finishes the tail with the scalar kernel.
+std::size_t stepScalar(const VehicleLanes& lanes, std::size_t begin, const StepFactors& factors) noexcept;
+std::size_t stepAvx2(const VehicleLanes& lanes, const StepFactors& factors) noexcept;
+std::size_t stepAvx512(const VehicleLanes& lanes, const StepFactors& factors) noexcept;
+
+} // namespace VehicleBatchKernels
+
+namespace {
+
+using namespace VehicleTuning;
+
+// Vehicle::calculateTurnRate
+template <class Ops>
+typename Ops::F batchTurnRate(typename Ops::F absoluteVelocity) noexcept {
+    using F = typename Ops::F;
+    const F v = absoluteVelocity;
+
+    const F speedRatio = Ops::div(Ops::sub(v, Ops::set(TURN_RATE_MEDIUM_SPEED)), Ops::set(MAX_SPEED - TURN_RATE_MEDIUM_SPEED));
+    F rate = Ops::sub(Ops::set(TURN_RATE_HIGH_SPEED_BASE), Ops::mul(speedRatio, Ops::set(TURN_RATE_HIGH_SPEED_REDUCTION)));
+    rate = Ops::min(Ops::max(rate, Ops::set(TURN_RATE_HIGH_SPEED_MIN)), Ops::set(TURN_RATE_HIGH_SPEED_MAX));
+
+    const F lowMedium = Ops::add(Ops::set(TURN_RATE_LOW_MEDIUM_BASE),
+        Ops::mul(Ops::div(Ops::sub(v, Ops::set(TURN_RATE_LOW_SPEED)), Ops::set(TURN_RATE_LOW_MEDIUM_DIVISOR)), Ops::set(TURN_RATE_LOW_MEDIUM_RANGE)));
+    rate = Ops::select(Ops::lt(v, Ops::set(TURN_RATE_MEDIUM_SPEED)), lowMedium, rate);
+
+    const F veryLow = Ops::add(Ops::set(TURN_RATE_VERY_LOW_BASE),
+        Ops::mul(Ops::div(Ops::sub(v, Ops::set(TURN_RATE_MIN_SPEED)), Ops::set(TURN_RATE_VERY_LOW_DIVISOR)), Ops::set(TURN_RATE_VERY_LOW_RANGE)));
+    rate = Ops::select(Ops::lt(v, Ops::set(TURN_RATE_LOW_SPEED)), veryLow, rate);
+
+    const F extremelyLow = Ops::add(Ops::set(TURN_RATE_EXTREMELY_LOW_BASE),
+        Ops::mul(Ops::div(Ops::sub(v, Ops::set(MIN_SPEED_THRESHOLD)), Ops::set(TURN_RATE_EXTREMELY_LOW_DIVISOR)), Ops::set(TURN_RATE_EXTREMELY_LOW_RANGE)));
+    rate = Ops::select(Ops::lt(v, Ops::set(TURN_RATE_MIN_SPEED)), extremelyLow, rate);
+
+    return Ops::select(Ops::lt(v, Ops::set(MIN_SPEED_THRESHOLD)), Ops::set(0.0f), rate);
+}
+
+// Per-gear lookup for gears 0..NUM_GEARS, where values[0] is used for reverse
+template <class Ops>
+typename Ops::F batchGearLookup(typename Ops::F gear, const float (&values)[NUM_GEARS + 1]) noexcept {
+    typename Ops::F result = Ops::set(values[NUM_GEARS]);
+    for (int g = NUM_GEARS - 1; g >= 0; --g) {
+        result = Ops::select(Ops::lt(gear, Ops::set(static_cast<float>(g) + 0.5f)), Ops::set(values[g]), result);
+    }
+    return result;
+}
+
+// Vehicle::turn on the lanes in mask
+template <class Ops>
+void batchTurn(typename Ops::M mask, float amount, typename Ops::F velocity, typename Ops::M drifting,
+               typename Ops::F& rotation, typename Ops::F& driftAngle, typename Ops::F& steeringInput) noexcept {
+    using F = typename Ops::F;
+
+    const F amountLanes = Ops::set(amount);
+    steeringInput = Ops::select(mask, amountLanes, steeringInput);
+
+    const F turnRate = batchTurnRate<Ops>(Ops::abs(velocity));
+    const F turnDirection = Ops::select(Ops::ge(velocity, Ops::set(0.0f)), Ops::set(1.0f), Ops::set(-1.0f));
+
+    const F turnAmount = Ops::mul(Ops::set(amount * TURN_SPEED), turnRate);
+    F newRotation = Ops::add(rotation, Ops::mul(turnAmount, turnDirection));
+
+    F newDrift = Ops::add(driftAngle, Ops::mul(Ops::mul(turnAmount, Ops::set(DRIFT_ANGLE_MULTIPLIER)), turnDirection));
+    newDrift = Ops::min(Ops::max(newDrift, Ops::set(-DRIFT_ANGLE_MAX_RADIANS)), Ops::set(DRIFT_ANGLE_MAX_RADIANS));
+    driftAngle = Ops::select(Ops::mand(mask, drifting), newDrift, driftAngle);
+
+    newRotation = Ops::fmod(newRotation, Ops::set(TWO_PI));
+    newRotation = Ops::select(Ops::lt(newRotation, Ops::set(0.0f)), Ops::add(newRotation, Ops::set(TWO_PI)), newRotation);
+    rotation = Ops::select(mask, newRotation, rotation);
+}
+
+template <class Ops>
+void stepLanesAt(const VehicleBatchKernels::VehicleLanes& l, std::size_t i,
+                 const VehicleBatchKernels::StepFactors& factors) noexcept {
+    using F = typename Ops::F;
+    using M = typename Ops::M;
+
+    const float deltaTime = factors.deltaTime;
+    const F zero = Ops::set(0.0f);
+    const F one = Ops::set(1.0f);
+    const F dt = Ops::set(deltaTime);
+
+    F velocity = Ops::load(l.velocity + i);
+    F rotation = Ops::load(l.rotation + i);
+    F steeringInput = Ops::load(l.steeringInput + i);
+    F driftAngle = Ops::load(l.driftAngle + i);
+    F nitrousTime = Ops::load(l.nitrousTimeRemaining + i);
+    F rpm = Ops::load(l.rpm + i);
+    F gear = Ops::loadInt(l.gear + i);
+    M drifting = Ops::loadMask(l.drifting + i);
+    M hasNitrous = Ops::loadMask(l.hasNitrous + i);
+    M nitrousActive = Ops::loadMask(l.nitrousActive + i);
+
+    const F throttle = Ops::load(l.throttle + i);
+    const M driftHeld = Ops::loadMask(l.driftHeld + i);
+    const M driftHeldPrevious = Ops::loadMask(l.driftHeldPrevious + i);
+    const M nitrousHeld = Ops::loadMask(l.nitrousHeld + i);
+    const M nitrousHeldPrevious = Ops::loadMask(l.nitrousHeldPrevious + i);
+
+    // --- applyControls ---
+
+    const F forwardAcceleration = Ops::mul(Ops::mul(
+        Ops::select(nitrousActive, Ops::set(NITROUS_ACCELERATION), Ops::set(FORWARD_ACCELERATION)),
+        batchGearLookup<Ops>(gear, {1.0f, GEAR_ACCELERATION_MULTIPLIERS[0], GEAR_ACCELERATION_MULTIPLIERS[1],
+                                    GEAR_ACCELERATION_MULTIPLIERS[2], GEAR_ACCELERATION_MULTIPLIERS[3]})),
+        Ops::load(l.accelMultiplier + i));
+    const F acceleration = Ops::select(Ops::gt(throttle, zero), forwardAcceleration,
+                                       Ops::select(Ops::lt(throttle, zero), Ops::set(BACKWARD_ACCELERATION), zero));
+
+    const M left = Ops::loadMask(l.turnLeft + i);
+    const M right = Ops::loadMask(l.turnRight + i);
+    if (Ops::any(left)) {
+        batchTurn<Ops>(left, deltaTime, velocity, drifting, rotation, driftAngle, steeringInput);
+    }
+    if (Ops::any(right)) {
+        batchTurn<Ops>(right, -deltaTime, velocity, drifting, rotation, driftAngle, steeringInput);
+    }
+
+    const M driftPressed = Ops::mand(driftHeld, Ops::mnot(driftHeldPrevious));
+    const M driftReleased = Ops::mand(Ops::mnot(driftHeld), driftHeldPrevious);
+    drifting = Ops::mor(driftPressed, Ops::mand(drifting, Ops::mnot(driftReleased)));
+    driftAngle = Ops::select(driftReleased, Ops::mul(driftAngle, Ops::set(DRIFT_EXIT_RETENTION)), driftAngle);
+
+    const M nitrousFired = Ops::mand(Ops::mand(nitrousHeld, Ops::mnot(nitrousHeldPrevious)),
+                                     Ops::mand(hasNitrous, Ops::mnot(nitrousActive)));
+    nitrousActive = Ops::mor(nitrousActive, nitrousFired);
+    nitrousTime = Ops::select(nitrousFired, Ops::set(NITROUS_DURATION), nitrousTime);
+    hasNitrous = Ops::mand(hasNitrous, Ops::mnot(nitrousFired));
+
+    // --- Vehicle::update ---
+
+    // updateNitrous
+    const F drainedNitrous = Ops::sub(nitrousTime, dt);
+    const M nitrousExpired = Ops::mand(nitrousActive, Ops::le(drainedNitrous, zero));
+    nitrousTime = Ops::select(nitrousActive, drainedNitrous, nitrousTime);
+    nitrousTime = Ops::select(nitrousExpired, zero, nitrousTime);
+    nitrousActive = Ops::mand(nitrousActive, Ops::mnot(nitrousExpired));
+
+    // updateGearShifting
+    F absoluteVelocity = Ops::abs(velocity);
+    F shifted = Ops::set(static_cast<float>(NUM_GEARS));
+    for (int g = NUM_GEARS; g >= 1; --g) {
+        shifted = Ops::select(Ops::lt(absoluteVelocity, Ops::set(GEAR_SPEEDS[g])), Ops::set(static_cast<float>(g)), shifted);
+    }
+    shifted = Ops::select(Ops::lt(absoluteVelocity, Ops::set(MIN_SPEED_THRESHOLD)), one, shifted);
+    gear = Ops::select(Ops::lt(velocity, zero), zero, shifted);
+
+    // updateVelocity
+    velocity = Ops::add(velocity, Ops::mul(acceleration, dt));
+
+    F speedRatio = Ops::div(Ops::abs(velocity), Ops::set(MAX_SPEED));
+    speedRatio = Ops::min(Ops::max(speedRatio, Ops::set(FRICTION_MIN_CLAMP)), one);
+    const F logValue = Ops::log(speedRatio);
+    F frictionMultiplier = Ops::add(Ops::set(FRICTION_BASE_VALUE),
+        Ops::mul(Ops::div(Ops::add(logValue, Ops::set(FRICTION_LOG_OFFSET)), Ops::set(FRICTION_LOG_OFFSET)),
+                 Ops::set(FRICTION_COEFFICIENT - FRICTION_BASE_VALUE)));
+    frictionMultiplier = Ops::min(Ops::max(frictionMultiplier, Ops::set(FRICTION_BASE_VALUE)), Ops::set(FRICTION_COEFFICIENT));
+
+    velocity = Ops::mul(velocity, Ops::select(drifting, Ops::set(factors.driftFriction),
+                                              Ops::pow(frictionMultiplier, factors.decayExponent)));
+    const F currentMaxSpeed = Ops::select(nitrousActive, Ops::set(NITROUS_MAX_SPEED), Ops::set(MAX_SPEED));
+    velocity = Ops::min(Ops::max(velocity, Ops::set(-MAX_REVERSE_SPEED)), currentMaxSpeed);
+
+    // updateRPM; reverse gear keeps its last RPM just like Vehicle
+    absoluteVelocity = Ops::abs(velocity);
+    const F gearMinSpeed = batchGearLookup<Ops>(gear,
+        {GEAR_SPEEDS[0], GEAR_SPEEDS[0], GEAR_SPEEDS[1], GEAR_SPEEDS[2], GEAR_SPEEDS[3]});
+    const F gearMaxSpeed = batchGearLookup<Ops>(gear,
+        {GEAR_SPEEDS[1], GEAR_SPEEDS[1], GEAR_SPEEDS[2], GEAR_SPEEDS[3], GEAR_SPEEDS[4]});
+    F gearRatio = Ops::div(Ops::sub(absoluteVelocity, gearMinSpeed), Ops::sub(gearMaxSpeed, gearMinSpeed));
+    gearRatio = Ops::min(Ops::max(gearRatio, zero), one);
+    const F gearRpm = Ops::add(Ops::set(GEAR_SHIFT_DOWN_RPM), Ops::mul(gearRatio, Ops::set(MAX_RPM - GEAR_SHIFT_DOWN_RPM)));
+    rpm = Ops::select(Ops::gt(gear, Ops::set(0.5f)), gearRpm, rpm);
+    rpm = Ops::select(Ops::lt(absoluteVelocity, Ops::set(MIN_SPEED_THRESHOLD)), Ops::set(IDLE_RPM), rpm);
+
+    // updateDrift
+    driftAngle = Ops::select(drifting, Ops::mul(driftAngle, Ops::set(factors.driftDecay)), driftAngle);
+
+    // updatePosition
+    const F movementAngle = Ops::select(drifting, Ops::sub(rotation, driftAngle), rotation);
+    F sinAngle;
+    F cosAngle;
+    Ops::sincos(movementAngle, sinAngle, cosAngle);
+    Ops::store(l.positionX + i, Ops::add(Ops::load(l.positionX + i), Ops::mul(Ops::mul(sinAngle, velocity), dt)));
+    Ops::store(l.positionZ + i, Ops::add(Ops::load(l.positionZ + i), Ops::mul(Ops::mul(cosAngle, velocity), dt)));
+
+    // decayAcceleration
+    steeringInput = Ops::mul(steeringInput, Ops::set(factors.steeringDecay));
+    steeringInput = Ops::select(Ops::lt(Ops::abs(steeringInput), Ops::set(STEERING_ZERO_THRESHOLD)), zero, steeringInput);
+
+    Ops::store(l.velocity + i, velocity);
+    Ops::store(l.rotation + i, rotation);
+    Ops::store(l.steeringInput + i, steeringInput);
+    Ops::store(l.driftAngle + i, driftAngle);
+    Ops::store(l.nitrousTimeRemaining + i, nitrousTime);
+    Ops::store(l.rpm + i, rpm);
+    Ops::storeInt(l.gear + i, gear);
+    Ops::storeMask(l.drifting + i, drifting);
+    Ops::storeMask(l.hasNitrous + i, hasNitrous);
+    Ops::storeMask(l.nitrousActive + i, nitrousActive);
+    Ops::storeMask(l.driftHeldPrevious + i, driftHeld);
+    Ops::storeMask(l.nitrousHeldPrevious + i, nitrousHeld);
+}
+
+// Step whole groups of Ops::WIDTH lanes starting at begin, returns where it stopped
+template <class Ops>
+std::size_t stepLanes(const VehicleBatchKernels::VehicleLanes& lanes, std::size_t begin,
+                      const VehicleBatchKernels::StepFactors& factors) noexcept {
+    std::size_t i = begin;
+    for (; i + Ops::WIDTH <= lanes.count; i += Ops::WIDTH) {
+        stepLanesAt<Ops>(lanes, i, factors);
+    }
+    return i;
+}
+
+} // namespace
@@ -0,0 +1,199 @@
+#include "core/vehicle_manager.hpp"
+#include "core/game_config.hpp"
+#include "core/logger.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Vehicles per job; fewer than one chunk run inline, so small fleets pay nothing
+    constexpr std::size_t UPDATE_CHUNK_SIZE = 64;
+    constexpr std::size_t COLLISION_CHUNK_SIZE = 16;  // Obstacle queries cost more per vehicle
+
+    // Equal masses: each car takes half the overlap and half the impulse. The cars only have a
+    // speed along their direction of travel, so each keeps the part of its change along that.
+    void separate(Vehicle& first, Vehicle& second, float overlap, float normalX, float normalZ) noexcept {
+        const float push = (std::max)(overlap - GameConfig::Collision::PENETRATION_SLOP, 0.0f) * 0.5f;
+        if (push > 0.0f) {
+            const auto& firstPos = first.getPosition();
+            first.setPosition(firstPos[0] - normalX * push, firstPos[1], firstPos[2] - normalZ * push);
+            const auto& secondPos = second.getPosition();
+            second.setPosition(secondPos[0] + normalX * push, secondPos[1], secondPos[2] + normalZ * push);
+        }
+
+        // Direction of travel projected on the normal, which points from first to second
+        const float firstAlong = std::sin(first.getMovementAngle()) * normalX + std::cos(first.getMovementAngle()) * normalZ;
+        const float secondAlong = std::sin(second.getMovementAngle()) * normalX + std::cos(second.getMovementAngle()) * normalZ;
+        const float approachSpeed = second.getVelocity() * secondAlong - first.getVelocity() * firstAlong;
+        if (approachSpeed >= 0.0f) {
+            return;  // Already moving apart
+        }
+
+        const float restitution = approachSpeed < -GameConfig::Collision::RESTITUTION_MIN_SPEED
+            ? GameConfig::Collision::RESTITUTION
+            : 0.0f;
+        const float impulse = -(1.0f + restitution) * approachSpeed * 0.5f;
+        first.setVelocity(first.getVelocity() - impulse * firstAlong);
+        second.setVelocity(second.getVelocity() + impulse * secondAlong);
+    }
+}
+
+VehicleManager::VehicleManager(JobSystem& jobs)
+    : jobs_(jobs) {
+}
+
+std::size_t VehicleManager::add(float x, float y, float z) {
+    const auto index = static_cast<std::uint32_t>(vehicles_.size());
+    vehicles_.push_back(std::make_unique<Vehicle>(x, y, z));
+    controls_.emplace_back();
+    previousControls_.emplace_back();
+    contactSolvers_.emplace_back();
+
+    // Sorted into place by the next update
+    endpoints_.push_back({x, index << 1});
+    endpoints_.push_back({x, (index << 1) | 1u});
+    minZ_.push_back(z);
+    maxZ_.push_back(z);
+    return index;
+}
+
+void VehicleManager::reserve(std::size_t count) {
+    vehicles_.reserve(count);
+    controls_.reserve(count);
+    previousControls_.reserve(count);
+    contactSolvers_.reserve(count);
+    endpoints_.reserve(count * 2);
+    minZ_.reserve(count);
+    maxZ_.reserve(count);
+}
+
+void VehicleManager::setControls(std::size_t index, const ControlState& controls) noexcept {
+    controls_[index] = controls;
+    controls_[index].reset = false;
+}
+
+void VehicleManager::update(float deltaTime) {
+    jobs_.parallelFor("Update vehicles", vehicles_.size(), UPDATE_CHUNK_SIZE, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            Vehicle& vehicle = *vehicles_[i];
+            applyControls(vehicle, controls_[i], previousControls_[i], deltaTime);
+            previousControls_[i] = controls_[i];
+
+            vehicle.storePreviousTransform();
+            vehicle.update(deltaTime);
+        }
+    });
+}
+
+void VehicleManager::handleObstacleCollisions(const ObstacleManager& obstacles, float deltaTime) {
+    // Scratch per chunk, not per thread: a thread waiting on its jobs may pick up another
+    // caller's, so only the chunk is sure to be the scratch's single user
+    obstacleScratch_.resize((vehicles_.size() + COLLISION_CHUNK_SIZE - 1) / COLLISION_CHUNK_SIZE);
+    jobs_.parallelFor("Vehicle obstacle collisions", vehicles_.size(), COLLISION_CHUNK_SIZE,
+                      [&](std::size_t begin, std::size_t end) {
+        ObstacleManager::CollisionScratch& scratch = obstacleScratch_[begin / COLLISION_CHUNK_SIZE];
+        for (std::size_t i = begin; i < end; ++i) {
+            obstacles.handleCollisions(*vehicles_[i], deltaTime, contactSolvers_[i], scratch);
+        }
+    });
+}
+
+void VehicleManager::updateBroadphase() {
+    maxSpan_ = 0.0f;
+    for (std::size_t i = 0; i < vehicles_.size(); ++i) {
+        const float radius = vehicles_[i]->getCollisionRadius();
+        minZ_[i] = vehicles_[i]->getPosition()[2] - radius;
+        maxZ_[i] = vehicles_[i]->getPosition()[2] + radius;
+        maxSpan_ = (std::max)(maxSpan_, 2.0f * radius);
+    }
+    for (Endpoint& endpoint : endpoints_) {
+        const Vehicle& vehicle = *vehicles_[endpoint.vehicle()];
+        const float radius = vehicle.getCollisionRadius();
+        endpoint.value = endpoint.isMax() ? vehicle.getPosition()[0] + radius : vehicle.getPosition()[0] - radius;
+    }
+
+    // Insertion sort: linear in the number of endpoints plus the swaps, and only cars that
+    // passed each other on x since the last tick swap. Strict comparison keeps it stable, so a
+    // car's min endpoint stays ahead of its max.
+    swapCount_ = 0;
+    for (std::size_t i = 1; i < endpoints_.size(); ++i) {
+        const Endpoint endpoint = endpoints_[i];
+        std::size_t j = i;
+        for (; j > 0 && endpoints_[j - 1].value > endpoint.value; --j) {
+            endpoints_[j] = endpoints_[j - 1];
+        }
+        endpoints_[j] = endpoint;
+        swapCount_ += i - j;
+    }
+}
+
+void VehicleManager::findPairs() {
+    pairs_.clear();
+    active_.clear();
+
+    // Walk the endpoints in order, keeping the cars whose x interval contains the current one
+    for (const Endpoint& endpoint : endpoints_) {
+        const std::uint32_t index = endpoint.vehicle();
+        if (endpoint.isMax()) {
+            const auto it = std::find(active_.begin(), active_.end(), index);
+            *it = active_.back();
+            active_.pop_back();
+            continue;
+        }
+
+        for (const std::uint32_t other : active_) {
+            if (minZ_[index] <= maxZ_[other] && minZ_[other] <= maxZ_[index]) {
+                pairs_.push_back({(std::min)(index, other), (std::max)(index, other)});
+            }
+        }
+        active_.push_back(index);
+    }
+}
+
+void VehicleManager::resolveCollisions() {
+    updateBroadphase();
+    findPairs();
+
+    for (const auto& [first, second] : pairs_) {
+        float overlapDistance, normalX, normalZ;
+        if (vehicles_[first]->checkCircleCollision(*vehicles_[second], overlapDistance, normalX, normalZ)) {
+            separate(*vehicles_[first], *vehicles_[second], overlapDistance, normalX, normalZ);
+        }
+    }
+}
+
+void VehicleManager::handleCollisions(Vehicle& vehicle) {
+    if (vehicles_.empty()) {
+        return;
+    }
+    updateBroadphase();
+
+    const auto& position = vehicle.getPosition();
+    const float radius = vehicle.getCollisionRadius();
+    const float minX = position[0] - radius;
+    const float maxX = position[0] + radius;
+
+    // An interval that starts more than the widest span before minX ends before it too
+    auto it = std::lower_bound(endpoints_.begin(), endpoints_.end(), minX - maxSpan_,
+                               [](const Endpoint& endpoint, float value) { return endpoint.value < value; });
+    for (; it != endpoints_.end() && it->value <= maxX; ++it) {
+        const std::uint32_t index = it->vehicle();
+        if (it->isMax() || minZ_[index] > position[2] + radius || maxZ_[index] < position[2] - radius) {
+            continue;
+        }
+
+        float overlapDistance, normalX, normalZ;
+        if (vehicle.checkCircleCollision(*vehicles_[index], overlapDistance, normalX, normalZ)) {
+            separate(vehicle, *vehicles_[index], overlapDistance, normalX, normalZ);
+            CARSIM_LOG_DEBUG(Logger::Tag::COLLISION, "Vehicle hit vehicle ", index, ", now at ", vehicle.getVelocity(), " m/s");
+        }
+    }
+}
+
+void VehicleManager::reset() noexcept {
+    for (std::size_t i = 0; i < vehicles_.size(); ++i) {
+        vehicles_[i]->reset();
+        controls_[i] = ControlState{};
+        previousControls_[i] = ControlState{};
+        contactSolvers_[i].clear();
+    }
+}
@@ -4,8 +4,9 @@
 using namespace threepp;
 
 
-GameObjectRenderer::GameObjectRenderer(Scene &scene, const GameObject &gameObject)
+GameObjectRenderer::GameObjectRenderer(Scene &scene, RenderResourceCache &resources, const GameObject &gameObject)
     : scene_(scene),
+      resources_(resources),
       gameObject_(gameObject) {
     objectGroup_ = std::make_shared<Group>();
     scene_.add(objectGroup_);
@@ -21,9 +22,8 @@ void GameObjectRenderer::createModel() {
     std::array<float, 3> size = gameObject_.getSize();
 
     // Create simple box geometry by default
-    auto geometry = BoxGeometry::create(size[0], size[1], size[2]);
-    auto material = MeshPhongMaterial::create();
-    material->color = Color::white;
+    auto geometry = resources_.box(size[0], size[1], size[2]);
+    auto material = resources_.phongMaterial(0xffffff);
 
     bodyMesh_ = Mesh::create(geometry, material);
     bodyMesh_->position.y = size[1] / 2.0f; // Half height - positions box so bottom sits at y=0
@@ -33,13 +33,27 @@ void GameObjectRenderer::createModel() {
 }
 
 void GameObjectRenderer::update() {
+    if (synced_ && gameObject_.getVersion() == syncedVersion_) {
+        return;
+    }
+    synced_ = true;
+    syncedVersion_ = gameObject_.getVersion();
+
     // Sync visual representation with game object
-    std::array<float, 3> position = gameObject_.getPosition();
-    objectGroup_->position.set(position[0], position[1], position[2]);
-    objectGroup_->rotation.y = gameObject_.getRotation();
+    syncTransform({gameObject_.getPosition(), gameObject_.getRotation()});
 
     // Handle active/inactive state
     objectGroup_->visible = gameObject_.isActive();
+
+    // This is the explicit change: bake the new transform
+    if (isStatic_) {
+        freezeTransforms(*objectGroup_);
+    }
+}
+
+void GameObjectRenderer::syncTransform(const TransformState& transform) {
+    objectGroup_->position.set(transform.position[0], transform.position[1], transform.position[2]);
+    objectGroup_->rotation.y = transform.rotation;
 }
 
 void GameObjectRenderer::setVisible(bool visible) {
@@ -47,3 +61,30 @@ void GameObjectRenderer::setVisible(bool visible) {
         objectGroup_->visible = visible;
     }
 }
+
+void GameObjectRenderer::setStatic(bool isStatic) {
+    isStatic_ = isStatic;
+    if (isStatic_) {
+        freezeTransforms(*objectGroup_);
+    } else {
+        thawTransforms(*objectGroup_);
+    }
+}
+
+std::size_t GameObjectRenderer::freezeTransforms(Object3D& root) {
+    std::size_t count = 0;
+    root.traverse([&count](Object3D& node) {
+        node.matrixAutoUpdate = false;
+        node.updateMatrix();
+        ++count;
+    });
+    // Frozen nodes never flag themselves, so push the new world matrices down by hand
+    root.updateMatrixWorld(true);
+    return count;
+}
+
+void GameObjectRenderer::thawTransforms(Object3D& root) {
+    root.traverse([](Object3D& node) {
+        node.matrixAutoUpdate = true;
+    });
+}
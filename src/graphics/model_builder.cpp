@@ -0,0 +1,73 @@
+#include "graphics/model_builder.hpp"
+
+using namespace threepp;
+
+namespace {
+    // Shared fallback for parts whose material index is out of range
+    constexpr unsigned int MISSING_MATERIAL_COLOR = 0xffffff;
+}
+
+std::vector<std::shared_ptr<BufferGeometry>> ModelBuilder::createGeometries(const MeshData& mesh) {
+    std::vector<std::shared_ptr<BufferGeometry>> geometries;
+    geometries.reserve(mesh.parts.size());
+
+    for (const MeshPart& part : mesh.parts) {
+        auto geometry = BufferGeometry::create();
+        geometry->setAttribute("position", FloatBufferAttribute::create(part.positions, 3));
+        if (!part.normals.empty()) {
+            geometry->setAttribute("normal", FloatBufferAttribute::create(part.normals, 3));
+        } else {
+            geometry->computeVertexNormals();
+        }
+        if (!part.uvs.empty()) {
+            geometry->setAttribute("uv", FloatBufferAttribute::create(part.uvs, 2));
+        }
+        geometries.push_back(std::move(geometry));
+    }
+    return geometries;
+}
+
+std::vector<std::shared_ptr<Material>> ModelBuilder::createMaterials(const MeshData& mesh) {
+    std::vector<std::shared_ptr<Material>> materials;
+    materials.reserve(mesh.materials.size());
+
+    for (const MeshMaterial& source : mesh.materials) {
+        auto material = MeshPhongMaterial::create();
+        material->name = source.name;
+        material->color.setRGB(source.diffuse[0], source.diffuse[1], source.diffuse[2]);
+        material->specular.setRGB(source.specular[0], source.specular[1], source.specular[2]);
+        material->emissive.setRGB(source.emissive[0], source.emissive[1], source.emissive[2]);
+        material->shininess = source.shininess;
+        material->opacity = source.opacity;
+        material->transparent = source.opacity < 1.0f;
+        materials.push_back(std::move(material));
+    }
+    return materials;
+}
+
+std::shared_ptr<Group> ModelBuilder::buildGroup(const MeshData& mesh,
+                                                const std::vector<std::shared_ptr<BufferGeometry>>& geometries,
+                                                const std::vector<std::shared_ptr<Material>>& materials) {
+    auto group = Group::create();
+    std::shared_ptr<Material> fallback;
+
+    for (std::size_t i = 0; i < mesh.parts.size() && i < geometries.size(); ++i) {
+        const MeshPart& part = mesh.parts[i];
+        std::shared_ptr<Material> material;
+        if (part.materialIndex < materials.size()) {
+            material = materials[part.materialIndex];
+        } else {
+            if (!fallback) {
+                auto phong = MeshPhongMaterial::create();
+                phong->color = Color(MISSING_MATERIAL_COLOR);
+                fallback = phong;
+            }
+            material = fallback;
+        }
+
+        auto child = Mesh::create(geometries[i], material);
+        child->name = part.name;
+        group->add(child);
+    }
+    return group;
+}
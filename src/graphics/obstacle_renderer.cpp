@@ -1,5 +1,10 @@
 #include "graphics/obstacle_renderer.hpp"
 #include "core/game_config.hpp"
+#include "graphics/game_object_renderer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
 
 using namespace threepp;
 
@@ -15,66 +20,295 @@ namespace {
     constexpr float TREE_FOLIAGE_RADIUS = 2.0f;
     constexpr unsigned int TRUNK_COLOR = 0x8B4513;
     constexpr unsigned int FOLIAGE_COLOR = 0x228B22;
-}
+    constexpr float TREE_FOLIAGE_HEIGHT = TREE_TRUNK_HEIGHT + TREE_FOLIAGE_RADIUS * 0.5f;  // Sphere centre
+    constexpr float TREE_CENTER_HEIGHT = (TREE_FOLIAGE_HEIGHT + TREE_FOLIAGE_RADIUS) * 0.5f;
+    constexpr float TREE_BOUNDING_RADIUS = TREE_CENTER_HEIGHT;  // Reaches from the ground to the crown
+
+    // Walls are merged per square chunk of the map so off-screen chunks get culled
+    constexpr float WALL_CHUNK_SIZE = 50.0f;
+
+    // Tree detail by distance from the camera
+    constexpr float TREE_FULL_DETAIL_DISTANCE = 35.0f;
+    constexpr float TREE_LOW_DETAIL_DISTANCE = 80.0f;
+    constexpr float TREE_BILLBOARD_DISTANCE = 250.0f;  // Not drawn beyond
+    constexpr float TREE_LOD_HYSTERESIS = 0.1f;
+    constexpr unsigned int LOW_DETAIL_TRUNK_SEGMENTS = 6;
+    constexpr unsigned int LOW_DETAIL_FOLIAGE_SEGMENTS = 8;
+    constexpr unsigned int BILLBOARD_FOLIAGE_SEGMENTS = 8;
+    constexpr float BILLBOARD_FOLIAGE_OFFSET = 0.02f;  // In front of the trunk quad, avoids z-fighting
+
+    struct MergedGeometry {
+        std::vector<float> positions;
+        std::vector<float> normals;
+        std::vector<unsigned int> indices;
+    };
+
+    // Append a copy of source moved by (x, y, z)
+    void appendTranslated(MergedGeometry& merged, BufferGeometry& source, float x, float y, float z) {
+        const auto firstVertex = static_cast<unsigned int>(merged.positions.size() / 3);
+
+        const auto& positions = source.getAttribute<float>("position")->array();
+        for (std::size_t i = 0; i < positions.size(); i += 3) {
+            merged.positions.push_back(positions[i] + x);
+            merged.positions.push_back(positions[i + 1] + y);
+            merged.positions.push_back(positions[i + 2] + z);
+        }
+
+        const auto& normals = source.getAttribute<float>("normal")->array();
+        merged.normals.insert(merged.normals.end(), normals.begin(), normals.end());
+
+        for (const auto index : source.getIndex()->array()) {
+            merged.indices.push_back(firstVertex + static_cast<unsigned int>(index));
+        }
+    }
+
+    std::shared_ptr<InstancedMesh> createInstances(const std::shared_ptr<BufferGeometry>& geometry,
+                                                   const std::shared_ptr<Material>& material,
+                                                   const std::vector<const Obstacle*>& obstacles, float heightOffset) {
+        auto mesh = InstancedMesh::create(geometry, material, obstacles.size());
+        Matrix4 matrix;
+        for (std::size_t i = 0; i < obstacles.size(); ++i) {
+            const auto& position = obstacles[i]->getPosition();
+            matrix.makeTranslation(position[0], position[1] + heightOffset, position[2]);
+            mesh->setMatrixAt(i, matrix);
+        }
+        mesh->instanceMatrix()->needsUpdate();
+
+        // Bounds come from a single instance, so culling the whole batch by them would be wrong
+        mesh->frustumCulled = false;
+        mesh->castShadow = true;
+        mesh->receiveShadow = true;
+        return mesh;
+    }
 
-ObstacleRenderer::ObstacleRenderer(Scene& scene, const Obstacle& obstacle)
-    : GameObjectRenderer(scene, obstacle), obstacle_(obstacle) {
-    createModel();
+    // Room for every tree, filled by ObstacleRenderer::update; shadows come from the proxies
+    std::shared_ptr<InstancedMesh> createLodInstances(const std::shared_ptr<BufferGeometry>& geometry,
+                                                      const std::shared_ptr<Material>& material, std::size_t capacity) {
+        auto mesh = InstancedMesh::create(geometry, material, capacity);
+        mesh->setCount(0);
+        mesh->frustumCulled = false;
+        mesh->castShadow = false;
+        mesh->receiveShadow = true;
+        return mesh;
+    }
+
+    void appendQuad(std::vector<float>& positions, float left, float right, float bottom, float top, float z) {
+        const float corners[6][2] = {{left, bottom}, {right, bottom}, {right, top},
+                                     {left, bottom}, {right, top}, {left, top}};
+        for (const auto& corner : corners) {
+            positions.insert(positions.end(), {corner[0], corner[1], z});
+        }
+    }
 }
 
-void ObstacleRenderer::createModel() {
-    if (obstacle_.getType() == ObstacleType::WALL) {
-        createWallMesh();
-    } else if (obstacle_.getType() == ObstacleType::TREE) {
-        createTreeMesh();
+ObstacleRenderer::ObstacleRenderer(Scene& scene, RenderResourceCache& resources, const ObstacleManager& obstacles)
+    : scene_(scene),
+      resources_(resources),
+      obstacles_(obstacles),
+      objectGroup_(std::make_shared<Group>()),
+      shadowProxyGroup_(std::make_shared<Group>()),
+      treeLod_({TREE_FULL_DETAIL_DISTANCE, TREE_LOW_DETAIL_DISTANCE, TREE_BILLBOARD_DISTANCE}, TREE_LOD_HYSTERESIS) {
+    std::vector<const Obstacle*> walls;
+    std::vector<const Obstacle*> trees;
+    for (const auto& obstacle : obstacles.getObstacles()) {
+        if (obstacle->getType() == ObstacleType::WALL) {
+            walls.push_back(obstacle.get());
+        } else if (obstacle->getType() == ObstacleType::TREE) {
+            trees.push_back(obstacle.get());
+        }
     }
+    treeLevels_.assign(obstacles.getObstacles().size(), treeLod_.getCulledLevel());
+
+    createWallMeshes(walls);
+    createTreeMeshes(trees);
+    scene_.add(objectGroup_);
+    scene_.add(shadowProxyGroup_);
+
+    // Trees move per instance, never as nodes
+    GameObjectRenderer::freezeTransforms(*objectGroup_);
+    GameObjectRenderer::freezeTransforms(*shadowProxyGroup_);
 }
 
-void ObstacleRenderer::createWallMesh() {
-    auto orientation = obstacle_.getOrientation();
+ObstacleRenderer::~ObstacleRenderer() {
+    scene_.remove(*shadowProxyGroup_);
+    scene_.remove(*objectGroup_);
+}
 
-    std::shared_ptr<threepp::BoxGeometry> geometry;
-    if (orientation == WallOrientation::HORIZONTAL) {
-        geometry = BoxGeometry::create(WALL_WIDTH, WALL_HEIGHT, WALL_DEPTH);
-    } else {
-        geometry = BoxGeometry::create(WALL_DEPTH, WALL_HEIGHT, WALL_WIDTH);
+void ObstacleRenderer::createWallMeshes(const std::vector<const Obstacle*>& walls) {
+    if (walls.empty()) {
+        return;
     }
 
-    auto material = MeshPhongMaterial::create();
-    material->color = Color(WALL_COLOR);
+    // Walls never move, so bake the segments of each chunk into one vertex buffer
+    auto horizontal = resources_.box(WALL_WIDTH, WALL_HEIGHT, WALL_DEPTH);
+    auto vertical = resources_.box(WALL_DEPTH, WALL_HEIGHT, WALL_WIDTH);
 
-    auto wallMesh = Mesh::create(geometry, material);
-    wallMesh->castShadow = true;
-    wallMesh->receiveShadow = true;
+    std::map<std::pair<int, int>, MergedGeometry> chunks;
+    for (const Obstacle* wall : walls) {
+        const auto& position = wall->getPosition();
+        const std::pair<int, int> chunk{static_cast<int>(std::floor(position[0] / WALL_CHUNK_SIZE)),
+                                        static_cast<int>(std::floor(position[2] / WALL_CHUNK_SIZE))};
+        auto& box = wall->getOrientation() == WallOrientation::HORIZONTAL ? *horizontal : *vertical;
+        appendTranslated(chunks[chunk], box, position[0], position[1], position[2]);
+    }
+
+    const auto material = resources_.phongMaterial(WALL_COLOR);
+    for (const auto& [chunk, merged] : chunks) {
+        auto geometry = BufferGeometry::create();
+        geometry->setAttribute("position", FloatBufferAttribute::create(merged.positions, 3));
+        geometry->setAttribute("normal", FloatBufferAttribute::create(merged.normals, 3));
+        geometry->setIndex(merged.indices);
+        geometry->computeBoundingSphere();
 
-    objectGroup_->add(wallMesh);
+        // Default frustum culling works here: the bounds cover just this chunk
+        auto wallMesh = Mesh::create(geometry, material);
+        wallMesh->castShadow = true;
+        wallMesh->receiveShadow = true;
+        objectGroup_->add(wallMesh);
+    }
 }
 
-void ObstacleRenderer::createTreeMesh() {
-    // Trunk
-    auto trunkGeometry = CylinderGeometry::create(TREE_TRUNK_RADIUS, TREE_TRUNK_RADIUS, TREE_TRUNK_HEIGHT);
-    auto trunkMaterial = MeshPhongMaterial::create();
-    trunkMaterial->color = Color(TRUNK_COLOR);
-
-    auto trunkMesh = Mesh::create(trunkGeometry, trunkMaterial);
-    trunkMesh->position.y = TREE_TRUNK_HEIGHT / 2.0f;
-    trunkMesh->castShadow = true;
-    trunkMesh->receiveShadow = true;
-
-    // Foliage on top
-    auto foliageGeometry = SphereGeometry::create(TREE_FOLIAGE_RADIUS);
-    auto foliageMaterial = MeshPhongMaterial::create();
-    foliageMaterial->color = Color(FOLIAGE_COLOR);
-
-    auto foliageMesh = Mesh::create(foliageGeometry, foliageMaterial);
-    foliageMesh->position.y = TREE_TRUNK_HEIGHT + TREE_FOLIAGE_RADIUS * 0.5f;
-    foliageMesh->castShadow = true;
-    foliageMesh->receiveShadow = true;
-
-    objectGroup_->add(trunkMesh);
-    objectGroup_->add(foliageMesh);
+void ObstacleRenderer::createTreeMeshes(const std::vector<const Obstacle*>& trees) {
+    if (trees.empty()) {
+        return;
+    }
+
+    const auto trunkMaterial = resources_.phongMaterial(TRUNK_COLOR);
+    const auto foliageMaterial = resources_.phongMaterial(FOLIAGE_COLOR);
+    const auto lowTrunkGeometry = resources_.cylinder(TREE_TRUNK_RADIUS, TREE_TRUNK_RADIUS, TREE_TRUNK_HEIGHT,
+                                                      LOW_DETAIL_TRUNK_SEGMENTS);
+    const auto lowFoliageGeometry = resources_.sphere(TREE_FOLIAGE_RADIUS, LOW_DETAIL_FOLIAGE_SEGMENTS);
+
+    treeMeshes_[0] = {
+        createLodInstances(resources_.cylinder(TREE_TRUNK_RADIUS, TREE_TRUNK_RADIUS, TREE_TRUNK_HEIGHT),
+                           trunkMaterial, trees.size()),
+        createLodInstances(resources_.sphere(TREE_FOLIAGE_RADIUS), foliageMaterial, trees.size())
+    };
+    treeMeshes_[1] = {
+        createLodInstances(lowTrunkGeometry, trunkMaterial, trees.size()),
+        createLodInstances(lowFoliageGeometry, foliageMaterial, trees.size())
+    };
+    for (const auto& meshes : treeMeshes_) {
+        objectGroup_->add(meshes.trunk);
+        objectGroup_->add(meshes.foliage);
+    }
+
+    // Camera-facing cut-outs for the far trees, coloured per vertex so one draw covers both parts
+    auto billboardMaterial = MeshLambertMaterial::create();
+    billboardMaterial->vertexColors = true;
+    treeBillboards_ = createLodInstances(createBillboardGeometry(), billboardMaterial, trees.size());
+    treeBillboards_->receiveShadow = false;
+    objectGroup_->add(treeBillboards_);
+
+    // Every tree at low detail for the shadow map, whichever level is drawn
+    shadowProxyGroup_->add(createInstances(lowTrunkGeometry, trunkMaterial, trees, TREE_TRUNK_HEIGHT / 2.0f));
+    shadowProxyGroup_->add(createInstances(lowFoliageGeometry, foliageMaterial, trees, TREE_FOLIAGE_HEIGHT));
+}
+
+std::shared_ptr<BufferGeometry> ObstacleRenderer::createBillboardGeometry() const {
+    std::vector<float> positions;
+    appendQuad(positions, -TREE_TRUNK_RADIUS, TREE_TRUNK_RADIUS, 0.0f, TREE_TRUNK_HEIGHT, 0.0f);
+    const std::size_t trunkVertices = positions.size() / 3;
+
+    // Foliage disc as a triangle fan
+    const float step = 2.0f * math::PI / static_cast<float>(BILLBOARD_FOLIAGE_SEGMENTS);
+    for (unsigned int i = 0; i < BILLBOARD_FOLIAGE_SEGMENTS; ++i) {
+        const float a0 = step * static_cast<float>(i);
+        const float a1 = step * static_cast<float>(i + 1);
+        positions.insert(positions.end(), {
+            0.0f, TREE_FOLIAGE_HEIGHT, BILLBOARD_FOLIAGE_OFFSET,
+            TREE_FOLIAGE_RADIUS * std::cos(a0), TREE_FOLIAGE_HEIGHT + TREE_FOLIAGE_RADIUS * std::sin(a0), BILLBOARD_FOLIAGE_OFFSET,
+            TREE_FOLIAGE_RADIUS * std::cos(a1), TREE_FOLIAGE_HEIGHT + TREE_FOLIAGE_RADIUS * std::sin(a1), BILLBOARD_FOLIAGE_OFFSET
+        });
+    }
+
+    const std::size_t vertexCount = positions.size() / 3;
+    std::vector<float> normals;
+    std::vector<float> colors;
+    normals.reserve(positions.size());
+    colors.reserve(positions.size());
+    const Color trunkColor(TRUNK_COLOR);
+    const Color foliageColor(FOLIAGE_COLOR);
+    for (std::size_t i = 0; i < vertexCount; ++i) {
+        const Color& color = i < trunkVertices ? trunkColor : foliageColor;
+        normals.insert(normals.end(), {0.0f, 0.0f, 1.0f});
+        colors.insert(colors.end(), {color.r, color.g, color.b});
+    }
+
+    auto geometry = BufferGeometry::create();
+    geometry->setAttribute("position", FloatBufferAttribute::create(positions, 3));
+    geometry->setAttribute("normal", FloatBufferAttribute::create(normals, 3));
+    geometry->setAttribute("color", FloatBufferAttribute::create(colors, 3));
+    return geometry;
 }
 
-void ObstacleRenderer::update() {
-    GameObjectRenderer::update();
+void ObstacleRenderer::update(Camera& camera, bool frustumCull) {
+    if (!treeBillboards_) {
+        return;
+    }
+
+    camera.updateMatrixWorld();
+    Matrix4 viewProjection;
+    viewProjection.multiplyMatrices(camera.projectionMatrix, camera.matrixWorldInverse);
+    Frustum frustum;
+    frustum.setFromProjectionMatrix(viewProjection);
+
+    // Only the grid cells within drawing range are visited
+    const Vector3 eye = camera.position;
+    const float range = treeLod_.getMaxDistance();
+    nearby_.swap(previousNearby_);
+    obstacles_.queryBox(eye.x - range, eye.z - range, eye.x + range, eye.z + range, nearby_);
+
+    // Trees that left the range start over when they come back; both lists are ascending
+    const std::uint8_t culled = treeLod_.getCulledLevel();
+    auto current = nearby_.begin();
+    for (const std::uint32_t index : previousNearby_) {
+        while (current != nearby_.end() && *current < index) {
+            ++current;
+        }
+        if (current == nearby_.end() || *current != index) {
+            treeLevels_[index] = culled;
+        }
+    }
+
+    const auto& obstacles = obstacles_.getObstacles();
+    std::array<std::size_t, TREE_MESH_LEVELS + 1> counts{};  // Plus billboards
+    Matrix4 matrix;
+    Sphere bounds(Vector3(), TREE_BOUNDING_RADIUS);
+    for (const std::uint32_t index : nearby_) {
+        const Obstacle& obstacle = *obstacles[index];
+        if (obstacle.getType() != ObstacleType::TREE) {
+            continue;
+        }
+
+        const auto& position = obstacle.getPosition();
+        bounds.center.set(position[0], position[1] + TREE_CENTER_HEIGHT, position[2]);
+        const std::uint8_t level = treeLod_.select(treeLevels_[index], bounds.center.distanceTo(eye));
+        treeLevels_[index] = level;
+        if (level == culled || (frustumCull && !frustum.intersectsSphere(bounds))) {
+            continue;
+        }
+
+        const std::size_t slot = counts[level]++;
+        if (level == TREE_BILLBOARD_LEVEL) {
+            // Turned about the vertical axis only, so the trunk stays upright
+            matrix.makeRotationY(std::atan2(eye.x - position[0], eye.z - position[2]));
+            matrix.setPosition(position[0], position[1], position[2]);
+            treeBillboards_->setMatrixAt(slot, matrix);
+        } else {
+            matrix.makeTranslation(position[0], position[1] + TREE_TRUNK_HEIGHT / 2.0f, position[2]);
+            treeMeshes_[level].trunk->setMatrixAt(slot, matrix);
+            matrix.makeTranslation(position[0], position[1] + TREE_FOLIAGE_HEIGHT, position[2]);
+            treeMeshes_[level].foliage->setMatrixAt(slot, matrix);
+        }
+    }
+
+    for (std::size_t level = 0; level < TREE_MESH_LEVELS; ++level) {
+        for (const auto& mesh : {treeMeshes_[level].trunk, treeMeshes_[level].foliage}) {
+            mesh->setCount(counts[level]);
+            mesh->instanceMatrix()->needsUpdate();
+        }
+    }
+    treeBillboards_->setCount(counts[TREE_BILLBOARD_LEVEL]);
+    treeBillboards_->instanceMatrix()->needsUpdate();
 }
@@ -1,4 +1,7 @@
 #include "graphics/powerup_renderer.hpp"
+#include "core/object_sizes.hpp"
+#include "graphics/game_object_renderer.hpp"
+#include <algorithm>
 
 using namespace threepp;
 
@@ -10,33 +13,82 @@ namespace {
     constexpr float NITROUS_EMISSIVE_INTENSITY = 0.5f;
 }
 
-PowerupRenderer::PowerupRenderer(Scene& scene, const Powerup& powerup)
-    : GameObjectRenderer(scene, powerup),
-      powerup_(powerup) {
-    createModel();
-}
-
-void PowerupRenderer::createModel() {
-    std::array<float, 3> size = powerup_.getSize();
-
+PowerupRenderer::PowerupRenderer(Scene& scene, RenderResourceCache& resources,
+                                 const std::vector<std::unique_ptr<Powerup>>& powerups)
+    : scene_(scene),
+      heightOffset_(ObjectSizes::POWERUP_SIZE / 2.0f) {
     // Create a distinctive visual for nitrous - blue glowing cylinder
-    auto geometry = CylinderGeometry::create(
-        size[0] * CYLINDER_RADIUS_RATIO,
-        size[0] * CYLINDER_RADIUS_RATIO,
-        size[1],
+    auto geometry = resources.cylinder(
+        ObjectSizes::POWERUP_SIZE * CYLINDER_RADIUS_RATIO,
+        ObjectSizes::POWERUP_SIZE * CYLINDER_RADIUS_RATIO,
+        ObjectSizes::POWERUP_SIZE,
         CYLINDER_RADIAL_SEGMENTS
     );
-    auto material = MeshPhongMaterial::create();
+    auto material = resources.phongMaterial(NITROUS_COLOR, NITROUS_EMISSIVE, NITROUS_EMISSIVE_INTENSITY);
 
-    if (powerup_.getType() == PowerupType::NITROUS) {
-        material->color = Color(NITROUS_COLOR);
-        material->emissive = Color(NITROUS_EMISSIVE);
-        material->emissiveIntensity = NITROUS_EMISSIVE_INTENSITY;
+    positions_.reserve(powerups.size());
+    for (const auto& powerup : powerups) {
+        positions_.push_back(powerup->getPosition());
     }
+    visible_.assign(positions_.size(), false);
 
-    bodyMesh_ = Mesh::create(geometry, material);
-    bodyMesh_->position.y = size[1] / 2.0f;
-    bodyMesh_->castShadow = true;
+    // Keep at least one instance so an empty map still has a valid buffer
+    const std::size_t instanceCount = (std::max)(positions_.size(), std::size_t{1});
+    mesh_ = InstancedMesh::create(geometry, material, instanceCount);
+    mesh_->castShadow = true;
+    // Bounds come from a single instance, so culling the whole batch by them would be wrong
+    mesh_->frustumCulled = false;
 
-    objectGroup_->add(bodyMesh_);
+    // Start with every instance collapsed, then show the active ones
+    Matrix4 hidden;
+    hidden.makeScale(0.0f, 0.0f, 0.0f);
+    for (std::size_t i = 0; i < instanceCount; ++i) {
+        mesh_->setMatrixAt(i, hidden);
+    }
+    for (std::size_t i = 0; i < powerups.size(); ++i) {
+        setVisible(i, powerups[i]->isActive());
+    }
+    mesh_->instanceMatrix()->needsUpdate();
+
+    // Pickups show and hide through their instance matrices, the node itself never moves
+    scene_.add(mesh_);
+    GameObjectRenderer::freezeTransforms(*mesh_);
+}
+
+PowerupRenderer::~PowerupRenderer() {
+    scene_.remove(*mesh_);
+}
+
+void PowerupRenderer::sync(const SimulationSnapshot& snapshot) {
+    const std::size_t count = (std::min)(static_cast<std::size_t>(snapshot.powerupCount), positions_.size());
+    const auto apply = [&](std::uint32_t index) {
+        if (index < count) {
+            setVisible(index, snapshot.powerupActive[index] != 0);
+        }
+    };
+
+    if (fullSyncNeeded_ || !snapshot.powerupChanges.forEachSince(syncedSerial_, apply)) {
+        for (std::uint32_t i = 0; i < count; ++i) {
+            apply(i);
+        }
+        fullSyncNeeded_ = false;
+    }
+    syncedSerial_ = snapshot.powerupChanges.serial;
+}
+
+void PowerupRenderer::setVisible(std::size_t index, bool visible) {
+    if (index >= positions_.size() || visible_[index] == visible) {
+        return;
+    }
+    visible_[index] = visible;
+
+    Matrix4 matrix;
+    if (visible) {
+        const auto& position = positions_[index];
+        matrix.makeTranslation(position[0], position[1] + heightOffset_, position[2]);
+    } else {
+        matrix.makeScale(0.0f, 0.0f, 0.0f);
+    }
+    mesh_->setMatrixAt(index, matrix);
+    mesh_->instanceMatrix()->needsUpdate();
 }
@@ -0,0 +1,140 @@
+#include "graphics/render_resource_cache.hpp"
+#include "core/logger.hpp"
+#include "graphics/model_builder.hpp"
+#include "loaders/obj_parser.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <string>
+
+using namespace threepp;
+
+namespace {
+    // Vertex data uploaded to the GPU for one geometry
+    std::size_t geometryBytes(const BufferGeometry& geometry) {
+        std::size_t bytes = 0;
+        for (const char* name : {"position", "normal", "uv"}) {
+            if (geometry.hasAttribute(name)) {
+                bytes += geometry.getAttribute<float>(name)->array().size() * sizeof(float);
+            }
+        }
+        if (const auto* index = geometry.getIndex()) {
+            bytes += index->array().size() * sizeof(unsigned int);
+        }
+        return bytes;
+    }
+
+    std::string formatStats(const char* name, const ResourceCacheStats& stats) {
+        char line[160];
+        std::snprintf(line, sizeof(line), "%s cache: %zu requests, %.1f%% hits, %.1f KiB saved",
+                      name, stats.requests, stats.getHitRate() * 100.0, static_cast<double>(stats.bytesSaved) / 1024.0);
+        return line;
+    }
+}
+
+std::size_t RenderResourceCache::GeometryKeyHash::operator()(const GeometryKey& key) const noexcept {
+    std::size_t seed = std::hash<unsigned int>{}(static_cast<unsigned int>(key.shape));
+    for (const float dimension : key.dimensions) {
+        hashCombine(seed, std::hash<float>{}(dimension));
+    }
+    hashCombine(seed, std::hash<unsigned int>{}(key.segments));
+    return seed;
+}
+
+std::size_t RenderResourceCache::MaterialKeyHash::operator()(const MaterialKey& key) const noexcept {
+    std::size_t seed = std::hash<unsigned int>{}(key.color);
+    hashCombine(seed, std::hash<unsigned int>{}(key.emissive));
+    hashCombine(seed, std::hash<float>{}(key.emissiveIntensity));
+    return seed;
+}
+
+RenderResourceCache::RenderResourceCache()
+    : geometries_(geometryBytes),
+      materials_([](const MeshPhongMaterial&) { return sizeof(MeshPhongMaterial); }),
+      meshLibrary_([](const std::string& path) { return ObjParser::parseFile(path); }),
+      asyncLoader_(meshLibrary_) {
+}
+
+RenderResourceCache::LoadedModel RenderResourceCache::loadModel(const std::string& path) {
+    return instantiate(path, meshLibrary_.load(path));
+}
+
+RenderResourceCache::PendingModel RenderResourceCache::requestModel(const std::string& path) {
+    return {path, asyncLoader_.request(path)};
+}
+
+RenderResourceCache::LoadedModel RenderResourceCache::finishModel(const PendingModel& pending) {
+    return instantiate(pending.path, pending.data.valid() ? pending.data.get() : nullptr);
+}
+
+RenderResourceCache::LoadedModel RenderResourceCache::instantiate(const std::string& path,
+                                                                  std::shared_ptr<const MeshData> data) {
+    auto it = models_.find(path);
+    if (it == models_.end()) {
+        // Nothing is stored for a failed load, so the next request for the path tries again
+        if (!data) {
+            return {};
+        }
+        ModelResources resources;
+        resources.data = std::move(data);
+        resources.geometries = ModelBuilder::createGeometries(*resources.data);
+        resources.materials = ModelBuilder::createMaterials(*resources.data);
+        it = models_.emplace(path, std::move(resources)).first;
+    }
+
+    const ModelResources& resources = it->second;
+    return {ModelBuilder::buildGroup(*resources.data, resources.geometries, resources.materials), resources.data};
+}
+
+std::shared_ptr<BufferGeometry> RenderResourceCache::box(float width, float height, float depth) {
+    return geometries_.acquire({Shape::BOX, {width, height, depth}, DEFAULT_SEGMENTS}, [&] {
+        return BoxGeometry::create(width, height, depth);
+    });
+}
+
+std::shared_ptr<BufferGeometry> RenderResourceCache::cylinder(float radiusTop, float radiusBottom, float height,
+                                                              unsigned int radialSegments) {
+    return geometries_.acquire({Shape::CYLINDER, {radiusTop, radiusBottom, height}, radialSegments},
+                               [&]() -> std::shared_ptr<BufferGeometry> {
+        if (radialSegments == DEFAULT_SEGMENTS) {
+            return CylinderGeometry::create(radiusTop, radiusBottom, height);
+        }
+        return CylinderGeometry::create(radiusTop, radiusBottom, height, radialSegments);
+    });
+}
+
+std::shared_ptr<BufferGeometry> RenderResourceCache::sphere(float radius, unsigned int segments) {
+    return geometries_.acquire({Shape::SPHERE, {radius, 0.0f, 0.0f}, segments},
+                               [&]() -> std::shared_ptr<BufferGeometry> {
+        if (segments == DEFAULT_SEGMENTS) {
+            return SphereGeometry::create(radius);
+        }
+        return SphereGeometry::create(radius, segments, (std::max)(segments / 2, 2u));
+    });
+}
+
+std::shared_ptr<BufferGeometry> RenderResourceCache::plane(float width, float height) {
+    return geometries_.acquire({Shape::PLANE, {width, height, 0.0f}, DEFAULT_SEGMENTS}, [&] {
+        return PlaneGeometry::create(width, height);
+    });
+}
+
+std::shared_ptr<MeshPhongMaterial> RenderResourceCache::phongMaterial(unsigned int color, unsigned int emissive,
+                                                                      float emissiveIntensity) {
+    return materials_.acquire({color, emissive, emissiveIntensity}, [&] {
+        auto material = MeshPhongMaterial::create();
+        material->color = Color(color);
+        material->emissive = Color(emissive);
+        material->emissiveIntensity = emissiveIntensity;
+        return material;
+    });
+}
+
+void RenderResourceCache::logStats() const {
+    Logger::info(Logger::Tag::GRAPHICS, formatStats("Geometry", geometries_.getStats()));
+    Logger::info(Logger::Tag::GRAPHICS, formatStats("Material", materials_.getStats()));
+
+    const MeshLibrary::Stats models = meshLibrary_.getStats();
+    Logger::info(Logger::Tag::GRAPHICS, "Model files: ", models.parses, " parsed, ", models.diskHits,
+                 " from binary cache, ", models.memoryHits, " reused, ", models.failures, " failed");
+}
@@ -2,8 +2,14 @@
 // camera projection matrix calculations, and viewport rendering setup.
 
 #include "graphics/scene_manager.hpp"
+#include "core/logger.hpp"
+#include "graphics/game_object_renderer.hpp"
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
 
 using namespace threepp;
 
@@ -70,9 +76,25 @@ namespace {
     constexpr float AMBIENT_INTENSITY = 1.0f;
     constexpr unsigned int DIRECTIONAL_COLOR = 0xffffff;
     constexpr float DIRECTIONAL_INTENSITY = 0.8f;
-    constexpr float SHADOW_AREA_SIZE = 100.0f;
     constexpr float DIRECTIONAL_LIGHT_HEIGHT = 50.0f;
-    constexpr int SHADOW_MAP_SIZE = 4096;
+
+    // Shadows: a square map around the vehicle that follows it, rather than one over the whole arena
+    constexpr float SHADOW_AREA_SIZE = 40.0f;  // Half extent, multiplied by vehicle scale
+    constexpr int SHADOW_MAP_SIZE = 2048;
+    constexpr unsigned int SHADOW_PROXY_LAYER = 1;  // Seen by the shadow camera only, never drawn
+
+    // Transform stats: average the per-frame matrix pass over this many runs
+    constexpr int MATRIX_PASS_SAMPLES = 200;
+
+    // Microseconds for the matrix pass the renderer runs on the scene every frame
+    double timeMatrixPass(Object3D& root) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int sample = 0; sample < MATRIX_PASS_SAMPLES; ++sample) {
+            root.updateMatrixWorld();
+        }
+        const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / MATRIX_PASS_SAMPLES;
+    }
 }
 
 SceneManager::SceneManager()
@@ -89,6 +111,8 @@ SceneManager::SceneManager()
       targetFOV_(CAMERA_FOV_MIN),
       fovLerpSpeed_(FOV_LERP_SPEED),
       cameraMode_(CameraMode::FOLLOW),
+      minimapMode_(MinimapMode::VECTOR),
+      minimapViewSize_(BASE_MINIMAP_VIEW_SIZE),
       currentCameraX_(0.0f),
       currentCameraY_(BASE_CAMERA_HEIGHT),
       currentCameraZ_(0.0f),
@@ -101,6 +125,9 @@ SceneManager::SceneManager()
       targetCameraYawOffset_(0.0f),
       yawLerpSpeed_(0.1f) {
     scene_ = std::make_shared<Scene>();
+    // The root never moves; left on auto-update it would force every world matrix in the
+    // graph to be recomputed each frame, frozen or not
+    GameObjectRenderer::freezeTransforms(*scene_);
     renderer_ = std::make_unique<GLRenderer>();
     renderer_->shadowMap().enabled = true;
 }
@@ -122,32 +149,26 @@ void SceneManager::setupLighting() {
     auto ambientLight = AmbientLight::create(AMBIENT_COLOR, AMBIENT_INTENSITY);
     scene_->add(ambientLight);
     
-    // Directional light for main lighting and shadows
-    auto directionalLight = DirectionalLight::create(DIRECTIONAL_COLOR, DIRECTIONAL_INTENSITY);
-    directionalLight->position.set(0, DIRECTIONAL_LIGHT_HEIGHT, 0);
-    directionalLight->castShadow = true;
-
-    // Configure shadow camera
-    auto shadowCamera = directionalLight->shadow->camera->as<OrthographicCamera>();
-    shadowCamera->left = -SHADOW_AREA_SIZE;
-    shadowCamera->right = SHADOW_AREA_SIZE;
-    shadowCamera->top = SHADOW_AREA_SIZE;
-    shadowCamera->bottom = -SHADOW_AREA_SIZE;
-    shadowCamera->updateProjectionMatrix();
-
-    // High resolution shadow map
-    directionalLight->shadow->mapSize.set(SHADOW_MAP_SIZE, SHADOW_MAP_SIZE);
-
-    scene_->add(directionalLight);
+    // Directional light for main lighting and shadows; the light stays put, only its shadow
+    // camera's frustum follows the vehicle (updateShadowRegion)
+    sunLight_ = DirectionalLight::create(DIRECTIONAL_COLOR, DIRECTIONAL_INTENSITY);
+    sunLight_->position.set(0, DIRECTIONAL_LIGHT_HEIGHT, 0);
+    sunLight_->castShadow = true;
+    sunLight_->shadow->camera->layers.enable(SHADOW_PROXY_LAYER);
+    sunLight_->shadow->mapSize.set(SHADOW_MAP_SIZE, SHADOW_MAP_SIZE);
+    scene_->add(sunLight_);
+    updateShadowRegion(0.0f, 0.0f, 1.0f);
+
+    GameObjectRenderer::freezeTransforms(*ambientLight);
+    GameObjectRenderer::freezeTransforms(*sunLight_);
+
+    // Shadow maps are updated by render() only; the minimap pass reuses them
+    renderer_->shadowMap().autoUpdate = false;
 }
 
 void SceneManager::setupGround() {
     // Create ground plane
-    auto groundGeometry = PlaneGeometry::create(GROUND_SIZE, GROUND_SIZE);
-    auto groundMaterial = MeshPhongMaterial::create();
-    groundMaterial->color = Color(0x3a7d44);
-
-    groundMesh_ = Mesh::create(groundGeometry, groundMaterial);
+    groundMesh_ = Mesh::create(resourceCache_.plane(GROUND_SIZE, GROUND_SIZE), resourceCache_.phongMaterial(0x3a7d44));
     groundMesh_->rotation.x = -math::PI / 2;
     groundMesh_->receiveShadow = true;
     scene_->add(groundMesh_);
@@ -156,6 +177,9 @@ void SceneManager::setupGround() {
     auto grid = GridHelper::create(GROUND_SIZE, GRID_DIVISIONS, 0x2d5a33, 0x2d5a33);
     grid->position.y = GRID_Z_OFFSET;
     scene_->add(grid);
+
+    GameObjectRenderer::freezeTransforms(*groundMesh_);
+    GameObjectRenderer::freezeTransforms(*grid);
 }
 
 void SceneManager::setupCamera(float aspectRatio) {
@@ -282,6 +306,7 @@ void SceneManager::updateMinimapCamera(float targetX, float targetZ, float vehic
 
     // Scale view based on vehicle scale only
     const float scaledViewSize = BASE_MINIMAP_VIEW_SIZE * (1.0f + (vehicleScale - 1.0f) * MINIMAP_SCALE_MULTIPLIER);
+    minimapViewSize_ = scaledViewSize;
 
     minimapCamera_->left = -scaledViewSize;
     minimapCamera_->right = scaledViewSize;
@@ -324,9 +349,67 @@ void SceneManager::updateCameraFOV(bool nitrousActive, float vehicleVelocity) {
 }
 
 void SceneManager::render() {
+    // Redraws the shadow map once per frame; the minimap pass reuses it
+    renderer_->shadowMap().needsUpdate = true;
     renderer_->render(*scene_, *camera_);
 }
 
+void SceneManager::updateShadowRegion(float targetX, float targetZ, float vehicleScale) {
+    // Centre the shadow frustum on the vehicle, in the shadow camera's own space
+    auto shadowCamera = sunLight_->shadow->camera->as<OrthographicCamera>();
+    Vector3 center(targetX, 0.0f, targetZ);
+    center.applyMatrix4(shadowCamera->matrixWorldInverse);
+
+    // Move in whole texels so the shadow edges don't shimmer while driving
+    const float halfSize = SHADOW_AREA_SIZE * vehicleScale;
+    const float texelSize = 2.0f * halfSize / static_cast<float>(SHADOW_MAP_SIZE);
+    const float centerX = std::round(center.x / texelSize) * texelSize;
+    const float centerY = std::round(center.y / texelSize) * texelSize;
+
+    shadowCamera->left = centerX - halfSize;
+    shadowCamera->right = centerX + halfSize;
+    shadowCamera->top = centerY + halfSize;
+    shadowCamera->bottom = centerY - halfSize;
+    shadowCamera->updateProjectionMatrix();
+}
+
+void SceneManager::registerShadowProxies(Object3D& root) {
+    // Only the sun's shadow camera sees this layer
+    root.traverse([](Object3D& object) {
+        object.layers.set(SHADOW_PROXY_LAYER);
+    });
+}
+
+void SceneManager::logTransformStats() const {
+    std::size_t total = 0;
+    std::vector<Object3D*> frozen;
+    scene_->traverse([&](Object3D& node) {
+        ++total;
+        if (!node.matrixAutoUpdate) {
+            frozen.push_back(&node);
+        }
+    });
+
+    // The same pass with every transform thawed, as it ran before freezing. Nothing frozen has
+    // moved since it was frozen, so recomputing its matrices leaves them as they were.
+    const double frozenMicroseconds = timeMatrixPass(*scene_);
+    for (Object3D* node : frozen) {
+        node->matrixAutoUpdate = true;
+    }
+    const double thawedMicroseconds = timeMatrixPass(*scene_);
+    for (Object3D* node : frozen) {
+        node->matrixAutoUpdate = false;
+    }
+
+    char line[200];
+    std::snprintf(line, sizeof(line),
+                  "Scene graph: %zu of %zu nodes frozen; matrix pass %zu local updates in %.1f us per frame, "
+                  "%zu in %.1f us with nothing frozen (%.1f us saved)",
+                  frozen.size(), total, total - frozen.size(), frozenMicroseconds, total, thawedMicroseconds,
+                  thawedMicroseconds - frozenMicroseconds);
+    Logger::info(Logger::Tag::GRAPHICS, line);
+}
+
 void SceneManager::resize(const WindowSize& size) {
     camera_->aspect = size.aspect();
     camera_->updateProjectionMatrix();
@@ -361,6 +444,20 @@ void SceneManager::toggleCameraMode() noexcept {
     }
 }
 
+void SceneManager::toggleMinimapMode() noexcept {
+    switch (minimapMode_) {
+        case MinimapMode::VECTOR:
+            minimapMode_ = MinimapMode::OVERVIEW;
+            break;
+        case MinimapMode::OVERVIEW:
+            minimapMode_ = MinimapMode::SCENE;
+            break;
+        case MinimapMode::SCENE:
+            minimapMode_ = MinimapMode::VECTOR;
+            break;
+    }
+}
+
 void SceneManager::renderMinimap() {
     renderer_->render(*scene_, *minimapCamera_);
 }
@@ -2,7 +2,7 @@
 // 3D model transformation matrices, and wheel rotation calculations.
 
 #include "graphics/vehicle_renderer.hpp"
-#include <threepp/loaders/OBJLoader.hpp>
+#include "core/logger.hpp"
 #include <algorithm>
 #include <cmath>
 
@@ -54,8 +54,9 @@ namespace {
     }
 }
 
-VehicleRenderer::VehicleRenderer(Scene& scene, const IVehicleState& vehicleState)
-    : GameObjectRenderer(scene, dynamic_cast<const GameObject&>(vehicleState)),
+VehicleRenderer::VehicleRenderer(Scene& scene, RenderResourceCache& resources, const GameObject& vehicle,
+                                 const IVehicleState& vehicleState)
+    : GameObjectRenderer(scene, resources, vehicle),
       vehicleState_(vehicleState),
       useCustomModel_(false),
       customModelGroup_(nullptr),
@@ -66,99 +67,141 @@ VehicleRenderer::VehicleRenderer(Scene& scene, const IVehicleState& vehicleState
       wheelRL_(nullptr),
       wheelRR_(nullptr) {
 
-    GameObjectRenderer::createModel();
-
-    if (bodyMesh_) {
-        if (auto material = std::dynamic_pointer_cast<MeshPhongMaterial>(bodyMesh_->material())) {
-            material->color = Color::red;
-        }
-        auto size = gameObject_.getSize();
-        bodyMesh_->position.y = size[1] / 2.f;
-        bodyMesh_->castShadow = true;
-    }
+    // Placeholder red box; materials from the cache are shared, so pick the color up front
+    auto size = gameObject_.getSize();
+    bodyMesh_ = Mesh::create(resources_.box(size[0], size[1], size[2]), resources_.phongMaterial(0xff0000));
+    bodyMesh_->position.y = size[1] / 2.f;
+    bodyMesh_->castShadow = true;
+    objectGroup_->add(bodyMesh_);
 
-    loadWheelModels(WHEELS_DIR);
-    loadSteeringWheel(STEERING_WHEEL_PATH);
+    requestParts();
 
     actualAppliedScale_ = modelScale_;
     applyWheelScaleAndPosition(actualAppliedScale_);
     applySteeringWheelScaleAndPosition(actualAppliedScale_);
 }
 
-bool VehicleRenderer::loadModel(const std::string& modelPath) {
-    try {
-        OBJLoader loader;
-        auto loadedGroup = loader.load(modelPath);
+void VehicleRenderer::requestModel(const std::string& modelPath) {
+    // Read and parsed on the resource cache's worker; the body is swapped in by update()
+    pendingParts_.push_back({Part::BODY, resources_.requestModel(modelPath)});
+    requestParts();
+}
 
-        if (!loadedGroup) {
-            return false;
+// Queue every wheel and the steering wheel that is neither attached nor already loading
+void VehicleRenderer::requestParts() {
+    const auto request = [this](Part part, bool attached, const std::string& path) {
+        const bool queued = std::any_of(pendingParts_.begin(), pendingParts_.end(),
+                                        [part](const PendingPart& pending) { return pending.part == part; });
+        if (!attached && !queued) {
+            pendingParts_.push_back({part, resources_.requestModel(path)});
         }
+    };
 
-        // Clear existing model
-        if (bodyMesh_) {
-            objectGroup_->remove(*bodyMesh_);
-            bodyMesh_.reset();
-        }
+    request(Part::WHEEL_FL, wheelFL_ != nullptr, WHEELS_DIR + WHEEL_FL);
+    request(Part::WHEEL_FR, wheelFR_ != nullptr, WHEELS_DIR + WHEEL_FR);
+    request(Part::WHEEL_RL, wheelRL_ != nullptr, WHEELS_DIR + WHEEL_RL);
+    request(Part::WHEEL_RR, wheelRR_ != nullptr, WHEELS_DIR + WHEEL_RR);
+    request(Part::STEERING_WHEEL, steeringWheel_ != nullptr, STEERING_WHEEL_PATH);
+}
 
-        // Compute the model's original bounding box to determine proper scaling
-        Box3 modelBBox;
-        modelBBox.setFromObject(*loadedGroup);
-        auto originalModelSize = modelBBox.getSize();
+// Swap in whatever finished loading since the last frame. Only the scene graph and GPU-side
+// objects are created here, on the render thread; parsing already happened in the background.
+void VehicleRenderer::attachPendingParts() {
+    if (pendingParts_.empty()) {
+        return;
+    }
 
-        // Get the target vehicle dimensions
-        auto vehicleSize = gameObject_.getSize();
+    std::vector<PendingPart> ready;
+    for (auto it = pendingParts_.begin(); it != pendingParts_.end();) {
+        if (it->model.isReady()) {
+            ready.push_back(std::move(*it));
+            it = pendingParts_.erase(it);
+        } else {
+            ++it;
+        }
+    }
 
-        // Calculate scale factors for each axis to match vehicle dimensions
-        float scaleX = vehicleSize[0] / originalModelSize.x;
-        float scaleY = vehicleSize[1] / originalModelSize.y;
-        float scaleZ = vehicleSize[2] / originalModelSize.z;
+    for (const auto& pending : ready) {
+        RenderResourceCache::LoadedModel model;
+        try {
+            model = resources_.finishModel(pending.model);
+        } catch (const std::exception& e) {
+            Logger::warning(Logger::Tag::GRAPHICS, "Failed to load model ", pending.model.path, ": ", e.what());
+            continue;
+        }
+        if (!model) {
+            Logger::warning(Logger::Tag::GRAPHICS, "Failed to load model ", pending.model.path);
+            continue;
+        }
 
-        // Use the average scale to maintain proportions, or use the smallest
-        // to ensure the model fits within the collision box
-        float autoScale = (std::min)({scaleX, scaleY, scaleZ});
+        switch (pending.part) {
+            case Part::BODY: attachBody(model); break;
+            case Part::STEERING_WHEEL: attachSteeringWheel(model); break;
+            default: attachWheel(pending.part, model); break;
+        }
+    }
 
-        // Apply both the calculated auto-scale and any user-defined modelScale
-        float appliedScale = autoScale * modelScale_;
+    // Parts may arrive in any order, so place everything for the current body scale
+    if (!ready.empty()) {
+        applyWheelScaleAndPosition(actualAppliedScale_);
+        applySteeringWheelScaleAndPosition(actualAppliedScale_);
+    }
+}
 
-        // Store the actual applied scale for wheel positioning
-        actualAppliedScale_ = appliedScale;
+void VehicleRenderer::attachBody(const RenderResourceCache::LoadedModel& model) {
+    auto loadedGroup = model.group;
 
-        loadedGroup->scale.setScalar(appliedScale);
-        loadedGroup->position.y = 0.f;
+    // Clear existing model
+    if (customModelGroup_) {
+        objectGroup_->remove(*customModelGroup_);
+    }
+    if (bodyMesh_) {
+        objectGroup_->remove(*bodyMesh_);
+        bodyMesh_.reset();
+    }
 
-        // Enable shadows for all meshes
-        loadedGroup->traverse([](Object3D& obj) {
-            if (auto mesh = obj.as<Mesh>()) {
-                mesh->castShadow = true;
-                mesh->receiveShadow = false;
-            }
-        });
+    // The model's original bounding box (precomputed with the mesh) determines proper scaling
+    const auto modelSize = model.data->getSize();
+    const Vector3 originalModelSize(modelSize[0], modelSize[1], modelSize[2]);
 
-        objectGroup_->add(loadedGroup);
-        customModelGroup_ = loadedGroup;
-        useCustomModel_ = true;
+    // Get the target vehicle dimensions
+    auto vehicleSize = gameObject_.getSize();
 
-        // Hide the fallback box mesh when using custom model
-        if (bodyMesh_) {
-            bodyMesh_->visible = false;
-        }
+    // Calculate scale factors for each axis to match vehicle dimensions
+    float scaleX = vehicleSize[0] / originalModelSize.x;
+    float scaleY = vehicleSize[1] / originalModelSize.y;
+    float scaleZ = vehicleSize[2] / originalModelSize.z;
 
-        loadWheelModels(WHEELS_DIR);
-        loadSteeringWheel(STEERING_WHEEL_PATH);
+    // Use the average scale to maintain proportions, or use the smallest
+    // to ensure the model fits within the collision box
+    float autoScale = (std::min)({scaleX, scaleY, scaleZ});
 
-        // Apply wheel scale/positions for the current vehicle size
-        applyWheelScaleAndPosition(appliedScale);
-        applySteeringWheelScaleAndPosition(appliedScale);
+    // Apply both the calculated auto-scale and any user-defined modelScale
+    float appliedScale = autoScale * modelScale_;
 
+    // Store the actual applied scale for wheel positioning
+    actualAppliedScale_ = appliedScale;
 
-        return true;
+    loadedGroup->scale.setScalar(appliedScale);
+    loadedGroup->position.y = 0.f;
 
-    } catch (const std::exception&) {
-        return false;
-    }
+    // Enable shadows for all meshes
+    loadedGroup->traverse([](Object3D& obj) {
+        if (auto mesh = obj.as<Mesh>()) {
+            mesh->castShadow = true;
+            mesh->receiveShadow = false;
+        }
+    });
+
+    objectGroup_->add(loadedGroup);
+    customModelGroup_ = loadedGroup;
+    useCustomModel_ = true;
 }
 
 void VehicleRenderer::unloadModel() {
+    // Anything still loading would otherwise be attached again later
+    pendingParts_.clear();
+
     // Remove any custom loaded model and fall back to the box mesh
     if (customModelGroup_) {
         objectGroup_->remove(*customModelGroup_);
@@ -228,9 +271,8 @@ void VehicleRenderer::applyScale(float scale) {
 void VehicleRenderer::createModel() {
     std::array<float, 3> size = gameObject_.getSize();
 
-    auto geometry = BoxGeometry::create(size[0], size[1], size[2]);
-    auto material = MeshPhongMaterial::create();
-    material->color = Color::red;
+    auto geometry = resources_.box(size[0], size[1], size[2]);
+    auto material = resources_.phongMaterial(0xff0000);
 
     bodyMesh_ = Mesh::create(geometry, material);
 
@@ -242,8 +284,7 @@ void VehicleRenderer::createModel() {
 
     objectGroup_->add(bodyMesh_);
 
-    loadWheelModels(WHEELS_DIR);
-    loadSteeringWheel(STEERING_WHEEL_PATH);
+    requestParts();
 
     float appliedScale = modelScale_;
     actualAppliedScale_ = appliedScale;
@@ -251,153 +292,65 @@ void VehicleRenderer::createModel() {
     applySteeringWheelScaleAndPosition(appliedScale);
 }
 
-// Helper: load wheel OBJ files from assets/wheels directory
-bool VehicleRenderer::loadWheelModels(const std::string& wheelsDir) {
-    try {
-        OBJLoader loader;
-        bool allLoaded = true;
-
-        // Front-left
-        if (!wheelFL_) {
-            auto g = loader.load(wheelsDir + WHEEL_FL);
-            if (g) {
-                // Compute geometry center (bounding box center) and store it; we'll offset children when reparenting
-                threepp::Box3 bbox;
-                bbox.setFromObject(*g);
-                auto center = bbox.getCenter();
-                wheelCenterFL_ = {center.x, center.y, center.z};
-
-                // Detect spin axis: the smallest bbox extent is the wheel thickness axis -> spin axis
-                {
-                    auto size = bbox.getSize();
-                    float sx = size.x, sy = size.y, sz = size.z;
-                    if (sx <= sy && sx <= sz) wheelSpinAxisFL_ = WheelSpinAxis::X;
-                    else if (sy <= sx && sy <= sz) wheelSpinAxisFL_ = WheelSpinAxis::Y;
-                    else wheelSpinAxisFL_ = WheelSpinAxis::Z;
-                }
-
-                // Instead of changing geometry, set the loaded group's local offset so its center becomes origin for spin
-                g->position.set(-center.x, -center.y, -center.z);
-
-                // Create pivot group and a dedicated spin group that will be rotated to spin the wheel
-                wheelFLPivot_ = std::make_shared<Group>();
-                auto spinFL = std::make_shared<Group>();
-                // g has been offset so its center is at the spin group's origin
-                spinFL->add(g);
-                wheelFL_ = spinFL;
-                wheelFL_->position.set(0.0f, 0.0f, 0.0f);
-                wheelFLPivot_->add(wheelFL_);
-                // Parent the pivot to the vehicle's objectGroup_ (consistent coordinate space)
-                objectGroup_->add(wheelFLPivot_);
-                wheelFLPivotOnCustom_ = false;
-            } else {
-                allLoaded = false;
-            }
-        }
-
-        // Front-right
-        if (!wheelFR_) {
-            auto g = loader.load(wheelsDir + WHEEL_FR);
-            if (g) {
-                threepp::Box3 bbox;
-                bbox.setFromObject(*g);
-                auto center = bbox.getCenter();
-                wheelCenterFR_ = {center.x, center.y, center.z};
-
-                // Detect spin axis for front-right
-                {
-                    auto size = bbox.getSize();
-                    float sx = size.x, sy = size.y, sz = size.z;
-                    if (sx <= sy && sx <= sz) wheelSpinAxisFR_ = WheelSpinAxis::X;
-                    else if (sy <= sx && sy <= sz) wheelSpinAxisFR_ = WheelSpinAxis::Y;
-                    else wheelSpinAxisFR_ = WheelSpinAxis::Z;
-                }
-
-                g->position.set(-center.x, -center.y, -center.z);
-
-                wheelFRPivot_ = std::make_shared<Group>();
-                auto spinFR = std::make_shared<Group>();
-                spinFR->add(g);
-                wheelFR_ = spinFR;
-                wheelFR_->position.set(0, 0, 0);
-                wheelFRPivot_->add(wheelFR_);
-                objectGroup_->add(wheelFRPivot_);
-                wheelFRPivotOnCustom_ = false;
-            } else {
-                allLoaded = false;
-            }
-        }
-
-        // Rear-left
-        if (!wheelRL_) {
-            auto g = loader.load(wheelsDir + WHEEL_RL);
-            if (g) {
-                threepp::Box3 bbox;
-                bbox.setFromObject(*g);
-                auto center = bbox.getCenter();
-                wheelCenterRL_ = {center.x, center.y, center.z};
-
-                // Detect spin axis for rear-left
-                {
-                    auto size = bbox.getSize();
-                    float sx = size.x, sy = size.y, sz = size.z;
-                    if (sx <= sy && sx <= sz) wheelSpinAxisRL_ = WheelSpinAxis::X;
-                    else if (sy <= sx && sy <= sz) wheelSpinAxisRL_ = WheelSpinAxis::Y;
-                    else wheelSpinAxisRL_ = WheelSpinAxis::Z;
-                }
-
-                g->position.set(-center.x, -center.y, -center.z);
-
-                wheelRLPivot_ = std::make_shared<Group>();
-                auto spinRL = std::make_shared<Group>();
-                spinRL->add(g);
-                wheelRL_ = spinRL;
-                wheelRL_->position.set(0, 0, 0);
-                wheelRLPivot_->add(wheelRL_);
-                objectGroup_->add(wheelRLPivot_);
-                wheelRLPivotOnCustom_ = false;
-            } else {
-                allLoaded = false;
-            }
-        }
-
-        // Rear-right
-        if (!wheelRR_) {
-            auto g = loader.load(wheelsDir + WHEEL_RR);
-            if (g) {
-                threepp::Box3 bbox;
-                bbox.setFromObject(*g);
-                auto center = bbox.getCenter();
-                wheelCenterRR_ = {center.x, center.y, center.z};
-
-                // Detect spin axis for rear-right
-                {
-                    auto size = bbox.getSize();
-                    float sx = size.x, sy = size.y, sz = size.z;
-                    if (sx <= sy && sx <= sz) wheelSpinAxisRR_ = WheelSpinAxis::X;
-                    else if (sy <= sx && sy <= sz) wheelSpinAxisRR_ = WheelSpinAxis::Y;
-                    else wheelSpinAxisRR_ = WheelSpinAxis::Z;
-                }
+VehicleRenderer::WheelSpinAxis VehicleRenderer::thinnestAxis(const std::array<float, 3>& size) noexcept {
+    if (size[0] <= size[1] && size[0] <= size[2]) return WheelSpinAxis::X;
+    if (size[1] <= size[0] && size[1] <= size[2]) return WheelSpinAxis::Y;
+    return WheelSpinAxis::Z;
+}
 
-                g->position.set(-center.x, -center.y, -center.z);
-
-                wheelRRPivot_ = std::make_shared<Group>();
-                auto spinRR = std::make_shared<Group>();
-                spinRR->add(g);
-                wheelRR_ = spinRR;
-                wheelRR_->position.set(0, 0, 0);
-                wheelRRPivot_->add(wheelRR_);
-                objectGroup_->add(wheelRRPivot_);
-                wheelRRPivotOnCustom_ = false;
-            } else {
-                allLoaded = false;
-            }
-        }
+// Helper: attach a loaded wheel model in its pivot/spin groups
+void VehicleRenderer::attachWheel(Part part, const RenderResourceCache::LoadedModel& model) {
+    std::shared_ptr<Object3D>* wheel = nullptr;
+    std::shared_ptr<Group>* pivot = nullptr;
+    std::array<float, 3>* center = nullptr;
+    WheelSpinAxis* spinAxis = nullptr;
+    bool* pivotOnCustom = nullptr;
+
+    switch (part) {
+        case Part::WHEEL_FL:
+            wheel = &wheelFL_; pivot = &wheelFLPivot_; center = &wheelCenterFL_;
+            spinAxis = &wheelSpinAxisFL_; pivotOnCustom = &wheelFLPivotOnCustom_;
+            break;
+        case Part::WHEEL_FR:
+            wheel = &wheelFR_; pivot = &wheelFRPivot_; center = &wheelCenterFR_;
+            spinAxis = &wheelSpinAxisFR_; pivotOnCustom = &wheelFRPivotOnCustom_;
+            break;
+        case Part::WHEEL_RL:
+            wheel = &wheelRL_; pivot = &wheelRLPivot_; center = &wheelCenterRL_;
+            spinAxis = &wheelSpinAxisRL_; pivotOnCustom = &wheelRLPivotOnCustom_;
+            break;
+        case Part::WHEEL_RR:
+            wheel = &wheelRR_; pivot = &wheelRRPivot_; center = &wheelCenterRR_;
+            spinAxis = &wheelSpinAxisRR_; pivotOnCustom = &wheelRRPivotOnCustom_;
+            break;
+        default:
+            return;
+    }
 
-        return allLoaded;
-    } catch (const std::exception&) {
-        return false;
+    if (*wheel) {
+        return;
     }
+
+    auto g = model.group;
+
+    // Geometry center (bounding box center, precomputed with the mesh); store it; we'll offset children when reparenting
+    *center = model.data->getCenter();
+    *spinAxis = thinnestAxis(model.data->getSize());
+
+    // Instead of changing geometry, set the loaded group's local offset so its center becomes origin for spin
+    g->position.set(-(*center)[0], -(*center)[1], -(*center)[2]);
+
+    // Create pivot group and a dedicated spin group that will be rotated to spin the wheel
+    *pivot = std::make_shared<Group>();
+    auto spin = std::make_shared<Group>();
+    // g has been offset so its center is at the spin group's origin
+    spin->add(g);
+    *wheel = spin;
+    (*wheel)->position.set(0.0f, 0.0f, 0.0f);
+    (*pivot)->add(*wheel);
+    // Parent the pivot to the vehicle's objectGroup_ (consistent coordinate space)
+    objectGroup_->add(*pivot);
+    *pivotOnCustom = false;
 }
 
 void VehicleRenderer::unloadWheelModels() {
@@ -434,53 +387,34 @@ void VehicleRenderer::unloadWheelModels() {
     wheelRR_.reset();
 }
 
-// Helper: load steering wheel OBJ file
-bool VehicleRenderer::loadSteeringWheel(const std::string& steeringWheelPath) {
-    try {
-        OBJLoader loader;
-
-        if (!steeringWheel_) {
-            auto g = loader.load(steeringWheelPath);
-            if (g) {
-                // Compute geometry center (bounding box center) and store it
-                threepp::Box3 bbox;
-                bbox.setFromObject(*g);
-                auto center = bbox.getCenter();
-                steeringWheelCenter_ = {center.x, center.y, center.z};
-
-                // Detect rotation axis: the steering wheel's smallest dimension is likely the thickness
-                // The rotation axis should be perpendicular to the wheel's face (the thinnest dimension)
-                {
-                    auto size = bbox.getSize();
-                    float sx = size.x, sy = size.y, sz = size.z;
-                    if (sx <= sy && sx <= sz) steeringWheelRotationAxis_ = WheelSpinAxis::X;
-                    else if (sy <= sx && sy <= sz) steeringWheelRotationAxis_ = WheelSpinAxis::Y;
-                    else steeringWheelRotationAxis_ = WheelSpinAxis::Z;
-                }
-
-                // Offset the loaded group so its center becomes the origin for rotation
-                g->position.set(-center.x, -center.y, -center.z);
-
-                // Create pivot group and a spin group that will be rotated for steering
-                steeringWheelPivot_ = std::make_shared<Group>();
-                auto spinGroup = std::make_shared<Group>();
-                // g has been offset so its center is at the spin group's origin
-                spinGroup->add(g);
-                steeringWheel_ = spinGroup;
-                steeringWheel_->position.set(0.0f, 0.0f, 0.0f);
-                steeringWheelPivot_->add(steeringWheel_);
-                objectGroup_->add(steeringWheelPivot_);
-                steeringWheelPivotOnCustom_ = false;
-
-                return true;
-            } else {
-                return false;
-            }
-        }
-        return true;
-    } catch (const std::exception&) {
-        return false;
+// Helper: attach the loaded steering wheel model
+void VehicleRenderer::attachSteeringWheel(const RenderResourceCache::LoadedModel& model) {
+    if (steeringWheel_) {
+        return;
     }
+
+    auto g = model.group;
+
+    // Geometry center (bounding box center, precomputed with the mesh); store it
+    const auto center = model.data->getCenter();
+    steeringWheelCenter_ = center;
+
+    // The rotation axis should be perpendicular to the wheel's face (the thinnest dimension)
+    steeringWheelRotationAxis_ = thinnestAxis(model.data->getSize());
+
+    // Offset the loaded group so its center becomes the origin for rotation
+    g->position.set(-center[0], -center[1], -center[2]);
+
+    // Create pivot group and a spin group that will be rotated for steering
+    steeringWheelPivot_ = std::make_shared<Group>();
+    auto spinGroup = std::make_shared<Group>();
+    // g has been offset so its center is at the spin group's origin
+    spinGroup->add(g);
+    steeringWheel_ = spinGroup;
+    steeringWheel_->position.set(0.0f, 0.0f, 0.0f);
+    steeringWheelPivot_->add(steeringWheel_);
+    objectGroup_->add(steeringWheelPivot_);
+    steeringWheelPivotOnCustom_ = false;
 }
 
 void VehicleRenderer::unloadSteeringWheel() {
@@ -607,12 +541,13 @@ void VehicleRenderer::applyWheelScaleAndPosition(float appliedScale) {
     }
 }
 
-// Update visual elements each frame: position/rotation already handled by base class,
-// but here we also animate wheel spin (rotation around local axis) and front wheel yaw.
-void VehicleRenderer::update(bool leftPressed, bool rightPressed) {
-    GameObjectRenderer::update();
+// Update visual elements each frame: position/rotation is interpolated between physics steps,
+// and here we also animate wheel spin (rotation around local axis) and front wheel yaw.
+void VehicleRenderer::update(const TransformState& transform, bool leftPressed, bool rightPressed) {
+    attachPendingParts();
+    syncTransform(transform);
 
-    auto pos = gameObject_.getPosition();
+    auto pos = transform.position;
 
     float dx = pos[0] - prevPosition_[0];
     float dz = pos[2] - prevPosition_[2];
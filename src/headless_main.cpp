@@ -0,0 +1,236 @@
+#include "core/simulation.hpp"
+#include "core/input_script.hpp"
+#include "core/input_recording.hpp"
+#include "core/vehicle_batch.hpp"
+#include "core/game_config.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace {
+    struct Options {
+        long long ticks = GameConfig::Headless::DEFAULT_TICKS;
+        float timeStep = GameConfig::Headless::DEFAULT_TIME_STEP;
+        int treeCount = GameConfig::Obstacle::DEFAULT_TREE_COUNT;
+        int powerupCount = GameConfig::Powerup::DEFAULT_COUNT;
+        int trafficCount = GameConfig::Traffic::DEFAULT_COUNT;
+        float playAreaSize = GameConfig::World::PLAY_AREA_SIZE;
+        long long fleetSize = 0;
+        std::uint32_t seed = GameConfig::World::SEED;
+        std::string scriptPath;
+        std::string recordPath;
+        std::string replayPath;
+    };
+
+    void printUsage() {
+        std::cout << "Usage: carsim_headless [options]\n"
+                  << "  --ticks N        Number of fixed steps to run (default " << GameConfig::Headless::DEFAULT_TICKS << ")\n"
+                  << "  --dt SECONDS     Fixed time step (default " << GameConfig::Headless::DEFAULT_TIME_STEP << ")\n"
+                  << "  --script FILE    Input script, see include/core/input_script.hpp (default: built-in lap)\n"
+                  << "  --trees N        Tree count (default " << GameConfig::Obstacle::DEFAULT_TREE_COUNT << ")\n"
+                  << "  --powerups N     Powerup count (default " << GameConfig::Powerup::DEFAULT_COUNT << ")\n"
+                  << "  --traffic N      Other cars in the world, driven by the script at staggered offsets (default " << GameConfig::Traffic::DEFAULT_COUNT << ")\n"
+                  << "  --area METERS    Play area size (default " << GameConfig::World::PLAY_AREA_SIZE << ")\n"
+                  << "  --seed N         World seed for the obstacle and powerup layout (default " << GameConfig::World::SEED << ")\n"
+                  << "  --record FILE    Save the run's world and inputs for --replay\n"
+                  << "  --replay FILE    Replay a recording (from here or carsimulator --record) instead of a script\n"
+                  << "  --fleet N        Step N independent vehicles with VehicleBatch instead of the world\n";
+    }
+
+    Options parseOptions(int argc, char** argv) {
+        Options options;
+
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view arg(argv[i]);
+
+            if (arg == "--help" || arg == "-h") {
+                printUsage();
+                std::exit(0);
+            }
+
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("missing value for " + std::string(arg));
+            }
+            const std::string value(argv[++i]);
+
+            if (arg == "--ticks") {
+                options.ticks = std::stoll(value);
+            } else if (arg == "--dt") {
+                options.timeStep = std::stof(value);
+            } else if (arg == "--script") {
+                options.scriptPath = value;
+            } else if (arg == "--trees") {
+                options.treeCount = std::stoi(value);
+            } else if (arg == "--powerups") {
+                options.powerupCount = std::stoi(value);
+            } else if (arg == "--traffic") {
+                options.trafficCount = std::stoi(value);
+            } else if (arg == "--area") {
+                options.playAreaSize = std::stof(value);
+            } else if (arg == "--seed") {
+                options.seed = static_cast<std::uint32_t>(std::stoul(value));
+            } else if (arg == "--record") {
+                options.recordPath = value;
+            } else if (arg == "--replay") {
+                options.replayPath = value;
+            } else if (arg == "--fleet") {
+                options.fleetSize = std::stoll(value);
+            } else {
+                throw std::invalid_argument("unknown option " + std::string(arg));
+            }
+        }
+
+        if (options.ticks <= 0 || options.timeStep <= 0.0f) {
+            throw std::invalid_argument("--ticks and --dt must be positive");
+        }
+        if (options.fleetSize < 0) {
+            throw std::invalid_argument("--fleet must not be negative");
+        }
+        if (options.trafficCount < 0) {
+            throw std::invalid_argument("--traffic must not be negative");
+        }
+        // Recordings only hold the player's controls
+        if (options.trafficCount > 0 && !options.recordPath.empty()) {
+            throw std::invalid_argument("--traffic can't be recorded");
+        }
+
+        return options;
+    }
+
+    // Every vehicle follows the same script, offset in time so the fleet does not move in lockstep
+    void runFleet(const Options& options, const InputScript& script) {
+        const auto fleetSize = static_cast<std::size_t>(options.fleetSize);
+
+        VehicleBatch fleet;
+        fleet.reserve(fleetSize);
+        for (std::size_t i = 0; i < fleetSize; ++i) {
+            fleet.add(GameConfig::World::SPAWN_POINT_X, GameConfig::World::SPAWN_POINT_Y, GameConfig::World::SPAWN_POINT_Z);
+        }
+
+        std::cout << "Running " << options.ticks << " ticks at dt=" << options.timeStep << "s for "
+                  << fleetSize << " vehicles (" << simdLevelName(fleet.getSimdLevel()) << ")" << std::endl;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (long long tick = 0; tick < options.ticks; ++tick) {
+            for (std::size_t i = 0; i < fleetSize; ++i) {
+                const double simTime = static_cast<double>(tick) * options.timeStep + static_cast<double>(i % 64) * 0.25;
+                fleet.setControls(i, script.controlsAt(simTime));
+            }
+            fleet.step(options.timeStep);
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+        const double wallSeconds = std::chrono::duration<double>(end - start).count();
+        const double vehicleTicks = static_cast<double>(options.ticks) * static_cast<double>(fleetSize);
+
+        std::cout << "Simulated " << vehicleTicks << " vehicle ticks in " << wallSeconds << " s wall time" << std::endl;
+        std::cout << "Vehicle ticks/second: "
+                  << static_cast<long long>(wallSeconds > 0.0 ? vehicleTicks / wallSeconds : 0.0) << std::endl;
+    }
+
+    void printResult(const Simulation& simulation, long long ticks, float timeStep, double wallSeconds) {
+        const double simSeconds = static_cast<double>(ticks) * timeStep;
+        const double ticksPerSecond = wallSeconds > 0.0 ? static_cast<double>(ticks) / wallSeconds : 0.0;
+
+        const auto& vehicle = simulation.getVehicle();
+        const auto& position = vehicle.getPosition();
+
+        std::cout << "Simulated " << simSeconds << " s in " << wallSeconds << " s wall time" << std::endl;
+        std::cout << "Ticks/second: " << static_cast<long long>(ticksPerSecond)
+                  << " (" << (wallSeconds > 0.0 ? simSeconds / wallSeconds : 0.0) << "x real time)" << std::endl;
+        // Full precision, so two runs of the same recording can be compared from the output
+        std::cout.precision(9);
+        std::cout << "Final vehicle position: (" << position[0] << ", " << position[2]
+                  << "), rotation " << vehicle.getRotation() << ", velocity " << vehicle.getVelocity() << " m/s" << std::endl;
+    }
+
+    // A recording drives the same world tick for tick, so this is a regression and a performance run
+    void runReplay(const std::string& path) {
+        InputReplay replay(InputRecording::loadFromFile(path));
+        const InputRecording::World& world = replay.getRecording().getWorld();
+        const auto ticks = static_cast<long long>(replay.getRecording().getTickCount());
+
+        std::cout << "Replaying " << ticks << " ticks at dt=" << world.stepSize << "s from " << path
+                  << " (seed " << world.seed << ")" << std::endl;
+
+        const auto start = std::chrono::steady_clock::now();
+        replay.run();
+        const auto end = std::chrono::steady_clock::now();
+
+        printResult(replay.getSimulation(), ticks, world.stepSize, std::chrono::duration<double>(end - start).count());
+    }
+}
+
+int main(int argc, char** argv) {
+    try {
+        const Options options = parseOptions(argc, argv);
+
+        if (!options.replayPath.empty()) {
+            runReplay(options.replayPath);
+            return 0;
+        }
+
+        const InputScript script = options.scriptPath.empty()
+            ? InputScript::defaultLap()
+            : InputScript::loadFromFile(options.scriptPath);
+
+        if (options.fleetSize > 0) {
+            runFleet(options, script);
+            return 0;
+        }
+
+        Simulation simulation(options.playAreaSize, options.treeCount, options.powerupCount, options.seed,
+                              options.trafficCount);
+        VehicleManager& traffic = simulation.getTraffic();
+
+        std::optional<InputRecording> recording;
+        if (!options.recordPath.empty()) {
+            InputRecording::World world;
+            world.seed = options.seed;
+            world.playAreaSize = options.playAreaSize;
+            world.treeCount = options.treeCount;
+            world.powerupCount = options.powerupCount;
+            world.stepSize = options.timeStep;
+            recording.emplace(world);
+        }
+
+        std::cout << "Running " << options.ticks << " ticks at dt=" << options.timeStep << "s ("
+                  << simulation.getObstacleManager().getCount() << " obstacles, "
+                  << simulation.getPowerupManager().getCount() << " powerups, "
+                  << traffic.getCount() << " other cars, seed " << options.seed << ")" << std::endl;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (long long tick = 0; tick < options.ticks; ++tick) {
+            const double simTime = static_cast<double>(tick) * options.timeStep;
+            const ControlState controls = script.controlsAt(simTime);
+            if (recording) {
+                recording->record(static_cast<std::uint64_t>(tick), controls);
+            }
+            // Same script as the player, offset like --fleet so the cars don't move in lockstep
+            for (std::size_t i = 0; i < traffic.getCount(); ++i) {
+                traffic.setControls(i, script.controlsAt(simTime + static_cast<double>((i + 1) % 64) * 0.25));
+            }
+            simulation.step(controls, options.timeStep);
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+        printResult(simulation, options.ticks, options.timeStep, std::chrono::duration<double>(end - start).count());
+
+        if (recording) {
+            recording->setTickCount(static_cast<std::uint64_t>(options.ticks));
+            recording->saveToFile(options.recordPath);
+            std::cout << "Saved " << recording->getCommands().size() << " input changes to " << options.recordPath << std::endl;
+        }
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "carsim_headless: " << e.what() << std::endl;
+        return 1;
+    }
+}
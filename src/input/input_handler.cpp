@@ -4,9 +4,8 @@
 using namespace threepp;
 
 
-InputHandler::InputHandler(IControllable& controllable, SceneManager& sceneManager)
-    : controllable_(controllable),
-      sceneManager_(sceneManager),
+InputHandler::InputHandler(SceneManager& sceneManager)
+    : sceneManager_(sceneManager),
       wPressed_(false),
       sPressed_(false),
       aPressed_(false),
@@ -16,18 +15,12 @@ InputHandler::InputHandler(IControllable& controllable, SceneManager& sceneManag
       leftArrowPressed_(false),
       rightArrowPressed_(false),
       downArrowPressed_(false),
-      shiftPressed_(false),
-      resetCallback_(nullptr) {
-}
-
-void InputHandler::setResetCallback(std::function<void()> callback) {
-    resetCallback_ = std::move(callback);
-}
-
-void InputHandler::onReset() {
-    if (resetCallback_) {
-        resetCallback_();
-    }
+      spacePressed_(false),
+      fPressed_(false),
+      driftTapped_(false),
+      nitrousTapped_(false),
+      resetTapped_(false),
+      profilerToggleTapped_(false) {
 }
 
 void InputHandler::onKeyPressed(KeyEvent evt) {
@@ -63,22 +56,27 @@ void InputHandler::onKeyPressed(KeyEvent evt) {
             updateCamera();
             break;
         case Key::SPACE:
-            controllable_.startDrift();
+            spacePressed_ = true;
+            driftTapped_ = true;
             break;
         case Key::F:
-            if (!shiftPressed_) {
-                controllable_.activateNitrous();
-                shiftPressed_ = true;
-            }
+            fPressed_ = true;
+            nitrousTapped_ = true;
             break;
         case Key::C:
             // Toggle camera mode
             sceneManager_.toggleCameraMode();
             break;
+        case Key::M:
+            // Cycle minimap mode
+            sceneManager_.toggleMinimapMode();
+            break;
+        case Key::P:
+            profilerToggleTapped_ = true;
+            break;
         case Key::R:
-            controllable_.reset();
-            // Trigger reset callback to respawn powerups
-            onReset();
+            // The simulation resets the vehicle and respawns powerups on the next tick
+            resetTapped_ = true;
             break;
         default:
             break;
@@ -114,29 +112,36 @@ void InputHandler::onKeyReleased(KeyEvent evt) {
             updateCamera();
             break;
         case Key::SPACE:
-            controllable_.stopDrift();
+            spacePressed_ = false;
             break;
         case Key::F:
-            shiftPressed_ = false;
+            fPressed_ = false;
             break;
         default:
             break;
     }
 }
 
-void InputHandler::update(float deltaTime) {
-    if (wPressed_) {
-        controllable_.accelerateForward();
-    } else if (sPressed_) {
-        controllable_.accelerateBackward();
-    }
+ControlState InputHandler::pollControls() noexcept {
+    ControlState controls;
+    controls.forward = wPressed_;
+    controls.backward = sPressed_;
+    controls.left = aPressed_;
+    controls.right = dPressed_;
+    controls.drift = spacePressed_ || driftTapped_;
+    controls.nitrous = fPressed_ || nitrousTapped_;
+    controls.reset = resetTapped_;
 
-    if (aPressed_) {
-        controllable_.turn(deltaTime);
-    }
-    if (dPressed_) {
-        controllable_.turn(-deltaTime);
-    }
+    driftTapped_ = false;
+    nitrousTapped_ = false;
+    resetTapped_ = false;
+    return controls;
+}
+
+bool InputHandler::consumeProfilerToggle() noexcept {
+    const bool tapped = profilerToggleTapped_;
+    profilerToggleTapped_ = false;
+    return tapped;
 }
 
 void InputHandler::updateCamera() {
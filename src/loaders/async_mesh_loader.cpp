@@ -0,0 +1,80 @@
+#include "loaders/async_mesh_loader.hpp"
+
+namespace {
+    // A finished load that produced no mesh (nullptr or an exception)
+    bool hasFailed(const AsyncMeshLoader::MeshFuture& future) {
+        if (!isMeshReady(future)) {
+            return false;
+        }
+        try {
+            return future.get() == nullptr;
+        } catch (...) {
+            return true;
+        }
+    }
+}
+
+AsyncMeshLoader::AsyncMeshLoader(MeshLibrary& library)
+    : library_(library),
+      stopping_(false),
+      worker_(&AsyncMeshLoader::run, this) {
+}
+
+AsyncMeshLoader::~AsyncMeshLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    worker_.join();
+
+    // Whatever was still queued resolves as a failed load instead of a broken promise
+    for (auto& [path, promise] : queue_) {
+        promise.set_value(nullptr);
+    }
+}
+
+AsyncMeshLoader::MeshFuture AsyncMeshLoader::request(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (auto it = requested_.find(path); it != requested_.end()) {
+        if (!hasFailed(it->second)) {
+            return it->second;
+        }
+        // Failed before: load it again rather than hand back the old failure
+        requested_.erase(it);
+    }
+
+    std::promise<std::shared_ptr<const MeshData>> promise;
+    MeshFuture future = promise.get_future().share();
+    requested_.emplace(path, future);
+    queue_.emplace_back(path, std::move(promise));
+    wake_.notify_one();
+    return future;
+}
+
+std::size_t AsyncMeshLoader::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+}
+
+void AsyncMeshLoader::run() {
+    while (true) {
+        std::pair<std::string, std::promise<std::shared_ptr<const MeshData>>> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (stopping_) {
+                return;
+            }
+            job = std::move(queue_.front());
+            queue_.pop_front();
+        }
+
+        try {
+            job.second.set_value(library_.load(job.first));
+        } catch (...) {
+            job.second.set_exception(std::current_exception());
+        }
+    }
+}
@@ -0,0 +1,247 @@
+#include "loaders/mesh_cache.hpp"
+#include "loaders/mapped_file.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+namespace {
+    constexpr char MAGIC[8] = {'C', 'S', 'M', 'E', 'S', 'H', '\0', '\0'};
+    constexpr std::uint64_t FNV_OFFSET = 1469598103934665603ULL;
+    constexpr std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t materialCount;
+        std::uint32_t partCount;
+        std::uint32_t reserved;
+        std::uint64_t stamp;
+        float boundsMin[3];
+        float boundsMax[3];
+    };
+    static_assert(sizeof(Header) == 56, "Header layout is part of the file format");
+
+    void mixStamp(std::uint64_t& hash, std::uint64_t value) noexcept {
+        for (int byte = 0; byte < 8; ++byte) {
+            hash ^= (value >> (byte * 8)) & 0xFF;
+            hash *= FNV_PRIME;
+        }
+    }
+
+    // Appends fields padded to 4 bytes so floats stay aligned in the mapping
+    class Writer {
+    public:
+        template <typename T>
+        void put(const T& value) {
+            append(&value, sizeof(T));
+        }
+
+        void putString(const std::string& text) {
+            put(static_cast<std::uint32_t>(text.size()));
+            append(text.data(), text.size());
+            bytes_.resize((bytes_.size() + 3) & ~std::size_t{3}, 0);
+        }
+
+        void putFloats(const std::vector<float>& values) {
+            put(static_cast<std::uint32_t>(values.size()));
+            append(values.data(), values.size() * sizeof(float));
+        }
+
+        [[nodiscard]] const std::vector<char>& bytes() const noexcept { return bytes_; }
+
+    private:
+        void append(const void* data, std::size_t size) {
+            const auto* first = static_cast<const char*>(data);
+            bytes_.insert(bytes_.end(), first, first + size);
+        }
+
+        std::vector<char> bytes_;
+    };
+
+    // Bounds-checked cursor over the mapped file; any overrun marks the read as failed
+    class Reader {
+    public:
+        Reader(const unsigned char* data, std::size_t size)
+            : data_(data), size_(size), offset_(0), failed_(false) {
+        }
+
+        template <typename T>
+        T get() {
+            T value{};
+            copy(&value, sizeof(T));
+            return value;
+        }
+
+        std::string getString() {
+            const auto length = get<std::uint32_t>();
+            if (!has(length)) {
+                failed_ = true;
+                return {};
+            }
+            std::string text(reinterpret_cast<const char*>(data_ + offset_), length);
+            const std::size_t padded = (offset_ + length + 3) & ~std::size_t{3};
+            failed_ = padded > size_;
+            offset_ = failed_ ? size_ : padded;
+            return text;
+        }
+
+        std::vector<float> getFloats() {
+            const auto count = get<std::uint32_t>();
+            std::vector<float> values;
+            if (!has(std::size_t{count} * sizeof(float))) {
+                failed_ = true;
+                return values;
+            }
+            values.resize(count);
+            copy(values.data(), values.size() * sizeof(float));
+            return values;
+        }
+
+        [[nodiscard]] bool failed() const noexcept { return failed_; }
+        [[nodiscard]] bool atEnd() const noexcept { return offset_ == size_; }
+
+    private:
+        [[nodiscard]] bool has(std::size_t bytes) const noexcept {
+            return !failed_ && bytes <= size_ - offset_;
+        }
+
+        void copy(void* destination, std::size_t bytes) {
+            if (!has(bytes)) {
+                failed_ = true;
+                return;
+            }
+            std::memcpy(destination, data_ + offset_, bytes);
+            offset_ += bytes;
+        }
+
+        const unsigned char* data_;
+        std::size_t size_;
+        std::size_t offset_;
+        bool failed_;
+    };
+}
+
+std::string MeshCache::cachePathFor(const std::string& sourcePath) {
+    return sourcePath + ".meshcache";
+}
+
+std::uint64_t MeshCache::sourceStamp(const std::string& sourcePath) {
+    namespace fs = std::filesystem;
+    std::error_code error;
+
+    std::uint64_t hash = FNV_OFFSET;
+    mixStamp(hash, FORMAT_VERSION);
+
+    bool found = false;
+    for (const fs::path& path : {fs::path(sourcePath), fs::path(sourcePath).replace_extension(".mtl")}) {
+        const auto size = fs::file_size(path, error);
+        if (error) {
+            continue;
+        }
+        const auto modified = fs::last_write_time(path, error);
+        if (error) {
+            continue;
+        }
+        mixStamp(hash, size);
+        mixStamp(hash, static_cast<std::uint64_t>(modified.time_since_epoch().count()));
+        found = found || path == fs::path(sourcePath);
+    }
+
+    // Never 0 for an existing file, so 0 can mean "no source"
+    return found ? (hash | 1) : 0;
+}
+
+bool MeshCache::write(const std::string& cachePath, const MeshData& mesh, std::uint64_t stamp) {
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = FORMAT_VERSION;
+    header.materialCount = static_cast<std::uint32_t>(mesh.materials.size());
+    header.partCount = static_cast<std::uint32_t>(mesh.parts.size());
+    header.stamp = stamp;
+    std::memcpy(header.boundsMin, mesh.boundsMin.data(), sizeof(header.boundsMin));
+    std::memcpy(header.boundsMax, mesh.boundsMax.data(), sizeof(header.boundsMax));
+
+    Writer writer;
+    writer.put(header);
+    for (const MeshMaterial& material : mesh.materials) {
+        writer.putString(material.name);
+        writer.put(material.diffuse);
+        writer.put(material.specular);
+        writer.put(material.emissive);
+        writer.put(material.shininess);
+        writer.put(material.opacity);
+    }
+    for (const MeshPart& part : mesh.parts) {
+        writer.putString(part.name);
+        writer.put(part.materialIndex);
+        writer.putFloats(part.positions);
+        writer.putFloats(part.normals);
+        writer.putFloats(part.uvs);
+    }
+
+    // Write to a temporary name first so a crash never leaves half a cache behind
+    const std::string temporaryPath = cachePath + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        file.write(writer.bytes().data(), static_cast<std::streamsize>(writer.bytes().size()));
+        if (!file) {
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporaryPath, cachePath, error);
+    if (error) {
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+    return true;
+}
+
+std::optional<MeshData> MeshCache::read(const std::string& cachePath, std::uint64_t expectedStamp) {
+    const MappedFile file(cachePath);
+    if (!file.isOpen()) {
+        return std::nullopt;
+    }
+
+    Reader reader(file.data(), file.size());
+    const auto header = reader.get<Header>();
+    if (reader.failed() || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        header.version != FORMAT_VERSION || header.stamp != expectedStamp) {
+        return std::nullopt;
+    }
+
+    MeshData mesh;
+    std::memcpy(mesh.boundsMin.data(), header.boundsMin, sizeof(header.boundsMin));
+    std::memcpy(mesh.boundsMax.data(), header.boundsMax, sizeof(header.boundsMax));
+
+    // Counts come from the file, so grow as records are read instead of trusting them up front
+    for (std::uint32_t i = 0; i < header.materialCount && !reader.failed(); ++i) {
+        MeshMaterial material;
+        material.name = reader.getString();
+        material.diffuse = reader.get<std::array<float, 3>>();
+        material.specular = reader.get<std::array<float, 3>>();
+        material.emissive = reader.get<std::array<float, 3>>();
+        material.shininess = reader.get<float>();
+        material.opacity = reader.get<float>();
+        mesh.materials.push_back(std::move(material));
+    }
+    for (std::uint32_t i = 0; i < header.partCount && !reader.failed(); ++i) {
+        MeshPart part;
+        part.name = reader.getString();
+        part.materialIndex = reader.get<std::uint32_t>();
+        part.positions = reader.getFloats();
+        part.normals = reader.getFloats();
+        part.uvs = reader.getFloats();
+        mesh.parts.push_back(std::move(part));
+    }
+
+    if (reader.failed() || !reader.atEnd()) {
+        return std::nullopt;
+    }
+    return mesh;
+}
@@ -0,0 +1,44 @@
+#include "loaders/mesh_data.hpp"
+#include <algorithm>
+#include <limits>
+
+void MeshData::computeBounds() noexcept {
+    constexpr float INF = std::numeric_limits<float>::infinity();
+    std::array<float, 3> low{INF, INF, INF};
+    std::array<float, 3> high{-INF, -INF, -INF};
+
+    for (const MeshPart& part : parts) {
+        for (std::size_t i = 0; i + 2 < part.positions.size(); i += 3) {
+            for (std::size_t axis = 0; axis < 3; ++axis) {
+                low[axis] = (std::min)(low[axis], part.positions[i + axis]);
+                high[axis] = (std::max)(high[axis], part.positions[i + axis]);
+            }
+        }
+    }
+
+    // No vertices: collapse to the origin rather than keep infinities around
+    if (low[0] > high[0]) {
+        low = {0.0f, 0.0f, 0.0f};
+        high = {0.0f, 0.0f, 0.0f};
+    }
+    boundsMin = low;
+    boundsMax = high;
+}
+
+std::array<float, 3> MeshData::getCenter() const noexcept {
+    return {(boundsMin[0] + boundsMax[0]) * 0.5f,
+            (boundsMin[1] + boundsMax[1]) * 0.5f,
+            (boundsMin[2] + boundsMax[2]) * 0.5f};
+}
+
+std::array<float, 3> MeshData::getSize() const noexcept {
+    return {boundsMax[0] - boundsMin[0], boundsMax[1] - boundsMin[1], boundsMax[2] - boundsMin[2]};
+}
+
+std::size_t MeshData::getVertexCount() const noexcept {
+    std::size_t count = 0;
+    for (const MeshPart& part : parts) {
+        count += part.positions.size() / 3;
+    }
+    return count;
+}
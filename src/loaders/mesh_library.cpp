@@ -0,0 +1,54 @@
+#include "loaders/mesh_library.hpp"
+#include "loaders/mesh_cache.hpp"
+#include "core/logger.hpp"
+#include <utility>
+
+MeshLibrary::MeshLibrary(Parser parser, bool useDiskCache)
+    : parser_(std::move(parser)),
+      useDiskCache_(useDiskCache) {
+}
+
+std::shared_ptr<const MeshData> MeshLibrary::load(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (auto it = meshes_.find(path); it != meshes_.end()) {
+        ++stats_.memoryHits;
+        return it->second;
+    }
+
+    const std::uint64_t stamp = useDiskCache_ ? MeshCache::sourceStamp(path) : 0;
+    const std::string cachePath = MeshCache::cachePathFor(path);
+
+    std::optional<MeshData> mesh;
+    if (stamp != 0) {
+        mesh = MeshCache::read(cachePath, stamp);
+        if (mesh) {
+            ++stats_.diskHits;
+        }
+    }
+
+    if (!mesh && parser_) {
+        mesh = parser_(path);
+        if (mesh) {
+            ++stats_.parses;
+            mesh->computeBounds();
+            if (stamp != 0 && !MeshCache::write(cachePath, *mesh, stamp)) {
+                Logger::warning(Logger::Tag::LOADERS, "Could not write mesh cache ", cachePath);
+            }
+        }
+    }
+
+    // Failures aren't remembered, so a file that shows up or is fixed later loads on retry
+    if (!mesh) {
+        ++stats_.failures;
+        return nullptr;
+    }
+    auto result = std::make_shared<const MeshData>(std::move(*mesh));
+    meshes_.emplace(path, result);
+    return result;
+}
+
+MeshLibrary::Stats MeshLibrary::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
@@ -0,0 +1,513 @@
+#include "loaders/obj_parser.hpp"
+#include "loaders/mapped_file.hpp"
+#include "core/logger.hpp"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+    // Smaller chunks cost more in thread start-up than they save
+    constexpr std::size_t MIN_CHUNK_BYTES = 64 * 1024;
+    constexpr std::int32_t MISSING_INDEX = -1;
+
+    enum class Record {
+        POSITION,
+        UV,
+        NORMAL,
+        FACE,
+        OBJECT,
+        MATERIAL,
+        LIBRARY,
+        OTHER
+    };
+
+    // Indices into the file-wide vertex arrays, 0-based
+    struct Corner {
+        std::int32_t position;
+        std::int32_t uv;
+        std::int32_t normal;
+    };
+
+    // Faces of one chunk up to the next o/g/usemtl. The first segment of a chunk
+    // continues whatever the previous chunk ended with.
+    struct Segment {
+        bool startsObject = false;
+        bool startsMaterial = false;
+        std::string objectName;
+        std::string materialName;
+        std::vector<Corner> corners;  // Three per triangle
+        MeshPart geometry;            // Corners expanded to vertices
+
+        [[nodiscard]] bool hasFaces() const noexcept { return !corners.empty() || !geometry.positions.empty(); }
+    };
+
+    struct Chunk {
+        std::string_view text;
+        std::size_t positionCount = 0;
+        std::size_t uvCount = 0;
+        std::size_t normalCount = 0;
+        std::size_t positionBase = 0;
+        std::size_t uvBase = 0;
+        std::size_t normalBase = 0;
+        std::vector<Segment> segments;
+        std::vector<std::string> libraries;
+    };
+
+    struct VertexArrays {
+        std::vector<float> positions;
+        std::vector<float> uvs;
+        std::vector<float> normals;
+    };
+
+    [[nodiscard]] bool isBlank(char c) noexcept {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    [[nodiscard]] std::string_view trim(std::string_view text) noexcept {
+        while (!text.empty() && isBlank(text.front())) text.remove_prefix(1);
+        while (!text.empty() && isBlank(text.back())) text.remove_suffix(1);
+        return text;
+    }
+
+    // Next blank-separated token; text is advanced past it
+    [[nodiscard]] std::string_view nextToken(std::string_view& text) noexcept {
+        std::size_t begin = 0;
+        while (begin < text.size() && isBlank(text[begin])) ++begin;
+        std::size_t end = begin;
+        while (end < text.size() && !isBlank(text[end])) ++end;
+        const std::string_view token = text.substr(begin, end - begin);
+        text.remove_prefix(end);
+        return token;
+    }
+
+    template <typename Number>
+    [[nodiscard]] bool parseNumber(std::string_view token, Number& value) noexcept {
+        if (!token.empty() && token.front() == '+') {
+            token.remove_prefix(1);  // from_chars takes no sign but '-'
+        }
+        const auto result = std::from_chars(token.data(), token.data() + token.size(), value);
+        return result.ec == std::errc() && result.ptr != token.data();
+    }
+
+    // Up to count numbers from text into out; missing or malformed ones are left untouched
+    void readFloats(std::string_view text, float* out, std::size_t count) noexcept {
+        for (std::size_t i = 0; i < count; ++i) {
+            float value;
+            if (parseNumber(nextToken(text), value)) {
+                out[i] = value;
+            }
+        }
+    }
+
+    template <typename Visitor>
+    void forEachLine(std::string_view text, Visitor&& visit) {
+        std::size_t begin = 0;
+        while (begin < text.size()) {
+            std::size_t end = text.find('\n', begin);
+            if (end == std::string_view::npos) {
+                end = text.size();
+            }
+            visit(text.substr(begin, end - begin));
+            begin = end + 1;
+        }
+    }
+
+    [[nodiscard]] Record classify(std::string_view keyword) noexcept {
+        if (keyword == "v") return Record::POSITION;
+        if (keyword == "vt") return Record::UV;
+        if (keyword == "vn") return Record::NORMAL;
+        if (keyword == "f") return Record::FACE;
+        if (keyword == "o" || keyword == "g") return Record::OBJECT;
+        if (keyword == "usemtl") return Record::MATERIAL;
+        if (keyword == "mtllib") return Record::LIBRARY;
+        return Record::OTHER;
+    }
+
+    // OBJ indices are 1-based, or relative to the end when negative
+    [[nodiscard]] std::int32_t resolveIndex(std::string_view token, std::size_t countSoFar) noexcept {
+        std::int64_t raw = 0;
+        if (token.empty() || !parseNumber(token, raw) || raw == 0) {
+            return MISSING_INDEX;
+        }
+        const std::int64_t index = raw > 0 ? raw - 1 : static_cast<std::int64_t>(countSoFar) + raw;
+        return index >= 0 && index <= INT32_MAX ? static_cast<std::int32_t>(index) : MISSING_INDEX;
+    }
+
+    // v, v/t, v//n or v/t/n
+    [[nodiscard]] Corner parseCorner(std::string_view token, std::size_t positions, std::size_t uvs, std::size_t normals) noexcept {
+        const std::size_t firstSlash = token.find('/');
+        if (firstSlash == std::string_view::npos) {
+            return {resolveIndex(token, positions), MISSING_INDEX, MISSING_INDEX};
+        }
+        const std::size_t secondSlash = token.find('/', firstSlash + 1);
+        const std::string_view uv = token.substr(firstSlash + 1, secondSlash == std::string_view::npos
+                                                                     ? std::string_view::npos
+                                                                     : secondSlash - firstSlash - 1);
+        const std::string_view normal = secondSlash == std::string_view::npos ? std::string_view{} : token.substr(secondSlash + 1);
+        return {resolveIndex(token.substr(0, firstSlash), positions), resolveIndex(uv, uvs), resolveIndex(normal, normals)};
+    }
+
+    // Run task on every chunk, one thread each (the first on the caller's)
+    template <typename Task>
+    void forEachChunkParallel(std::vector<Chunk>& chunks, Task&& task) {
+        std::vector<std::thread> workers;
+        workers.reserve(chunks.size());
+        for (std::size_t i = 1; i < chunks.size(); ++i) {
+            workers.emplace_back([&task, &chunk = chunks[i]] { task(chunk); });
+        }
+        if (!chunks.empty()) {
+            task(chunks.front());
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    [[nodiscard]] std::vector<Chunk> splitIntoChunks(std::string_view text, std::size_t chunkCount) {
+        std::vector<Chunk> chunks;
+        std::size_t begin = 0;
+        for (std::size_t i = 1; i <= chunkCount && begin < text.size(); ++i) {
+            std::size_t end = text.size();
+            if (i < chunkCount) {
+                end = text.find('\n', (std::max)(begin, text.size() / chunkCount * i));
+                end = end == std::string_view::npos ? text.size() : end + 1;
+            }
+            Chunk chunk;
+            chunk.text = text.substr(begin, end - begin);
+            chunks.push_back(std::move(chunk));
+            begin = end;
+        }
+        return chunks;
+    }
+
+    // Pass 1: how many vertex records each chunk holds
+    void countRecords(Chunk& chunk) {
+        forEachLine(chunk.text, [&chunk](std::string_view line) {
+            switch (classify(nextToken(line))) {
+                case Record::POSITION: ++chunk.positionCount; break;
+                case Record::UV: ++chunk.uvCount; break;
+                case Record::NORMAL: ++chunk.normalCount; break;
+                default: break;
+            }
+        });
+    }
+
+    // Pass 2: vertex records into the shared arrays (each chunk owns a disjoint range),
+    // faces as triangle fans of resolved indices, and the o/g/usemtl structure
+    void parseRecords(Chunk& chunk, VertexArrays& arrays) {
+        std::size_t positions = chunk.positionBase;
+        std::size_t uvs = chunk.uvBase;
+        std::size_t normals = chunk.normalBase;
+        std::vector<Corner> polygon;
+
+        chunk.segments.emplace_back();
+        forEachLine(chunk.text, [&](std::string_view line) {
+            std::string_view rest = line;
+            switch (classify(nextToken(rest))) {
+                case Record::POSITION:
+                    readFloats(rest, &arrays.positions[positions++ * 3], 3);
+                    break;
+                case Record::UV:
+                    readFloats(rest, &arrays.uvs[uvs++ * 2], 2);
+                    break;
+                case Record::NORMAL:
+                    readFloats(rest, &arrays.normals[normals++ * 3], 3);
+                    break;
+                case Record::FACE: {
+                    polygon.clear();
+                    for (std::string_view token = nextToken(rest); !token.empty(); token = nextToken(rest)) {
+                        polygon.push_back(parseCorner(token, positions, uvs, normals));
+                    }
+                    auto& corners = chunk.segments.back().corners;
+                    for (std::size_t i = 2; i < polygon.size(); ++i) {
+                        corners.push_back(polygon[0]);
+                        corners.push_back(polygon[i - 1]);
+                        corners.push_back(polygon[i]);
+                    }
+                    break;
+                }
+                case Record::OBJECT: {
+                    if (chunk.segments.back().hasFaces()) {
+                        chunk.segments.emplace_back();
+                    }
+                    Segment& segment = chunk.segments.back();
+                    segment.startsObject = true;
+                    segment.objectName = trim(rest);
+                    break;
+                }
+                case Record::MATERIAL: {
+                    if (chunk.segments.back().hasFaces()) {
+                        chunk.segments.emplace_back();
+                    }
+                    Segment& segment = chunk.segments.back();
+                    segment.startsMaterial = true;
+                    segment.materialName = trim(rest);
+                    break;
+                }
+                case Record::LIBRARY:
+                    chunk.libraries.emplace_back(trim(rest));
+                    break;
+                case Record::OTHER:
+                    break;
+            }
+        });
+    }
+
+    // Pass 3: triangles of resolved indices into flat vertex attributes
+    void expandFaces(Chunk& chunk, const VertexArrays& arrays) {
+        const std::size_t positionCount = arrays.positions.size() / 3;
+        const std::size_t uvCount = arrays.uvs.size() / 2;
+        const std::size_t normalCount = arrays.normals.size() / 3;
+
+        for (Segment& segment : chunk.segments) {
+            const auto& corners = segment.corners;
+            const bool hasUvs = std::any_of(corners.begin(), corners.end(), [](const Corner& c) { return c.uv != MISSING_INDEX; });
+            const bool hasNormals = std::any_of(corners.begin(), corners.end(), [](const Corner& c) { return c.normal != MISSING_INDEX; });
+
+            MeshPart& part = segment.geometry;
+            part.positions.reserve(corners.size() * 3);
+            if (hasNormals) part.normals.reserve(corners.size() * 3);
+            if (hasUvs) part.uvs.reserve(corners.size() * 2);
+
+            for (std::size_t i = 0; i + 2 < corners.size(); i += 3) {
+                const Corner* triangle = &corners[i];
+                const bool valid = std::all_of(triangle, triangle + 3, [positionCount](const Corner& c) {
+                    return c.position != MISSING_INDEX && static_cast<std::size_t>(c.position) < positionCount;
+                });
+                if (!valid) {
+                    continue;
+                }
+
+                // Flat normal for corners without one, so a triangle never gets a zero normal
+                std::array<float, 3> faceNormal{0.0f, 0.0f, 0.0f};
+                if (hasNormals) {
+                    const float* a = &arrays.positions[triangle[0].position * 3];
+                    const float* b = &arrays.positions[triangle[1].position * 3];
+                    const float* c = &arrays.positions[triangle[2].position * 3];
+                    const float ab[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+                    const float ac[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+                    faceNormal = {ab[1] * ac[2] - ab[2] * ac[1], ab[2] * ac[0] - ab[0] * ac[2], ab[0] * ac[1] - ab[1] * ac[0]};
+                    const float length = std::sqrt(faceNormal[0] * faceNormal[0] + faceNormal[1] * faceNormal[1] +
+                                                   faceNormal[2] * faceNormal[2]);
+                    if (length > 0.0f) {
+                        for (float& component : faceNormal) component /= length;
+                    }
+                }
+
+                for (int k = 0; k < 3; ++k) {
+                    const Corner& corner = triangle[k];
+                    const float* position = &arrays.positions[corner.position * 3];
+                    part.positions.insert(part.positions.end(), position, position + 3);
+
+                    if (hasNormals) {
+                        if (corner.normal != MISSING_INDEX && static_cast<std::size_t>(corner.normal) < normalCount) {
+                            const float* normal = &arrays.normals[corner.normal * 3];
+                            part.normals.insert(part.normals.end(), normal, normal + 3);
+                        } else {
+                            part.normals.insert(part.normals.end(), faceNormal.begin(), faceNormal.end());
+                        }
+                    }
+                    if (hasUvs) {
+                        if (corner.uv != MISSING_INDEX && static_cast<std::size_t>(corner.uv) < uvCount) {
+                            const float* uv = &arrays.uvs[corner.uv * 2];
+                            part.uvs.insert(part.uvs.end(), uv, uv + 2);
+                        } else {
+                            part.uvs.insert(part.uvs.end(), {0.0f, 0.0f});
+                        }
+                    }
+                }
+            }
+
+            segment.corners = {};
+        }
+    }
+
+    // Append an optional attribute, zero-filling whichever side lacks it
+    void appendAttribute(std::vector<float>& target, std::size_t targetVertices, const std::vector<float>& source,
+                         std::size_t sourceVertices, std::size_t components) {
+        if (source.empty() && target.empty()) {
+            return;
+        }
+        target.resize(targetVertices * components, 0.0f);
+        if (source.empty()) {
+            target.resize((targetVertices + sourceVertices) * components, 0.0f);
+        } else {
+            target.insert(target.end(), source.begin(), source.end());
+        }
+    }
+
+    void appendGeometry(MeshPart& target, const MeshPart& source) {
+        const std::size_t targetVertices = target.positions.size() / 3;
+        const std::size_t sourceVertices = source.positions.size() / 3;
+        appendAttribute(target.normals, targetVertices, source.normals, sourceVertices, 3);
+        appendAttribute(target.uvs, targetVertices, source.uvs, sourceVertices, 2);
+        target.positions.insert(target.positions.end(), source.positions.begin(), source.positions.end());
+    }
+
+    [[nodiscard]] std::unordered_map<std::string, MeshMaterial> loadLibraries(const std::vector<Chunk>& chunks,
+                                                                              const std::string& directory) {
+        std::unordered_map<std::string, MeshMaterial> materials;
+        for (const Chunk& chunk : chunks) {
+            for (const std::string& library : chunk.libraries) {
+                const std::string path = (std::filesystem::path(directory) / library).string();
+                MappedFile file(path);
+                if (!file.isOpen()) {
+                    Logger::warning(Logger::Tag::LOADERS, "Material library not found: ", path);
+                    continue;
+                }
+                const std::string_view text(reinterpret_cast<const char*>(file.data()), file.size());
+                for (MeshMaterial& material : ObjParser::parseMaterials(text)) {
+                    std::string name = material.name;
+                    materials.insert_or_assign(std::move(name), std::move(material));
+                }
+            }
+        }
+        return materials;
+    }
+}
+
+std::optional<MeshData> ObjParser::parseFile(const std::string& path, unsigned int threadCount) {
+    MappedFile file(path);
+    if (!file.isOpen()) {
+        return std::nullopt;
+    }
+    const std::string_view text(reinterpret_cast<const char*>(file.data()), file.size());
+    return parse(text, std::filesystem::path(path).parent_path().string(), threadCount);
+}
+
+std::optional<MeshData> ObjParser::parse(std::string_view text, const std::string& materialDirectory,
+                                         unsigned int threadCount) {
+    if (threadCount == 0) {
+        threadCount = (std::max)(1u, std::thread::hardware_concurrency());
+    }
+    const std::size_t chunkCount = std::clamp<std::size_t>(text.size() / MIN_CHUNK_BYTES, 1, threadCount);
+    std::vector<Chunk> chunks = splitIntoChunks(text, chunkCount);
+
+    forEachChunkParallel(chunks, countRecords);
+
+    // Each chunk's vertices start where the previous chunk's end
+    VertexArrays arrays;
+    std::size_t positions = 0, uvs = 0, normals = 0;
+    for (Chunk& chunk : chunks) {
+        chunk.positionBase = positions;
+        chunk.uvBase = uvs;
+        chunk.normalBase = normals;
+        positions += chunk.positionCount;
+        uvs += chunk.uvCount;
+        normals += chunk.normalCount;
+    }
+    arrays.positions.assign(positions * 3, 0.0f);
+    arrays.uvs.assign(uvs * 2, 0.0f);
+    arrays.normals.assign(normals * 3, 0.0f);
+
+    forEachChunkParallel(chunks, [&arrays](Chunk& chunk) { parseRecords(chunk, arrays); });
+    forEachChunkParallel(chunks, [&arrays](Chunk& chunk) { expandFaces(chunk, arrays); });
+
+    // Stitch segments in file order, following OBJLoader: o/g starts an object (or names the
+    // implicit first one), usemtl starts a material group, and a new object keeps the current material
+    struct Group {
+        std::string materialName;
+        MeshPart geometry;
+    };
+    struct Object {
+        std::string name;
+        bool declared = false;
+        std::vector<Group> groups;
+    };
+
+    std::vector<Object> objects(1);
+    std::string materialName;
+    bool startGroup = true;
+    for (Chunk& chunk : chunks) {
+        for (Segment& segment : chunk.segments) {
+            if (segment.startsObject) {
+                if (objects.back().declared) {
+                    objects.emplace_back();
+                    startGroup = true;
+                }
+                objects.back().name = std::move(segment.objectName);
+                objects.back().declared = true;
+            }
+            if (segment.startsMaterial) {
+                materialName = std::move(segment.materialName);
+                startGroup = true;
+            }
+            if (segment.geometry.positions.empty()) {
+                continue;
+            }
+
+            auto& groups = objects.back().groups;
+            if (startGroup || groups.empty()) {
+                groups.push_back({materialName, MeshPart{}});
+                startGroup = false;
+            }
+            appendGeometry(groups.back().geometry, segment.geometry);
+            segment.geometry = {};
+        }
+    }
+
+    const auto library = loadLibraries(chunks, materialDirectory);
+
+    // One material entry per group, like the OBJLoader path
+    MeshData mesh;
+    for (Object& object : objects) {
+        for (Group& group : object.groups) {
+            MeshMaterial material;
+            material.name = group.materialName;
+            if (auto it = library.find(group.materialName); it != library.end()) {
+                material = it->second;
+            }
+            mesh.materials.push_back(std::move(material));
+
+            group.geometry.name = object.name;
+            group.geometry.materialIndex = static_cast<std::uint32_t>(mesh.materials.size() - 1);
+            mesh.parts.push_back(std::move(group.geometry));
+        }
+    }
+
+    if (mesh.empty()) {
+        return std::nullopt;
+    }
+    mesh.computeBounds();
+    return mesh;
+}
+
+std::vector<MeshMaterial> ObjParser::parseMaterials(std::string_view text) {
+    std::vector<MeshMaterial> materials;
+    forEachLine(text, [&materials](std::string_view line) {
+        std::string_view rest = line;
+        const std::string_view keyword = nextToken(rest);
+        if (keyword == "newmtl") {
+            materials.emplace_back();
+            materials.back().name = trim(rest);
+            return;
+        }
+        if (materials.empty()) {
+            return;
+        }
+
+        MeshMaterial& material = materials.back();
+        if (keyword == "Kd") {
+            readFloats(rest, material.diffuse.data(), 3);
+        } else if (keyword == "Ks") {
+            readFloats(rest, material.specular.data(), 3);
+        } else if (keyword == "Ke") {
+            readFloats(rest, material.emissive.data(), 3);
+        } else if (keyword == "Ns") {
+            readFloats(rest, &material.shininess, 1);
+        } else if (keyword == "d") {
+            readFloats(rest, &material.opacity, 1);
+        } else if (keyword == "Tr") {
+            float transparency = 0.0f;
+            readFloats(rest, &transparency, 1);
+            material.opacity = 1.0f - transparency;
+        }
+    });
+    return materials;
+}
@@ -1,13 +1,16 @@
 #include <threepp/threepp.hpp>
 #include "core/game.hpp"
+#include "core/profiler.hpp"
 #include "ui/imgui_context.hpp"
 #include <iostream>
 #include <stdexcept>
 #include <memory>
+#include <string>
+#include <string_view>
 
 using namespace threepp;
 
-int main() {
+int main(int argc, char** argv) {
     try {
         std::cout << "Starting Car Simulator..." << std::endl;
 
@@ -24,9 +27,16 @@ int main() {
 
         std::cout << "Creating game instance..." << std::endl;
         auto game = std::make_unique<Game>(canvas);
+        // --record FILE saves the session for carsim_headless --replay
+        for (int i = 1; i + 1 < argc; ++i) {
+            if (std::string_view(argv[i]) == "--record") {
+                game->recordInputTo(argv[++i]);
+            }
+        }
         game->initialize();
 
         std::cout << "Entering main game loop..." << std::endl;
+        CARSIM_PROFILE_THREAD("Main");
 
         canvas.animate([&game, &imguiContext] {
             try {
@@ -42,7 +52,11 @@ int main() {
 
                 game->render();
 
-                imguiContext->render();
+                {
+                    CARSIM_PROFILE_ZONE("ImGui::render");
+                    imguiContext->render();
+                }
+                CARSIM_PROFILE_FRAME();
 
             } catch (const std::exception& e) {
                 std::cerr << "Error in game loop: " << e.what() << std::endl;
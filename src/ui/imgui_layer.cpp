@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <string_view>
 #include <cfloat>
+#include <functional>
 
 namespace {
     // Color conversion constant
@@ -21,6 +22,15 @@ namespace {
     constexpr float GAUGE_THICKNESS_SCALE = 0.04f;
     constexpr float GAUGE_OUTER_MARGIN_BASE = 6.0f;
     constexpr float GAUGE_OUTER_MARGIN_SCALE = 0.06f;
+
+    // Profiler panel
+    constexpr float PROFILER_WINDOW_WIDTH = 520.0f;
+    constexpr float PROFILER_WINDOW_HEIGHT = 300.0f;
+    constexpr float PROFILER_PLOT_HEIGHT = 60.0f;
+    constexpr float PROFILER_PLOT_HEADROOM = 1.5f;  // Plot scale relative to p99
+    constexpr float PROFILER_ROW_HEIGHT = 18.0f;
+    constexpr float PROFILER_TEXT_PADDING = 3.0f;
+    constexpr float NANOSECONDS_PER_MILLISECOND = 1e6f;
 }
 
 ImGuiLayer::ImGuiLayer() = default;
@@ -248,3 +258,64 @@ void ImGuiLayer::render(const IVehicleState& vehicle, const threepp::WindowSize&
 
 
 }
+
+bool ImGuiLayer::renderProfiler(const Profiler& profiler) {
+    if (!ImGui::GetCurrentContext()) return false;
+
+    bool saveRequested = false;
+    ImGui::SetNextWindowSize(ImVec2(PROFILER_WINDOW_WIDTH, PROFILER_WINDOW_HEIGHT), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Profiler")) {
+#ifndef CARSIM_ENABLE_PROFILER
+        ImGui::TextUnformatted("Built without CARSIM_ENABLE_PROFILER: no zones are recorded");
+#endif
+        const Profiler::FrameStats stats = profiler.getFrameStats();
+        ImGui::Text("Frame %.2f ms   p50 %.2f   p95 %.2f   p99 %.2f ms   (%zu frames)", stats.lastMilliseconds,
+                    stats.p50Milliseconds, stats.p95Milliseconds, stats.p99Milliseconds, stats.frameCount);
+
+        const std::vector<float> frameTimes = profiler.getFrameTimes();
+        if (!frameTimes.empty()) {
+            ImGui::PlotLines("##frameTimes", frameTimes.data(), static_cast<int>(frameTimes.size()), 0, nullptr, 0.0f,
+                             stats.p99Milliseconds * PROFILER_PLOT_HEADROOM, ImVec2(-1.0f, PROFILER_PLOT_HEIGHT));
+        }
+
+        // Flame view: one row per nesting level, bar widths proportional to time in the last frame
+        const auto& zones = profiler.getLastFrameZones();
+        const float frameNanoseconds = static_cast<float>(profiler.getLastFrameEnd() - profiler.getLastFrameStart());
+        if (!zones.empty() && frameNanoseconds > 0.0f) {
+            std::uint32_t maxDepth = 0;
+            for (const auto& zone : zones) {
+                maxDepth = (std::max)(maxDepth, zone.depth);
+            }
+
+            const ImVec2 origin = ImGui::GetCursorScreenPos();
+            const float width = ImGui::GetContentRegionAvail().x;
+            ImGui::Dummy(ImVec2(width, static_cast<float>(maxDepth + 1) * PROFILER_ROW_HEIGHT));
+
+            ImDrawList* dl = ImGui::GetWindowDrawList();
+            for (const auto& zone : zones) {
+                const float x0 = origin.x + static_cast<float>(zone.startNanoseconds - profiler.getLastFrameStart()) / frameNanoseconds * width;
+                const float x1 = origin.x + static_cast<float>(zone.endNanoseconds - profiler.getLastFrameStart()) / frameNanoseconds * width;
+                const float y0 = origin.y + static_cast<float>(zone.depth) * PROFILER_ROW_HEIGHT;
+                const ImVec2 min(x0, y0);
+                const ImVec2 max((std::max)(x1, x0 + 1.0f), y0 + PROFILER_ROW_HEIGHT - 1.0f);
+
+                // Stable colour per zone name
+                const std::size_t hash = std::hash<std::string_view>{}(zone.name);
+                const ImU32 color = IM_COL32(80 + hash % 150, 80 + (hash >> 8) % 150, 80 + (hash >> 16) % 150, 255);
+                dl->AddRectFilled(min, max, color);
+
+                if (ImGui::CalcTextSize(zone.name).x + 2.0f * PROFILER_TEXT_PADDING < max.x - min.x) {
+                    dl->AddText(ImVec2(min.x + PROFILER_TEXT_PADDING, min.y + 1.0f), IM_COL32(0, 0, 0, 255), zone.name);
+                }
+                if (ImGui::IsMouseHoveringRect(min, max)) {
+                    ImGui::SetTooltip("%s: %.3f ms", zone.name,
+                                      static_cast<float>(zone.endNanoseconds - zone.startNanoseconds) / NANOSECONDS_PER_MILLISECOND);
+                }
+            }
+        }
+
+        saveRequested = ImGui::Button("Save Chrome trace");
+    }
+    ImGui::End();
+    return saveRequested;
+}
@@ -0,0 +1,104 @@
+#include "ui/minimap_overlay.hpp"
+#include <imgui.h>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Colors follow the 3D scene
+    constexpr ImU32 GROUND_COLOR = IM_COL32(0x3a, 0x7d, 0x44, 255);
+    constexpr ImU32 WALL_COLOR = IM_COL32(0x8b, 0x45, 0x13, 255);
+    constexpr ImU32 TREE_COLOR = IM_COL32(0x22, 0x8b, 0x22, 255);
+    constexpr ImU32 POWERUP_COLOR = IM_COL32(0x00, 0xaa, 0xff, 255);
+    constexpr ImU32 VEHICLE_COLOR = IM_COL32(255, 0, 0, 255);
+    constexpr ImU32 HEADING_COLOR = IM_COL32(255, 255, 255, 255);
+    constexpr ImU32 BORDER_COLOR = IM_COL32(20, 20, 20, 220);
+
+    constexpr float BORDER_THICKNESS = 2.0f;
+    constexpr float HEADING_THICKNESS = 1.5f;
+    constexpr float MIN_MARKER_PIXELS = 2.0f;  // Keeps small things visible on the overview
+}
+
+MinimapOverlay::MinimapOverlay(const ObstacleManager& obstacles, const PowerupManager& powerups)
+    : obstacles_(obstacles),
+      powerups_(powerups) {
+}
+
+void MinimapOverlay::render(const View& view, float screenX, float screenY, float screenSize,
+                            const SimulationSnapshot& snapshot, const TransformState& vehicle,
+                            const std::array<float, 3>& vehicleSize) {
+    if (!ImGui::GetCurrentContext() || view.halfSize <= 0.0f || screenSize <= 0.0f) {
+        return;
+    }
+
+    ImDrawList* drawList = ImGui::GetForegroundDrawList();
+    const ImVec2 screenMin(screenX, screenY);
+    const ImVec2 screenMax(screenX + screenSize, screenY + screenSize);
+    const float pixelsPerMeter = screenSize / (2.0f * view.halfSize);
+    const float minX = view.centerX - view.halfSize;
+    const float minZ = view.centerZ - view.halfSize;
+    const float maxX = view.centerX + view.halfSize;
+    const float maxZ = view.centerZ + view.halfSize;
+
+    // North up: world +x is screen right, world +z is screen down
+    const auto toScreen = [&](float x, float z) {
+        return ImVec2(screenX + (x - minX) * pixelsPerMeter, screenY + (z - minZ) * pixelsPerMeter);
+    };
+    const auto markerRadius = [&](float radius) {
+        return (std::max)(radius * pixelsPerMeter, MIN_MARKER_PIXELS);
+    };
+
+    drawList->PushClipRect(screenMin, screenMax, true);
+    drawList->AddRectFilled(screenMin, screenMax, GROUND_COLOR);
+
+    const auto& obstacles = obstacles_.getObstacles();
+    obstacles_.queryBox(minX, minZ, maxX, maxZ, visible_);
+    for (std::uint32_t index : visible_) {
+        const Obstacle& obstacle = *obstacles[index];
+        const auto& position = obstacle.getPosition();
+
+        if (obstacle.getType() == ObstacleType::WALL) {
+            const auto& size = obstacle.getSize();
+            const float halfX = size[0] * 0.5f;
+            const float halfZ = size[2] * 0.5f;
+            drawList->AddRectFilled(toScreen(position[0] - halfX, position[2] - halfZ),
+                                    toScreen(position[0] + halfX, position[2] + halfZ), WALL_COLOR);
+        } else {
+            drawList->AddCircleFilled(toScreen(position[0], position[2]),
+                                      markerRadius(obstacle.getCollisionRadius()), TREE_COLOR);
+        }
+    }
+
+    // Only a handful of powerups exist, so they are checked directly
+    const auto& powerups = powerups_.getPowerups();
+    const std::size_t powerupCount = (std::min)(powerups.size(), static_cast<std::size_t>(snapshot.powerupCount));
+    for (std::size_t i = 0; i < powerupCount; ++i) {
+        if (!snapshot.powerupActive[i]) {
+            continue;
+        }
+        const auto& position = powerups[i]->getPosition();
+        const float radius = powerups[i]->getCollisionRadius();
+        if (position[0] + radius < minX || position[0] - radius > maxX ||
+            position[2] + radius < minZ || position[2] - radius > maxZ) {
+            continue;
+        }
+        drawList->AddCircleFilled(toScreen(position[0], position[2]), markerRadius(radius), POWERUP_COLOR);
+    }
+
+    // Vehicle footprint rotated by its heading (local +z is forward)
+    const float sinRotation = std::sin(vehicle.rotation);
+    const float cosRotation = std::cos(vehicle.rotation);
+    const float minHalfExtent = MIN_MARKER_PIXELS / pixelsPerMeter;
+    const float halfWidth = (std::max)(vehicleSize[0] * 0.5f, minHalfExtent);
+    const float halfLength = (std::max)(vehicleSize[2] * 0.5f, minHalfExtent);
+    const auto vehiclePoint = [&](float localX, float localZ) {
+        return toScreen(vehicle.position[0] + localX * cosRotation + localZ * sinRotation,
+                        vehicle.position[2] - localX * sinRotation + localZ * cosRotation);
+    };
+
+    drawList->AddQuadFilled(vehiclePoint(-halfWidth, -halfLength), vehiclePoint(halfWidth, -halfLength),
+                            vehiclePoint(halfWidth, halfLength), vehiclePoint(-halfWidth, halfLength), VEHICLE_COLOR);
+    drawList->AddLine(vehiclePoint(0.0f, 0.0f), vehiclePoint(0.0f, halfLength), HEADING_COLOR, HEADING_THICKNESS);
+
+    drawList->PopClipRect();
+    drawList->AddRect(screenMin, screenMax, BORDER_COLOR, 0.0f, 0, BORDER_THICKNESS);
+}
@@ -0,0 +1,134 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/box_collision.hpp"
+#include "core/counter_rng.hpp"
+#include "core/obstacle.hpp"
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using Catch::Approx;
+
+namespace {
+    OrientedBox makeBox(float x, float z, float rotation, float halfX, float halfZ) {
+        return {x, z, std::cos(rotation), -std::sin(rotation), halfX, halfZ};
+    }
+
+    struct Result {
+        float time;
+        float penetration;
+        float normalX;
+        float normalZ;
+    };
+
+    Result sweepOne(const OrientedBox& mover, float moveX, float moveZ, const OrientedBox& box) {
+        BoxCollisionBatch batch(SimdLevel::SCALAR);
+        batch.add(box);
+        batch.sweep(mover, moveX, moveZ);
+        return {batch.getTimeOfImpact(0), batch.getPenetration(0), batch.getNormalX(0), batch.getNormalZ(0)};
+    }
+}
+
+TEST_CASE("OrientedBox follows the object's footprint", "[box_collision]") {
+    const Obstacle wall(3.0f, 0.0f, -4.0f, ObstacleType::WALL, WallOrientation::VERTICAL);
+    const OrientedBox box = OrientedBox::of(wall);
+
+    REQUIRE(box.centerX == 3.0f);
+    REQUIRE(box.centerZ == -4.0f);
+    REQUIRE(box.axisX == 1.0f);
+    REQUIRE(box.halfExtentX == wall.getSize()[0] / 2.0f);
+    REQUIRE(box.halfExtentZ == wall.getSize()[2] / 2.0f);
+}
+
+TEST_CASE("BoxCollisionBatch overlap at the end of a move", "[box_collision]") {
+    const OrientedBox wall = makeBox(0.0f, 0.0f, 0.0f, 2.5f, 1.0f);
+
+    SECTION("Separated boxes report a gap") {
+        const Result result = sweepOne(makeBox(0.0f, 3.0f, 0.0f, 0.5f, 1.0f), 0.0f, 0.0f, wall);
+        REQUIRE(result.penetration == Approx(-1.0f));
+        REQUIRE(result.time == BoxCollisionBatch::NO_IMPACT);
+    }
+
+    SECTION("Overlap is resolved along the shallowest axis, away from the box") {
+        const Result result = sweepOne(makeBox(0.5f, 1.5f, 0.0f, 0.5f, 1.0f), 0.0f, 0.0f, wall);
+        REQUIRE(result.penetration == Approx(0.5f));
+        REQUIRE(result.normalX == Approx(0.0f).margin(1e-6f));
+        REQUIRE(result.normalZ == Approx(1.0f));
+        REQUIRE(result.time < 0.0f);  // Already touching before the move
+    }
+
+    SECTION("A rotated box clears a corner its bounding circle would hit") {
+        // Diagonal from the wall's corner: the circles overlap, the boxes don't
+        const OrientedBox mover = makeBox(3.0f, 1.5f, std::numbers::pi_v<float> / 4.0f, 0.5f, 0.5f);
+        const Result result = sweepOne(mover, 0.0f, 0.0f, wall);
+        REQUIRE(result.penetration == Approx(0.5f - 0.5f * std::numbers::sqrt2_v<float>));
+        REQUIRE(result.time == BoxCollisionBatch::NO_IMPACT);
+    }
+}
+
+TEST_CASE("BoxCollisionBatch time of impact", "[box_collision]") {
+    const OrientedBox wall = makeBox(0.0f, 0.0f, 0.0f, 1.0f, 2.5f);  // Thin along x
+
+    SECTION("A fast move through a thin box is caught") {
+        // Starts 10 m to the left, ends 10 m to the right: touches once x + 0.5 = -1
+        const Result result = sweepOne(makeBox(-10.0f, 0.0f, 0.0f, 0.5f, 1.0f), 20.0f, 0.0f, wall);
+        REQUIRE(result.time == Approx(8.5f / 20.0f));
+        REQUIRE(result.penetration < 0.0f);  // Already out the other side
+    }
+
+    SECTION("Moves that stop short or pass by don't touch") {
+        REQUIRE(sweepOne(makeBox(-10.0f, 0.0f, 0.0f, 0.5f, 1.0f), 5.0f, 0.0f, wall).time == BoxCollisionBatch::NO_IMPACT);
+        REQUIRE(sweepOne(makeBox(-10.0f, 5.0f, 0.0f, 0.5f, 1.0f), 20.0f, 0.0f, wall).time == BoxCollisionBatch::NO_IMPACT);
+    }
+
+    SECTION("Moving away from a box it overlaps reports a negative time") {
+        const Result result = sweepOne(makeBox(-1.2f, 0.0f, 0.0f, 0.5f, 1.0f), -5.0f, 0.0f, wall);
+        REQUIRE(result.time < 0.0f);
+        REQUIRE(result.penetration < 0.0f);
+    }
+
+    SECTION("A diagonal move hits the first face it reaches") {
+        const Result result = sweepOne(makeBox(-4.0f, -4.0f, 0.0f, 0.5f, 0.5f), 4.0f, 4.0f, wall);
+        // The z faces line up from t = 1 / 4, the x faces only from t = 2.5 / 4
+        REQUIRE(result.time == Approx(2.5f / 4.0f));
+    }
+}
+
+TEST_CASE("BoxCollisionBatch SIMD levels agree bit for bit", "[box_collision][simd]") {
+    constexpr std::size_t BOX_COUNT = 1003;  // Not a multiple of 8 or 16, exercises the scalar tail
+    CounterRng random(2024, RandomStream::TREES);
+
+    std::vector<OrientedBox> boxes;
+    for (std::size_t i = 0; i < BOX_COUNT; ++i) {
+        boxes.push_back(makeBox(random.uniform(-20.0f, 20.0f), random.uniform(-20.0f, 20.0f),
+                                random.uniform(0.0f, 6.3f), random.uniform(0.2f, 3.0f), random.uniform(0.2f, 3.0f)));
+    }
+    const OrientedBox mover = makeBox(-3.0f, 2.0f, 0.7f, 0.5f, 1.0f);
+
+    BoxCollisionBatch reference(SimdLevel::SCALAR);
+    for (const auto& box : boxes) {
+        reference.add(box);
+    }
+    reference.sweep(mover, 9.0f, -4.0f);
+
+    int touched = 0;
+    for (std::size_t i = 0; i < BOX_COUNT; ++i) {
+        touched += reference.getTimeOfImpact(i) <= 1.0f ? 1 : 0;
+    }
+    REQUIRE(touched > 10);
+
+    for (const SimdLevel level : {SimdLevel::AVX2, SimdLevel::AVX512}) {
+        BoxCollisionBatch batch(level);
+        for (const auto& box : boxes) {
+            batch.add(box);
+        }
+        batch.sweep(mover, 9.0f, -4.0f);
+
+        for (std::size_t i = 0; i < BOX_COUNT; ++i) {
+            REQUIRE(batch.getTimeOfImpact(i) == reference.getTimeOfImpact(i));
+            REQUIRE(batch.getPenetration(i) == reference.getPenetration(i));
+            REQUIRE(batch.getNormalX(i) == reference.getNormalX(i));
+            REQUIRE(batch.getNormalZ(i) == reference.getNormalZ(i));
+        }
+    }
+}
@@ -0,0 +1,159 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/contact_solver.hpp"
+#include "core/game_config.hpp"
+#include "core/vehicle.hpp"
+#include <numbers>
+#include <vector>
+
+using Catch::Approx;
+
+namespace {
+    constexpr float PI = std::numbers::pi_v<float>;
+    constexpr float RESTITUTION = GameConfig::Collision::RESTITUTION;
+    constexpr float SLOP = GameConfig::Collision::PENETRATION_SLOP;
+    constexpr float STEP = 1.0f / 60.0f;
+
+    // Heading toward a given direction: the car drives along (sin r, cos r)
+    Vehicle makeVehicle(float rotation, float velocity) {
+        Vehicle vehicle(0.0f, 0.0f, 0.0f);
+        vehicle.setRotation(rotation);
+        vehicle.setVelocity(velocity);
+        return vehicle;
+    }
+}
+
+TEST_CASE("ContactSolver normal response", "[contact_solver]") {
+    ContactSolver solver;
+
+    SECTION("A head-on hit bounces back") {
+        Vehicle vehicle = makeVehicle(PI, 10.0f);  // Driving along -z
+        REQUIRE(solver.solve(vehicle, {{3, 0.0f, 1.0f, 0.0f}}, STEP));
+
+        REQUIRE(vehicle.getVelocity() == Approx(-RESTITUTION * 10.0f));
+        REQUIRE(vehicle.getPosition()[2] == 0.0f);  // Touching, nothing to push out
+    }
+
+    SECTION("A slow approach comes to rest instead of bouncing") {
+        Vehicle vehicle = makeVehicle(PI, 0.5f * GameConfig::Collision::RESTITUTION_MIN_SPEED);
+        solver.solve(vehicle, {{3, 0.0f, 1.0f, 0.0f}}, STEP);
+
+        REQUIRE(vehicle.getVelocity() == Approx(0.0f).margin(1e-6f));
+    }
+
+    SECTION("Moving away from a contact keeps the speed, only the overlap is undone") {
+        Vehicle vehicle = makeVehicle(0.0f, 5.0f);  // Driving along +z, out of the obstacle
+        REQUIRE(solver.solve(vehicle, {{3, 0.0f, 1.0f, 0.1f}}, STEP));
+
+        REQUIRE(vehicle.getVelocity() == 5.0f);
+        REQUIRE(vehicle.getPosition()[2] == Approx(0.1f - SLOP));
+        REQUIRE(solver.getImpulses()[0].normal == 0.0f);
+    }
+
+    SECTION("Overlap within the slop is left alone") {
+        Vehicle vehicle = makeVehicle(0.0f, 5.0f);
+        REQUIRE_FALSE(solver.solve(vehicle, {{3, 0.0f, 1.0f, 0.5f * SLOP}}, STEP));
+        REQUIRE(vehicle.getPosition()[2] == 0.0f);
+    }
+}
+
+TEST_CASE("ContactSolver speculative contacts", "[contact_solver]") {
+    ContactSolver solver;
+    constexpr float GAP = 0.04f;
+
+    SECTION("A slow car keeps closing the gap") {
+        Vehicle vehicle = makeVehicle(PI, 0.5f * GameConfig::Collision::RESTITUTION_MIN_SPEED);
+        REQUIRE_FALSE(solver.solve(vehicle, {{3, 0.0f, 1.0f, -GAP}}, STEP));
+        REQUIRE(vehicle.getVelocity() == 0.5f * GameConfig::Collision::RESTITUTION_MIN_SPEED);
+    }
+
+    SECTION("A fast car only closes the gap within the step, without bouncing") {
+        Vehicle vehicle = makeVehicle(PI, 10.0f);
+        solver.solve(vehicle, {{3, 0.0f, 1.0f, -GAP}}, STEP);
+        REQUIRE(vehicle.getVelocity() == Approx(GAP / STEP));
+        REQUIRE(vehicle.getPosition()[2] == 0.0f);
+    }
+}
+
+TEST_CASE("ContactSolver friction slows a glancing hit", "[contact_solver]") {
+    ContactSolver solver;
+
+    // 45 degrees into a wall whose normal is +z: the normal part bounces, friction takes
+    // mu times the normal impulse off the part along the wall
+    constexpr float SPEED = 10.0f;
+    Vehicle vehicle = makeVehicle(3.0f * PI / 4.0f, SPEED);
+    solver.solve(vehicle, {{0, 0.0f, 1.0f, 0.0f}}, STEP);
+
+    const float along = SPEED / std::numbers::sqrt2_v<float>;
+    const float normalImpulse = (1.0f + RESTITUTION) * along;
+    const float slide = along - GameConfig::Collision::FRICTION * normalImpulse;
+    const float expected = (slide - RESTITUTION * along) / std::numbers::sqrt2_v<float>;
+
+    REQUIRE(vehicle.getVelocity() > 0.0f);
+    REQUIRE(vehicle.getVelocity() == Approx(expected));
+    REQUIRE(solver.getImpulses()[0].normal == Approx(normalImpulse));
+    REQUIRE(solver.getImpulses()[0].tangent == Approx(GameConfig::Collision::FRICTION * normalImpulse));
+}
+
+TEST_CASE("ContactSolver resolves a corner in one solve", "[contact_solver]") {
+    ContactSolver solver;
+
+    // Driving diagonally into the corner between a wall facing +x and one facing +z
+    Vehicle vehicle = makeVehicle(-3.0f * PI / 4.0f, 10.0f);
+    const std::vector<Contact> contacts{{4, 1.0f, 0.0f, 0.1f}, {9, 0.0f, 1.0f, 0.2f}};
+    solver.solve(vehicle, contacts, STEP);
+
+    // Pushed out of both and bounced back out of the corner; friction on each wall takes
+    // something off the bounce from the other
+    REQUIRE(vehicle.getPosition()[0] == Approx(0.1f - SLOP));
+    REQUIRE(vehicle.getPosition()[2] == Approx(0.2f - SLOP));
+    REQUIRE(vehicle.getVelocity() < 0.0f);
+    REQUIRE(vehicle.getVelocity() >= -RESTITUTION * 10.0f - 1e-4f);
+
+    const auto& impulses = solver.getImpulses();
+    REQUIRE(impulses.size() == 2);
+    REQUIRE(impulses[0].obstacle == 4);
+    REQUIRE(impulses[1].obstacle == 9);
+    REQUIRE(impulses[0].normal > 0.0f);
+    REQUIRE(impulses[1].normal > 0.0f);
+}
+
+TEST_CASE("ContactSolver warm starts from the last tick", "[contact_solver]") {
+    ContactSolver solver;
+    const std::vector<Contact> wall{{7, 0.0f, 1.0f, 0.0f}};
+
+    SECTION("A resting contact keeps its impulse") {
+        // Pushing gently into the wall every tick
+        for (int tick = 0; tick < 3; ++tick) {
+            Vehicle vehicle = makeVehicle(PI, 0.5f);
+            solver.solve(vehicle, wall, STEP);
+            REQUIRE(vehicle.getVelocity() == Approx(0.0f).margin(1e-6f));
+        }
+        REQUIRE(solver.getImpulses().size() == 1);
+        REQUIRE(solver.getImpulses()[0].obstacle == 7);
+        REQUIRE(solver.getImpulses()[0].normal == Approx(0.5f));
+    }
+
+    SECTION("A stale impulse is taken back instead of launching the car") {
+        Vehicle vehicle = makeVehicle(PI, 10.0f);
+        solver.solve(vehicle, wall, STEP);
+        REQUIRE(solver.getImpulses()[0].normal > 10.0f);
+
+        // Next tick it has stopped against the wall: last tick's bounce impulse must not apply
+        vehicle.setVelocity(0.0f);
+        solver.solve(vehicle, wall, STEP);
+        REQUIRE(vehicle.getVelocity() == Approx(0.0f).margin(1e-5f));
+        REQUIRE(solver.getImpulses()[0].normal == Approx(0.0f).margin(1e-5f));
+    }
+
+    SECTION("Contacts that end are forgotten") {
+        Vehicle vehicle = makeVehicle(PI, 10.0f);
+        solver.solve(vehicle, wall, STEP);
+        REQUIRE_FALSE(solver.solve(vehicle, {}, STEP));
+        REQUIRE(solver.getImpulses().empty());
+
+        solver.solve(vehicle, wall, STEP);
+        solver.clear();
+        REQUIRE(solver.getImpulses().empty());
+    }
+}
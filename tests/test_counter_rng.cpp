@@ -0,0 +1,64 @@
+#include <catch2/catch_test_macros.hpp>
+#include "core/counter_rng.hpp"
+#include <set>
+
+TEST_CASE("Philox4x32-10 matches the Random123 known answers", "[rng]") {
+    using Block = std::array<std::uint32_t, 4>;
+
+    STATIC_REQUIRE(CounterRng::philox({0, 0, 0, 0}, {0, 0}) ==
+                   Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+    REQUIRE(CounterRng::philox({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}) ==
+            Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+    REQUIRE(CounterRng::philox({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}) ==
+            Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+}
+
+TEST_CASE("CounterRng streams", "[rng]") {
+    CounterRng random(42, RandomStream::TREES);
+
+    SECTION("Sequential draws equal random access") {
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            REQUIRE(random() == random.at(i));
+        }
+        REQUIRE(random.getPosition() == 100);
+    }
+
+    SECTION("Seeds, streams and substreams are independent") {
+        const CounterRng otherSeed(43, RandomStream::TREES);
+        const CounterRng otherStream(42, RandomStream::POWERUPS);
+        const CounterRng otherSubstream(42, RandomStream::TREES, 1);
+
+        std::set<std::uint32_t> firstValues;
+        for (const CounterRng& stream : {random, otherSeed, otherStream, otherSubstream}) {
+            firstValues.insert(stream.at(0));
+        }
+        REQUIRE(firstValues.size() == 4);
+    }
+
+    SECTION("Uniform values stay in range and cover it") {
+        float lowest = 1.0f;
+        float highest = 0.0f;
+        std::array<int, 10> buckets{};
+        for (int i = 0; i < 100000; ++i) {
+            const float value = random.uniform();
+            REQUIRE(value >= 0.0f);
+            REQUIRE(value < 1.0f);
+            lowest = (std::min)(lowest, value);
+            highest = (std::max)(highest, value);
+            ++buckets[static_cast<std::size_t>(value * 10.0f)];
+        }
+        REQUIRE(lowest < 0.001f);
+        REQUIRE(highest > 0.999f);
+        for (int count : buckets) {
+            REQUIRE(count > 9000);
+            REQUIRE(count < 11000);
+        }
+
+        for (int i = 0; i < 1000; ++i) {
+            const float value = random.uniform(-5.0f, 5.0f);
+            REQUIRE(value >= -5.0f);
+            REQUIRE(value <= 5.0f);
+            REQUIRE(random.below(7) < 7u);
+        }
+    }
+}
@@ -0,0 +1,145 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/fixed_timestep.hpp"
+#include "core/transform_state.hpp"
+#include "core/simulation.hpp"
+#include "core/vehicle.hpp"
+
+using Catch::Approx;
+
+TEST_CASE("FixedTimestep accumulates frame time", "[timestep]") {
+    FixedTimestep timestep(60.0f);
+
+    SECTION("Step size follows the tick rate") {
+        REQUIRE(timestep.getStepSize() == Approx(1.0f / 60.0f));
+        REQUIRE(timestep.getTickRate() == Approx(60.0f));
+    }
+
+    SECTION("Short frames accumulate until a step is due") {
+        REQUIRE(timestep.advance(0.01f) == 0);
+        REQUIRE(timestep.getAlpha() == Approx(0.6f).margin(0.001));
+        REQUIRE(timestep.advance(0.01f) == 1);
+        REQUIRE(timestep.getAlpha() == Approx(0.2f).margin(0.001));
+    }
+
+    SECTION("Long frames run several steps") {
+        REQUIRE(timestep.advance(0.05f + 0.001f) == 3);
+    }
+
+    SECTION("Invalid frame times are ignored") {
+        REQUIRE(timestep.advance(-1.0f) == 0);
+        REQUIRE(timestep.advance(0.0f) == 0);
+        REQUIRE(timestep.getAlpha() == 0.0f);
+    }
+
+    SECTION("Huge frames are capped and the excess is dropped") {
+        FixedTimestep capped(60.0f, 4);
+        REQUIRE(capped.advance(0.2f) == 4);
+        REQUIRE(capped.getDroppedTime() > 0.0);
+        REQUIRE(capped.getAlpha() < 1.0f);
+    }
+
+    SECTION("Tick rate is clamped to the configured range") {
+        timestep.setTickRate(10000.0f);
+        REQUIRE(timestep.getTickRate() == Approx(GameConfig::Timing::MAX_TICK_RATE));
+        timestep.setTickRate(1.0f);
+        REQUIRE(timestep.getTickRate() == Approx(GameConfig::Timing::MIN_TICK_RATE));
+    }
+}
+
+TEST_CASE("Step count does not depend on frame rate", "[timestep]") {
+    auto stepsFor = [](float frameRate) {
+        FixedTimestep timestep(60.0f);
+        int steps = 0;
+        const int frames = static_cast<int>(frameRate * 2.0f);
+        for (int i = 0; i < frames; ++i) {
+            steps += timestep.advance(1.0f / frameRate);
+        }
+        return steps;
+    };
+
+    // Two seconds at 60 Hz, give or take the step still sitting in the accumulator
+    REQUIRE(std::abs(stepsFor(30.0f) - 120) <= 1);
+    REQUIRE(std::abs(stepsFor(144.0f) - 120) <= 1);
+}
+
+TEST_CASE("Vehicle decay is frame-rate independent", "[timestep][vehicle]") {
+    auto coastFor = [](float stepSize, bool drift) {
+        Vehicle vehicle(0.0f, 0.0f, 0.0f);
+        vehicle.setVelocity(30.0f);
+        if (drift) {
+            vehicle.startDrift();
+        }
+        const int steps = static_cast<int>(std::round(2.0f / stepSize));
+        for (int i = 0; i < steps; ++i) {
+            vehicle.update(stepSize);
+        }
+        return vehicle.getVelocity();
+    };
+
+    SECTION("Rolling friction") {
+        REQUIRE(coastFor(1.0f / 30.0f, false) == Approx(coastFor(1.0f / 144.0f, false)).epsilon(0.01));
+    }
+
+    SECTION("Drift friction") {
+        REQUIRE(coastFor(1.0f / 30.0f, true) == Approx(coastFor(1.0f / 144.0f, true)).epsilon(0.01));
+    }
+
+    SECTION("Steering returns to center at the same speed") {
+        Vehicle slow(0.0f, 0.0f, 0.0f);
+        Vehicle fast(0.0f, 0.0f, 0.0f);
+        slow.turn(0.5f);
+        fast.turn(0.5f);
+        slow.update(1.0f / 30.0f);
+        fast.update(1.0f / 120.0f);
+        for (int i = 0; i < 3; ++i) {
+            fast.update(1.0f / 120.0f);
+        }
+        REQUIRE(slow.getSteeringInput() == Approx(fast.getSteeringInput()).epsilon(0.001));
+    }
+}
+
+TEST_CASE("Transform interpolation", "[timestep]") {
+    const TransformState previous{{0.0f, 0.0f, 0.0f}, 0.0f};
+    const TransformState current{{10.0f, 0.0f, -4.0f}, 1.0f};
+
+    SECTION("Blends position and rotation") {
+        const TransformState half = interpolateTransform(previous, current, 0.5f);
+        REQUIRE(half.position[0] == Approx(5.0f));
+        REQUIRE(half.position[2] == Approx(-2.0f));
+        REQUIRE(half.rotation == Approx(0.5f));
+    }
+
+    SECTION("Endpoints match the stored states") {
+        REQUIRE(interpolateTransform(previous, current, 0.0f) == previous);
+        REQUIRE(interpolateTransform(previous, current, 1.0f).position == current.position);
+    }
+
+    SECTION("Rotation takes the short way across the 0/2pi wrap") {
+        const TransformState before{{0.0f, 0.0f, 0.0f}, VehicleTuning::TWO_PI - 0.1f};
+        const TransformState after{{0.0f, 0.0f, 0.0f}, 0.1f};
+        const float mid = interpolateTransform(before, after, 0.5f).rotation;
+        REQUIRE(std::abs(std::remainder(mid, VehicleTuning::TWO_PI)) < 0.001f);
+    }
+}
+
+TEST_CASE("Simulation keeps the previous vehicle transform", "[timestep][simulation]") {
+    Simulation simulation(200.0f, 0, 0);
+    ControlState controls;
+    controls.forward = true;
+
+    for (int i = 0; i < 30; ++i) {
+        simulation.step(controls, 1.0f / 60.0f);
+    }
+
+    const Vehicle& vehicle = simulation.getVehicle();
+    REQUIRE(vehicle.getPreviousPosition() != vehicle.getPosition());
+
+    const TransformState atCurrent = vehicle.getInterpolatedTransform(1.0f);
+    REQUIRE(atCurrent.position[2] == Approx(vehicle.getPosition()[2]));
+
+    SECTION("Reset leaves nothing to interpolate") {
+        simulation.reset();
+        REQUIRE(vehicle.getPreviousPosition() == vehicle.getPosition());
+    }
+}
@@ -131,6 +131,46 @@ TEST_CASE("GameObject reset functionality", "[gameobject]") {
     }
 }
 
+TEST_CASE("GameObject version tracks state changes", "[gameobject][changes]") {
+    Powerup powerup(1.0f, 0.0f, 2.0f, PowerupType::NITROUS);
+    std::uint32_t version = powerup.getVersion();
+
+    SECTION("Setters bump the version only when the value changes") {
+        powerup.setPosition(1.0f, 0.0f, 2.0f);
+        powerup.setRotation(0.0f);
+        powerup.setActive(true);
+        REQUIRE(powerup.getVersion() == version);
+
+        powerup.setActive(false);
+        REQUIRE(powerup.getVersion() != version);
+        version = powerup.getVersion();
+
+        powerup.setPosition(3.0f, 0.0f, 2.0f);
+        REQUIRE(powerup.getVersion() != version);
+        version = powerup.getVersion();
+
+        powerup.setRotation(1.0f);
+        REQUIRE(powerup.getVersion() != version);
+    }
+
+    SECTION("Reset bumps the version") {
+        powerup.reset();
+        REQUIRE(powerup.getVersion() != version);
+    }
+
+    SECTION("A moving vehicle changes every step, a parked one doesn't") {
+        Vehicle vehicle(0.0f, 0.0f, 0.0f);
+        vehicle.update(0.016f);
+        const std::uint32_t parked = vehicle.getVersion();
+        vehicle.update(0.016f);
+        REQUIRE(vehicle.getVersion() == parked);
+
+        vehicle.accelerateForward();
+        vehicle.update(0.016f);
+        REQUIRE(vehicle.getVersion() != parked);
+    }
+}
+
 TEST_CASE("GameObject size properties", "[gameobject]") {
     Vehicle vehicle(0.0f, 0.0f, 0.0f);
     Powerup powerup(0.0f, 0.0f, 0.0f, PowerupType::NITROUS);
@@ -0,0 +1,168 @@
+#include <catch2/catch_test_macros.hpp>
+#include "core/input_recording.hpp"
+#include "core/input_script.hpp"
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+    ControlState makeControls(bool forward, bool left, bool drift = false) {
+        ControlState controls;
+        controls.forward = forward;
+        controls.left = left;
+        controls.drift = drift;
+        return controls;
+    }
+
+    InputRecording::World smallWorld(std::uint32_t seed) {
+        InputRecording::World world;
+        world.seed = seed;
+        world.playAreaSize = 100.0f;
+        world.treeCount = 20;
+        world.powerupCount = 5;
+        world.stepSize = 1.0f / 60.0f;
+        return world;
+    }
+
+    std::string serialize(const InputRecording& recording) {
+        std::ostringstream output;
+        recording.save(output);
+        return output.str();
+    }
+
+    InputRecording deserialize(const std::string& bytes) {
+        std::istringstream input(bytes);
+        return InputRecording::load(input);
+    }
+}
+
+TEST_CASE("InputRecording stores only control changes", "[recording]") {
+    InputRecording recording(smallWorld(7));
+    const ControlState idle;
+    const ControlState forward = makeControls(true, false);
+    const ControlState turning = makeControls(true, true);
+
+    recording.record(0, idle);
+    recording.record(1, forward);
+    recording.record(2, forward);
+    recording.record(3, forward);
+    recording.record(4, turning);
+    recording.record(5, turning);
+
+    REQUIRE(recording.getCommands().size() == 3);
+    REQUIRE(recording.getTickCount() == 6);
+    REQUIRE(recording.controlsAt(0) == idle);
+    REQUIRE(recording.controlsAt(3) == forward);
+    REQUIRE(recording.controlsAt(4) == turning);
+    REQUIRE(recording.controlsAt(1000) == turning);
+
+    SECTION("A second command for the same tick replaces the first") {
+        recording.record(5, forward);
+        REQUIRE(recording.getCommands().size() == 4);
+        REQUIRE(recording.controlsAt(5) == forward);
+    }
+
+    SECTION("Ticks must not go backwards") {
+        REQUIRE_THROWS_AS(recording.record(2, idle), std::invalid_argument);
+    }
+
+    SECTION("The tick count covers at least every command") {
+        recording.setTickCount(2);
+        REQUIRE(recording.getTickCount() == 5);
+        recording.setTickCount(100);
+        REQUIRE(recording.getTickCount() == 100);
+    }
+}
+
+TEST_CASE("InputRecording binary round trip", "[recording]") {
+    InputRecording recording(smallWorld(0xDEADBEEF));
+    recording.record(0, makeControls(true, false));
+    recording.record(3, makeControls(true, true, true));
+    recording.record(200, ControlState{});          // Multi-byte tick delta
+    recording.record(1'000'000, makeControls(false, true));
+    recording.setTickCount(2'000'000);
+
+    const std::string bytes = serialize(recording);
+    // Header plus two bytes for most commands: far smaller than a per-tick log
+    REQUIRE(bytes.size() < 64);
+
+    const InputRecording loaded = deserialize(bytes);
+    REQUIRE(loaded.getWorld() == recording.getWorld());
+    REQUIRE(loaded.getTickCount() == recording.getTickCount());
+    REQUIRE(loaded.getCommands() == recording.getCommands());
+
+    SECTION("Malformed files are rejected") {
+        REQUIRE_THROWS_AS(deserialize("not a recording"), std::runtime_error);
+        REQUIRE_THROWS_AS(deserialize(bytes.substr(0, bytes.size() - 1)), std::runtime_error);
+
+        std::string wrongVersion = bytes;
+        wrongVersion[4] = 99;
+        REQUIRE_THROWS_AS(deserialize(wrongVersion), std::runtime_error);
+
+        std::string unknownBits = bytes;
+        unknownBits.back() = static_cast<char>(0x80);
+        REQUIRE_THROWS_AS(deserialize(unknownBits), std::runtime_error);
+    }
+}
+
+TEST_CASE("Same world seed gives the same layout", "[recording]") {
+    const Simulation first(100.0f, 20, 5, 1234);
+    const Simulation second(100.0f, 20, 5, 1234);
+    const Simulation other(100.0f, 20, 5, 4321);
+
+    const auto& obstacles = first.getObstacleManager().getObstacles();
+    const auto& sameObstacles = second.getObstacleManager().getObstacles();
+    const auto& otherObstacles = other.getObstacleManager().getObstacles();
+    REQUIRE(obstacles.size() == sameObstacles.size());
+
+    bool anyDifferent = false;
+    for (std::size_t i = 0; i < obstacles.size(); ++i) {
+        REQUIRE(obstacles[i]->getPosition() == sameObstacles[i]->getPosition());
+        if (i < otherObstacles.size() && obstacles[i]->getPosition() != otherObstacles[i]->getPosition()) {
+            anyDifferent = true;
+        }
+    }
+    REQUIRE(anyDifferent);
+
+    const auto& powerups = first.getPowerupManager().getPowerups();
+    const auto& samePowerups = second.getPowerupManager().getPowerups();
+    for (std::size_t i = 0; i < powerups.size(); ++i) {
+        REQUIRE(powerups[i]->getPosition() == samePowerups[i]->getPosition());
+    }
+}
+
+TEST_CASE("Replays reproduce the recorded trajectory exactly", "[recording]") {
+    constexpr std::uint64_t TICKS = 3000;
+    const InputRecording::World world = smallWorld(42);
+    const InputScript script = InputScript::defaultLap();
+
+    // The original run, recording as it goes
+    Simulation original(world.playAreaSize, world.treeCount, world.powerupCount, world.seed);
+    InputRecording recording(world);
+    std::vector<std::array<float, 3>> trajectory;
+    std::vector<float> rotations;
+    for (std::uint64_t tick = 0; tick < TICKS; ++tick) {
+        const ControlState controls = script.controlsAt(static_cast<double>(tick) * world.stepSize);
+        recording.record(tick, controls);
+        original.step(controls, world.stepSize);
+        trajectory.push_back(original.getVehicle().getPosition());
+        rotations.push_back(original.getVehicle().getRotation());
+    }
+    recording.setTickCount(TICKS);
+
+    // Replayed from the saved bytes, with a freshly generated world
+    InputReplay replay(deserialize(serialize(recording)));
+    for (std::uint64_t tick = 0; tick < TICKS; ++tick) {
+        REQUIRE(replay.step());
+        const Vehicle& vehicle = replay.getSimulation().getVehicle();
+        REQUIRE(vehicle.getPosition() == trajectory[tick]);
+        REQUIRE(vehicle.getRotation() == rotations[tick]);
+    }
+    REQUIRE(replay.isFinished());
+    REQUIRE_FALSE(replay.step());
+
+    const Simulation& replayed = replay.getSimulation();
+    REQUIRE(replayed.getVehicle().getVelocity() == original.getVehicle().getVelocity());
+    REQUIRE(replayed.getVehicle().hasNitrous() == original.getVehicle().hasNitrous());
+    REQUIRE(replayed.getResetCount() == original.getResetCount());
+    REQUIRE(replayed.getPowerupManager().getChanges().serial == original.getPowerupManager().getChanges().serial);
+}
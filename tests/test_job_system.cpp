@@ -0,0 +1,240 @@
+#include <catch2/catch_test_macros.hpp>
+#include "core/job_system.hpp"
+#include "core/obstacle_manager.hpp"
+#include "core/vehicle_manager.hpp"
+#include "core/counter_rng.hpp"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    constexpr float PLAY_AREA_SIZE = 120.0f;
+    constexpr std::size_t VEHICLE_COUNT = 200;
+    constexpr int TICK_COUNT = 300;
+
+    void spawnTraffic(VehicleManager& manager) {
+        CounterRng random(11, RandomStream::TRAFFIC);
+        for (std::size_t i = 0; i < VEHICLE_COUNT; ++i) {
+            manager.add(random.uniform(-50.0f, 50.0f), 0.0f, random.uniform(-50.0f, 50.0f));
+            manager.getVehicle(i).setRotation(random.uniform(0.0f, 6.3f));
+        }
+    }
+
+    void driveTraffic(VehicleManager& manager, const ObstacleManager& obstacles) {
+        ControlState forward;
+        forward.forward = true;
+        ControlState right = forward;
+        right.right = true;
+        for (int tick = 0; tick < TICK_COUNT; ++tick) {
+            for (std::size_t i = 0; i < VEHICLE_COUNT; ++i) {
+                manager.setControls(i, (i + tick / 60) % 4 == 0 ? right : forward);
+            }
+            manager.update(1.0f / 60.0f);
+            manager.resolveCollisions();
+            manager.handleObstacleCollisions(obstacles, 1.0f / 60.0f);
+        }
+    }
+
+    bool sameTraffic(const VehicleManager& first, const VehicleManager& second) {
+        for (std::size_t i = 0; i < VEHICLE_COUNT; ++i) {
+            if (first.getVehicle(i).getPosition() != second.getVehicle(i).getPosition() ||
+                first.getVehicle(i).getVelocity() != second.getVehicle(i).getVelocity()) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST_CASE("JobSystem parallelFor covers every index once", "[job_system]") {
+    for (const unsigned int threadCount : {1u, 4u}) {
+        JobSystem jobs(threadCount);
+        REQUIRE(jobs.getThreadCount() == threadCount);
+
+        for (const std::size_t count : {std::size_t{0}, std::size_t{1}, std::size_t{7}, std::size_t{1000}}) {
+            for (const std::size_t chunkSize : {std::size_t{0}, std::size_t{1}, std::size_t{3}, std::size_t{64}}) {
+                // Catch2 assertions aren't thread safe, so jobs only count
+                std::vector<std::atomic<int>> hits(count);
+                std::atomic<int> emptyChunks{0};
+                jobs.parallelFor("Count", count, chunkSize, [&](std::size_t begin, std::size_t end) {
+                    emptyChunks += begin >= end ? 1 : 0;
+                    for (std::size_t i = begin; i < end; ++i) {
+                        hits[i]++;
+                    }
+                });
+
+                REQUIRE(emptyChunks == 0);
+                for (std::size_t i = 0; i < count; ++i) {
+                    REQUIRE(hits[i] == 1);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("JobSystem parallelFor nests", "[job_system]") {
+    constexpr std::size_t OUTER = 16;
+    constexpr std::size_t INNER = 100;
+
+    JobSystem jobs(4);
+    std::vector<std::atomic<int>> hits(OUTER * INNER);
+    jobs.parallelFor("Outer", OUTER, 1, [&](std::size_t outerBegin, std::size_t outerEnd) {
+        for (std::size_t outer = outerBegin; outer < outerEnd; ++outer) {
+            // The waiting job keeps running queued ones, so this can't deadlock the pool
+            jobs.parallelFor("Inner", INNER, 10, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    hits[outer * INNER + i]++;
+                }
+            });
+        }
+    });
+
+    for (const auto& hit : hits) {
+        REQUIRE(hit == 1);
+    }
+}
+
+TEST_CASE("JobSystem spreads work across threads", "[job_system]") {
+    JobSystem jobs(4);
+
+    // Chunks that take a while, so idle workers get to steal them from the caller
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    jobs.parallelFor("Sleep", 16, 1, [&](std::size_t, std::size_t) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        const std::lock_guard<std::mutex> lock(mutex);
+        threads.insert(std::this_thread::get_id());
+    });
+
+    REQUIRE(threads.size() > 1);
+    REQUIRE(jobs.getStats().executed == 16);
+    REQUIRE(jobs.getStats().stolen > 0);
+}
+
+TEST_CASE("JobSystem task graphs", "[job_system]") {
+    JobSystem jobs(4);
+
+    // Diamond: first, then left and right in any order, then last
+    std::mutex mutex;
+    std::vector<std::string> order;
+    const auto record = [&](const char* name) {
+        return [&, name] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            const std::lock_guard<std::mutex> lock(mutex);
+            order.emplace_back(name);
+        };
+    };
+
+    JobSystem::TaskGraph graph;
+    const auto first = graph.add("First", record("first"));
+    const auto left = graph.add("Left", record("left"));
+    const auto right = graph.add("Right", record("right"));
+    const auto last = graph.add("Last", record("last"));
+    graph.precede(first, left);
+    graph.precede(first, right);
+    graph.precede(left, last);
+    graph.precede(right, last);
+    REQUIRE(graph.size() == 4);
+
+    const auto checkOrder = [&] {
+        REQUIRE(order.size() == 4);
+        REQUIRE(order.front() == "first");
+        REQUIRE(order.back() == "last");
+        REQUIRE(((order[1] == "left" && order[2] == "right") || (order[1] == "right" && order[2] == "left")));
+    };
+
+    SECTION("Tasks wait for their predecessors") {
+        jobs.run(graph);
+        checkOrder();
+    }
+
+    SECTION("A graph runs again from the start") {
+        for (int run = 0; run < 20; ++run) {
+            order.clear();
+            jobs.run(graph);
+            checkOrder();
+        }
+    }
+
+    SECTION("The observer sees every task") {
+        std::vector<JobSystem::TaskTiming> timings;
+        jobs.setTaskObserver([&](const JobSystem::TaskTiming& timing) {
+            const std::lock_guard<std::mutex> lock(mutex);
+            timings.push_back(timing);
+        });
+        jobs.run(graph);
+        jobs.setTaskObserver(nullptr);
+
+        REQUIRE(timings.size() == 4);
+        std::set<std::string> names;
+        for (const auto& timing : timings) {
+            names.insert(timing.name);
+            REQUIRE(timing.endNanoseconds >= timing.startNanoseconds);
+            REQUIRE(timing.threadIndex < jobs.getThreadCount());
+        }
+        REQUIRE(names == std::set<std::string>{"First", "Left", "Right", "Last"});
+    }
+}
+
+TEST_CASE("JobSystem takes work from several outside threads at once", "[job_system]") {
+    constexpr std::size_t COUNT = 20000;
+    constexpr int ROUNDS = 50;
+
+    JobSystem jobs(4);
+    std::vector<std::atomic<int>> hits[2] = {std::vector<std::atomic<int>>(COUNT), std::vector<std::atomic<int>>(COUNT)};
+
+    // Both threads wait in the shared outside deque, so each may run the other's chunks
+    const auto submit = [&](std::size_t submitter) {
+        for (int round = 0; round < ROUNDS; ++round) {
+            jobs.parallelFor("Submit", COUNT, 64, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    hits[submitter][i]++;
+                }
+            });
+        }
+    };
+    std::thread other(submit, 1);
+    submit(0);
+    other.join();
+
+    for (const auto& submitterHits : hits) {
+        for (const auto& hit : submitterHits) {
+            REQUIRE(hit == ROUNDS);
+        }
+    }
+}
+
+TEST_CASE("VehicleManager gives the same result for any thread count", "[job_system][vehicle_manager]") {
+    const ObstacleManager obstacles(PLAY_AREA_SIZE, 40, 3);
+    JobSystem serial(1);
+    VehicleManager expected(serial);
+    spawnTraffic(expected);
+    driveTraffic(expected, obstacles);
+
+    SECTION("On a pool of four") {
+        JobSystem parallel(4);
+        VehicleManager manager(parallel);
+        spawnTraffic(manager);
+        driveTraffic(manager, obstacles);
+        REQUIRE(sameTraffic(manager, expected));
+    }
+
+    SECTION("Two managers driven from two threads on one pool") {
+        JobSystem shared(4);
+        VehicleManager first(shared);
+        VehicleManager second(shared);
+        spawnTraffic(first);
+        spawnTraffic(second);
+
+        std::thread other([&] { driveTraffic(second, obstacles); });
+        driveTraffic(first, obstacles);
+        other.join();
+
+        REQUIRE(sameTraffic(first, expected));
+        REQUIRE(sameTraffic(second, expected));
+    }
+}
@@ -0,0 +1,67 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/lod_selector.hpp"
+
+using Catch::Approx;
+
+TEST_CASE("LodSelector picks levels by distance", "[lod]") {
+    const LodSelector lod({10.0f, 50.0f, 100.0f}, 0.0f);
+    const std::uint8_t culled = lod.getCulledLevel();
+
+    REQUIRE(lod.getLevelCount() == 3);
+    REQUIRE(culled == 3);
+    REQUIRE(lod.select(culled, 0.0f) == 0);
+    REQUIRE(lod.select(culled, 9.9f) == 0);
+    REQUIRE(lod.select(culled, 10.0f) == 1);
+    REQUIRE(lod.select(0, 75.0f) == 2);
+    REQUIRE(lod.select(0, 100.0f) == culled);
+    REQUIRE(lod.getMaxDistance() == Approx(100.0f));
+}
+
+TEST_CASE("LodSelector holds its level inside the hysteresis band", "[lod]") {
+    const LodSelector lod({10.0f, 50.0f, 100.0f}, 0.1f);
+    const std::uint8_t culled = lod.getCulledLevel();
+
+    SECTION("Moving away switches only past the widened boundary") {
+        REQUIRE(lod.select(0, 10.5f) == 0);
+        REQUIRE(lod.select(0, 11.1f) == 1);
+        REQUIRE(lod.select(1, 54.0f) == 1);
+        REQUIRE(lod.select(1, 56.0f) == 2);
+        REQUIRE(lod.select(2, 105.0f) == 2);
+        REQUIRE(lod.select(2, 111.0f) == culled);
+    }
+
+    SECTION("Moving closer switches only inside the narrowed boundary") {
+        REQUIRE(lod.select(1, 9.5f) == 1);
+        REQUIRE(lod.select(1, 8.9f) == 0);
+        REQUIRE(lod.select(culled, 95.0f) == culled);
+        REQUIRE(lod.select(culled, 89.0f) == 2);
+    }
+
+    SECTION("Large jumps skip levels") {
+        REQUIRE(lod.select(0, 500.0f) == culled);
+        REQUIRE(lod.select(culled, 1.0f) == 0);
+    }
+
+    SECTION("A distance jittering around a boundary never flickers") {
+        std::uint8_t level = 0;
+        int switches = 0;
+        for (int frame = 0; frame < 100; ++frame) {
+            const float distance = (frame % 2 == 0) ? 9.6f : 10.4f;
+            const std::uint8_t next = lod.select(level, distance);
+            switches += (next != level) ? 1 : 0;
+            level = next;
+        }
+        REQUIRE(switches == 0);
+        REQUIRE(lod.getMaxDistance() == Approx(110.0f));
+    }
+}
+
+TEST_CASE("LodSelector sorts its switch distances", "[lod]") {
+    const LodSelector lod({50.0f, 10.0f}, 0.0f);
+    REQUIRE(lod.select(lod.getCulledLevel(), 20.0f) == 1);
+
+    const LodSelector empty({}, 0.1f);
+    REQUIRE(empty.select(0, 1.0f) == empty.getCulledLevel());
+    REQUIRE(empty.getMaxDistance() == 0.0f);
+}
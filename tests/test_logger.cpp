@@ -0,0 +1,161 @@
+#include <catch2/catch_test_macros.hpp>
+#include "core/logger.hpp"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    // Records handed to a writer's drain thread, in order
+    struct Capture {
+        std::mutex mutex;
+        std::vector<Logger::Record> records;
+        int flushes = 0;
+
+        Logger::AsyncWriter::WriteFunction writer() {
+            return [this](const Logger::Record& record) {
+                std::lock_guard lock(mutex);
+                records.push_back(record);
+            };
+        }
+
+        Logger::AsyncWriter::FlushFunction flusher() {
+            return [this] {
+                std::lock_guard lock(mutex);
+                ++flushes;
+            };
+        }
+    };
+}
+
+TEST_CASE("Logger formats values into a record", "[logger]") {
+    Logger::Record record;
+    Logger::MessageBuilder builder(record);
+
+    SECTION("Strings, numbers and bools") {
+        const std::string name = "tree";
+        builder.append("Hit ");
+        builder.append(name);
+        builder.append(' ');
+        builder.append(42u);
+        builder.append(" at ");
+        builder.append(-1.5f);
+        builder.append(", solid ");
+        builder.append(true);
+        REQUIRE(record.message() == "Hit tree 42 at -1.5, solid true");
+    }
+
+    SECTION("Overlong messages are cut off with a mark") {
+        const std::string longText(Logger::Record::TEXT_CAPACITY + 10, 'x');
+        builder.append("start ");
+        builder.append(longText);
+        builder.append(" never shown");
+        REQUIRE(record.length == Logger::Record::TEXT_CAPACITY);
+        REQUIRE(record.message().substr(0, 6) == "start ");
+        REQUIRE(record.message().substr(record.length - 4) == "x...");
+    }
+
+    SECTION("Lines carry the level and any subsystem tag") {
+        builder.append("Loaded");
+        record.level = Logger::Level::WARNING;
+        REQUIRE(Logger::format(record) == "[WARNING] Loaded");
+        record.tag = Logger::Tag::LOADERS;
+        REQUIRE(Logger::format(record) == "[WARNING] [loaders] Loaded");
+    }
+}
+
+TEST_CASE("Logger levels are filtered at compile time", "[logger]") {
+    STATIC_REQUIRE(Logger::isEnabled(Logger::Level::ERROR));
+    STATIC_REQUIRE(Logger::isEnabled(Logger::MIN_LEVEL));
+    STATIC_REQUIRE(Logger::isEnabled(Logger::Level::DEBUG) == (CARSIM_LOG_MIN_LEVEL == 0));
+}
+
+TEST_CASE("Logger macros skip the arguments of compiled-out levels", "[logger]") {
+    int evaluated = 0;
+    const auto value = [&evaluated] { return ++evaluated; };
+
+    CARSIM_LOG_DEBUG(Logger::Tag::GENERAL, "Debug value ", value());
+    REQUIRE(evaluated == (Logger::isEnabled(Logger::Level::DEBUG) ? 1 : 0));
+
+    evaluated = 0;
+    CARSIM_LOG_WARNING(Logger::Tag::GENERAL, "Warning value ", value());
+    REQUIRE(evaluated == (Logger::isEnabled(Logger::Level::WARNING) ? 1 : 0));
+}
+
+TEST_CASE("AsyncWriter delivers messages from many threads", "[logger]") {
+    constexpr int THREADS = 4;
+    constexpr int MESSAGES_PER_THREAD = 500;
+
+    Capture capture;
+    {
+        Logger::AsyncWriter writer(capture.writer(), capture.flusher(), 256);
+        REQUIRE(writer.getCapacity() == 256);
+
+        std::vector<std::thread> producers;
+        for (int t = 0; t < THREADS; ++t) {
+            producers.emplace_back([&writer, t] {
+                for (int i = 0; i < MESSAGES_PER_THREAD; ++i) {
+                    // Retry instead of dropping, so every message must arrive
+                    while (!writer.write(Logger::Level::INFO, static_cast<Logger::Tag>(t), t, " ", i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+
+        writer.flush();
+        std::lock_guard lock(capture.mutex);
+        REQUIRE(capture.flushes > 0);
+    }
+
+    // Each producer's messages arrive complete and in the order it wrote them (the retries
+    // also show up as dropped-message warnings)
+    std::vector<int> next(THREADS, 0);
+    for (const auto& record : capture.records) {
+        if (record.level == Logger::Level::WARNING) {
+            continue;
+        }
+        const auto t = static_cast<int>(record.tag);
+        REQUIRE(record.message() == std::to_string(t) + " " + std::to_string(next[t]));
+        ++next[t];
+    }
+    REQUIRE(next == std::vector<int>(THREADS, MESSAGES_PER_THREAD));
+}
+
+TEST_CASE("AsyncWriter drops messages instead of blocking when full", "[logger]") {
+    constexpr int TOTAL = 100;
+
+    std::atomic<bool> released{false};
+    std::atomic<int> delivered{0};
+    std::vector<std::string> lines;
+    {
+        Logger::AsyncWriter writer(
+            [&](const Logger::Record& record) {
+                // Stall the drain thread on the first message until the producer is done
+                while (!released.load()) {
+                    std::this_thread::yield();
+                }
+                lines.push_back(Logger::format(record));
+                ++delivered;
+            },
+            {}, 16);
+
+        int accepted = 0;
+        for (int i = 0; i < TOTAL; ++i) {
+            accepted += writer.write(Logger::Level::DEBUG, Logger::Tag::PHYSICS, i) ? 1 : 0;
+        }
+        REQUIRE(accepted == 16);  // The stalled record keeps its slot until written
+        REQUIRE(writer.getDroppedCount() == static_cast<std::uint64_t>(TOTAL - accepted));
+
+        released.store(true);
+        writer.flush();
+        REQUIRE(delivered.load() == accepted + 1);
+    }
+
+    // The drop is reported once the queue has room again
+    REQUIRE(lines.back() == "[WARNING] " + std::to_string(TOTAL - 16) + " log messages dropped, the queue was full");
+}
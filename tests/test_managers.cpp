@@ -3,6 +3,7 @@
 #include "core/obstacle_manager.hpp"
 #include "core/powerup_manager.hpp"
 #include "core/vehicle.hpp"
+#include <array>
 
 using Catch::Approx;
 
@@ -142,11 +143,112 @@ TEST_CASE("ObstacleManager collision handling", "[obstacle_manager]") {
         vehicle.setPosition(wallPos[0], wallPos[1], wallPos[2]);
         vehicle.setVelocity(10.0f);
 
-        // Handle collision - should detect overlap and stop vehicle
+        // Handle collision - should detect the wall in its path
         smallManager.handleCollisions(vehicle);
 
-        // Should have collided and stopped
-        REQUIRE(vehicle.getVelocity() == 0.0f);
+        // Should have collided: stopped or bouncing back, no longer driving into the wall
+        REQUIRE(vehicle.getVelocity() <= 0.0f);
+    }
+}
+
+TEST_CASE("ObstacleManager sweeps fast vehicles", "[obstacle_manager][ccd]") {
+    constexpr float PLAY_AREA_SIZE = 40.0f;
+    constexpr float HALF_SIZE = PLAY_AREA_SIZE / 2.0f;
+    ObstacleManager manager(PLAY_AREA_SIZE, 0);
+    Vehicle vehicle(0.0f, 0.0f, 0.0f);
+
+    SECTION("A step that jumps over a wall stops in front of it") {
+        // Heading straight at the wall at nitrous speed over a long step: ends past the wall
+        // without touching it
+        vehicle.setRotation(VehicleTuning::PI / 2.0f);
+        vehicle.setPosition(HALF_SIZE + 10.0f, 0.0f, 0.0f);
+        vehicle.setVelocity(VehicleTuning::NITROUS_MAX_SPEED);
+        manager.handleCollisions(vehicle);
+
+        // Head-on, so it bounces back
+        REQUIRE(vehicle.getVelocity() == Approx(-GameConfig::Collision::RESTITUTION * VehicleTuning::NITROUS_MAX_SPEED));
+        REQUIRE(vehicle.getPosition()[2] == 0.0f);
+
+        // Resting against the wall's inner face, nose first
+        const float innerFace = HALF_SIZE - GameConfig::Obstacle::WALL_THICKNESS / 2.0f;
+        const float contactX = innerFace - VehicleTuning::VEHICLE_LENGTH / 2.0f;
+        REQUIRE(vehicle.getPosition()[0] < contactX);
+        REQUIRE(vehicle.getPosition()[0] == Approx(contactX).margin(0.02f));
+
+        // Just clear of it, so the next check leaves the car where it is
+        const auto rested = vehicle.getPosition();
+        vehicle.storePreviousTransform();
+        manager.handleCollisions(vehicle);
+        REQUIRE(vehicle.getPosition() == rested);
+    }
+
+    SECTION("A clear path is left alone") {
+        vehicle.setPosition(5.0f, 0.0f, -5.0f);
+        vehicle.setVelocity(20.0f);
+        manager.handleCollisions(vehicle);
+
+        REQUIRE(vehicle.getVelocity() == 20.0f);
+        REQUIRE(vehicle.getPosition() == std::array<float, 3>{5.0f, 0.0f, -5.0f});
+    }
+
+    SECTION("Moving away from an obstacle it touches is allowed") {
+        // Start in contact with a wall, then step back toward the centre
+        const float contactX = HALF_SIZE - 1.0f;
+        vehicle.setPosition(contactX, 0.0f, 0.0f);
+        vehicle.storePreviousTransform();
+        vehicle.setPosition(contactX - 4.0f, 0.0f, 0.0f);
+        vehicle.setVelocity(-5.0f);
+        manager.handleCollisions(vehicle);
+
+        REQUIRE(vehicle.getVelocity() == -5.0f);
+        REQUIRE(vehicle.getPosition()[0] == contactX - 4.0f);
+    }
+}
+
+TEST_CASE("ObstacleManager tests walls as boxes", "[obstacle_manager][box_collision]") {
+    constexpr float PLAY_AREA_SIZE = 40.0f;
+    constexpr float HALF_SIZE = PLAY_AREA_SIZE / 2.0f;
+    const float innerFace = HALF_SIZE - GameConfig::Obstacle::WALL_THICKNESS / 2.0f;
+    ObstacleManager manager(PLAY_AREA_SIZE, 0);
+    Vehicle vehicle(0.0f, 0.0f, 0.0f);
+
+    SECTION("Driving alongside a wall doesn't touch it") {
+        // Well inside the wall's bounding circle, but 0.2 m clear of its face
+        const float x = innerFace - VehicleTuning::VEHICLE_WIDTH / 2.0f - 0.2f;
+        vehicle.setPosition(x, 0.0f, 1.0f);
+        vehicle.storePreviousTransform();
+        vehicle.setPosition(x, 0.0f, -3.0f);
+        vehicle.setVelocity(15.0f);
+        manager.handleCollisions(vehicle);
+
+        REQUIRE(vehicle.getVelocity() == 15.0f);
+        REQUIRE(vehicle.getPosition()[0] == x);
+    }
+
+    SECTION("Overlap is pushed out through the wall face") {
+        // Teleported a little into the wall: no motion to sweep, so the overlap is resolved
+        const float x = innerFace - VehicleTuning::VEHICLE_WIDTH / 2.0f + 0.3f;
+        vehicle.setPosition(x, 0.0f, 1.0f);
+        vehicle.storePreviousTransform();
+        vehicle.setVelocity(5.0f);
+        manager.handleCollisions(vehicle);
+
+        // Out to within the solver's slop, still driving along the wall
+        REQUIRE(vehicle.getVelocity() == Approx(5.0f));
+        REQUIRE(vehicle.getPosition()[0] == Approx(x - 0.3f + GameConfig::Collision::PENETRATION_SLOP).margin(1e-4f));
+        REQUIRE(vehicle.getPosition()[2] == 1.0f);
+    }
+
+    SECTION("A turned car reaches further") {
+        // Side on to the wall, the car's half length faces it
+        vehicle.setRotation(VehicleTuning::PI / 2.0f);
+        const float x = innerFace - VehicleTuning::VEHICLE_WIDTH / 2.0f - 0.2f;
+        vehicle.setPosition(x, 0.0f, 1.0f);
+        vehicle.storePreviousTransform();
+        manager.handleCollisions(vehicle);
+
+        REQUIRE(vehicle.getPosition()[0] == Approx(innerFace - VehicleTuning::VEHICLE_LENGTH / 2.0f
+                                                   + GameConfig::Collision::PENETRATION_SLOP).margin(1e-4f));
     }
 }
 
@@ -363,6 +465,61 @@ TEST_CASE("PowerupManager reset", "[powerup_manager]") {
     }
 }
 
+TEST_CASE("PowerupManager records state changes", "[powerup_manager][changes]") {
+    PowerupManager manager(5, 100.0f);
+    const auto& powerups = manager.getPowerups();
+    REQUIRE(manager.getChanges().serial == 0);
+
+    // Collect powerup 2
+    Vehicle vehicle(0.0f, 0.0f, 0.0f);
+    const auto position = powerups[2]->getPosition();
+    vehicle.setPosition(position[0], position[1], position[2]);
+    manager.handleCollisions(vehicle);
+    REQUIRE_FALSE(powerups[2]->isActive());
+
+    std::vector<std::uint32_t> changed;
+    const auto collect = [&](std::uint32_t index) { changed.push_back(index); };
+    REQUIRE(manager.getChanges().forEachSince(0, collect));
+    REQUIRE(changed == std::vector<std::uint32_t>{2});
+
+    // Reset only records the powerup that actually flipped back
+    const std::uint64_t synced = manager.getChanges().serial;
+    manager.reset();
+    changed.clear();
+    REQUIRE(manager.getChanges().forEachSince(synced, collect));
+    REQUIRE(changed == std::vector<std::uint32_t>{2});
+
+    // Nothing changed since
+    changed.clear();
+    REQUIRE(manager.getChanges().forEachSince(manager.getChanges().serial, collect));
+    REQUIRE(changed.empty());
+}
+
+TEST_CASE("ChangeList replays recent changes and reports overflow", "[changes]") {
+    ChangeList<4> list;
+    std::vector<std::uint32_t> changed;
+    const auto collect = [&](std::uint32_t index) { changed.push_back(index); };
+
+    for (std::uint32_t i = 10; i < 16; ++i) {
+        list.record(i);
+    }
+    REQUIRE(list.serial == 6);
+
+    SECTION("The last Capacity changes are available in order") {
+        REQUIRE(list.forEachSince(2, collect));
+        REQUIRE(changed == std::vector<std::uint32_t>{12, 13, 14, 15});
+    }
+
+    SECTION("Older changes were overwritten") {
+        REQUIRE_FALSE(list.forEachSince(1, collect));
+        REQUIRE(changed.empty());
+    }
+
+    SECTION("A serial from the future is rejected") {
+        REQUIRE_FALSE(list.forEachSince(7, collect));
+    }
+}
+
 // ==================== Manager Integration Tests ====================
 
 TEST_CASE("Manager integration", "[managers][integration]") {
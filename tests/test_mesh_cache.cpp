@@ -0,0 +1,198 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "loaders/mesh_cache.hpp"
+#include "loaders/mesh_library.hpp"
+#include "loaders/async_mesh_loader.hpp"
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+
+using Catch::Approx;
+
+namespace {
+    MeshData makeTriangleMesh() {
+        MeshData mesh;
+        MeshMaterial material;
+        material.name = "Paint";
+        material.diffuse = {0.8f, 0.1f, 0.1f};
+        material.opacity = 0.5f;
+        mesh.materials.push_back(material);
+
+        MeshPart part;
+        part.name = "Body";
+        part.positions = {-1.0f, 0.0f, 2.0f, 3.0f, 0.5f, 2.0f, 0.0f, 4.0f, -2.0f};
+        part.normals = {0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+        part.uvs = {0.0f, 0.0f, 1.0f, 0.0f, 0.5f, 1.0f};
+        mesh.parts.push_back(part);
+
+        mesh.computeBounds();
+        return mesh;
+    }
+
+    // Scratch files under the system temp directory, removed afterwards
+    struct TempModel {
+        std::filesystem::path path;
+
+        explicit TempModel(const std::string& name)
+            : path(std::filesystem::temp_directory_path() / name) {
+            std::ofstream(path) << "v 0 0 0\n";
+        }
+
+        ~TempModel() {
+            std::error_code error;
+            std::filesystem::remove(path, error);
+            std::filesystem::remove(MeshCache::cachePathFor(path.string()), error);
+        }
+    };
+}
+
+TEST_CASE("MeshData bounds", "[mesh_cache]") {
+    const MeshData mesh = makeTriangleMesh();
+
+    REQUIRE(mesh.boundsMin == std::array<float, 3>{-1.0f, 0.0f, -2.0f});
+    REQUIRE(mesh.boundsMax == std::array<float, 3>{3.0f, 4.0f, 2.0f});
+    REQUIRE(mesh.getCenter()[0] == Approx(1.0f));
+    REQUIRE(mesh.getSize()[1] == Approx(4.0f));
+    REQUIRE(mesh.getVertexCount() == 3);
+
+    MeshData empty;
+    empty.computeBounds();
+    REQUIRE(empty.boundsMin == std::array<float, 3>{0.0f, 0.0f, 0.0f});
+}
+
+TEST_CASE("MeshCache round trip", "[mesh_cache]") {
+    TempModel model("carsim_test_roundtrip.obj");
+    const std::string cachePath = MeshCache::cachePathFor(model.path.string());
+    const std::uint64_t stamp = MeshCache::sourceStamp(model.path.string());
+    const MeshData mesh = makeTriangleMesh();
+
+    REQUIRE(stamp != 0);
+    REQUIRE(MeshCache::write(cachePath, mesh, stamp));
+
+    SECTION("Reads back identical data") {
+        const auto loaded = MeshCache::read(cachePath, stamp);
+        REQUIRE(loaded.has_value());
+        REQUIRE(*loaded == mesh);
+    }
+
+    SECTION("A different source stamp is a miss") {
+        REQUIRE_FALSE(MeshCache::read(cachePath, stamp + 2).has_value());
+    }
+
+    SECTION("A truncated file is a miss") {
+        std::filesystem::resize_file(cachePath, std::filesystem::file_size(cachePath) - 5);
+        REQUIRE_FALSE(MeshCache::read(cachePath, stamp).has_value());
+    }
+
+    SECTION("Missing files give no stamp and no cache") {
+        REQUIRE(MeshCache::sourceStamp("does/not/exist.obj") == 0);
+        REQUIRE_FALSE(MeshCache::read("does/not/exist.obj.meshcache", stamp).has_value());
+    }
+}
+
+TEST_CASE("MeshLibrary parses each file once", "[mesh_cache]") {
+    TempModel model("carsim_test_library.obj");
+    const std::string path = model.path.string();
+
+    int parseCount = 0;
+    const MeshLibrary::Parser parser = [&parseCount](const std::string&) -> std::optional<MeshData> {
+        ++parseCount;
+        return makeTriangleMesh();
+    };
+
+    SECTION("Repeated loads share one copy") {
+        MeshLibrary library(parser);
+        const auto first = library.load(path);
+        const auto second = library.load(path);
+
+        REQUIRE(first != nullptr);
+        REQUIRE(first == second);
+        REQUIRE(parseCount == 1);
+        REQUIRE(library.getStats().memoryHits == 1);
+    }
+
+    SECTION("A new process reads the disk cache instead of parsing") {
+        {
+            MeshLibrary firstRun(parser);
+            REQUIRE(firstRun.load(path) != nullptr);
+        }
+        MeshLibrary secondRun(parser);
+        const auto mesh = secondRun.load(path);
+
+        REQUIRE(mesh != nullptr);
+        REQUIRE(*mesh == makeTriangleMesh());
+        REQUIRE(parseCount == 1);
+        REQUIRE(secondRun.getStats().diskHits == 1);
+    }
+
+    SECTION("Failures are reported and retried on the next load") {
+        bool broken = true;
+        MeshLibrary library([&](const std::string&) -> std::optional<MeshData> {
+            ++parseCount;
+            if (broken) {
+                return std::nullopt;
+            }
+            return makeTriangleMesh();
+        }, false);
+
+        REQUIRE(library.load(path) == nullptr);
+        REQUIRE(library.load(path) == nullptr);
+        REQUIRE(parseCount == 2);
+        REQUIRE(library.getStats().failures == 2);
+
+        broken = false;
+        const auto mesh = library.load(path);
+        REQUIRE(mesh != nullptr);
+        REQUIRE(library.load(path) == mesh);
+        REQUIRE(parseCount == 3);
+    }
+}
+
+TEST_CASE("AsyncMeshLoader loads in the background", "[mesh_cache][threads]") {
+    TempModel model("carsim_test_async.obj");
+    const std::string path = model.path.string();
+
+    std::atomic<int> parseCount{0};
+    MeshLibrary library([&parseCount](const std::string&) -> std::optional<MeshData> {
+        ++parseCount;
+        return makeTriangleMesh();
+    }, false);
+
+    SECTION("Requests for one path share a single load") {
+        AsyncMeshLoader loader(library);
+        const auto first = loader.request(path);
+        const auto second = loader.request(path);
+
+        REQUIRE(first.get() != nullptr);
+        REQUIRE(first.get() == second.get());
+        REQUIRE(isMeshReady(first));
+        REQUIRE(parseCount == 1);
+    }
+
+    SECTION("Missing files resolve to nullptr") {
+        MeshLibrary failing([](const std::string&) -> std::optional<MeshData> { return std::nullopt; }, false);
+        AsyncMeshLoader loader(failing);
+        const auto first = loader.request("missing.obj");
+        REQUIRE(first.get() == nullptr);
+        REQUIRE(failing.getStats().failures == 1);
+
+        // The failure isn't handed out again: the next request is a fresh load
+        const auto second = loader.request("missing.obj");
+        REQUIRE(second.get() == nullptr);
+        REQUIRE(failing.getStats().failures == 2);
+    }
+
+    SECTION("Shutting down with queued work does not hang or throw") {
+        std::vector<AsyncMeshLoader::MeshFuture> futures;
+        {
+            AsyncMeshLoader loader(library);
+            for (int i = 0; i < 50; ++i) {
+                futures.push_back(loader.request(path + std::to_string(i)));
+            }
+        }
+        for (const auto& future : futures) {
+            REQUIRE(isMeshReady(future));
+            REQUIRE_NOTHROW(future.get());
+        }
+    }
+}
@@ -0,0 +1,150 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "loaders/obj_parser.hpp"
+#include <string>
+
+using Catch::Approx;
+
+namespace {
+    const std::string STEERING_WHEEL_PATH = "assets/steeringwheel.obj";
+
+    // Rows of unit quads split over several objects and materials, big enough for many chunks
+    std::string makeLargeObj(int rows, int columns) {
+        std::string text = "# generated\n";
+        for (int r = 0; r <= rows; ++r) {
+            for (int c = 0; c <= columns; ++c) {
+                text += "v " + std::to_string(c) + " 0.5 " + std::to_string(r) + "\n";
+                text += "vt " + std::to_string(c * 0.1f) + " " + std::to_string(r * 0.1f) + "\n";
+            }
+        }
+        text += "vn 0 1 0\n";
+
+        for (int r = 0; r < rows; ++r) {
+            if (r % 40 == 0) text += "o Strip" + std::to_string(r / 40) + "\n";
+            if (r % 25 == 0) text += "usemtl Mat" + std::to_string(r % 2) + "\n";
+            for (int c = 0; c < columns; ++c) {
+                const int a = r * (columns + 1) + c + 1;
+                const int b = a + columns + 1;
+                text += "f " + std::to_string(a) + "/" + std::to_string(a) + "/1 " + std::to_string(a + 1) + "/" +
+                        std::to_string(a + 1) + "/1 " + std::to_string(b + 1) + "/" + std::to_string(b + 1) + "/1 " +
+                        std::to_string(b) + "/" + std::to_string(b) + "/1\n";
+            }
+        }
+        return text;
+    }
+}
+
+TEST_CASE("ObjParser reads faces, objects and materials", "[obj_parser]") {
+    SECTION("Polygons are fan-triangulated") {
+        const auto mesh = ObjParser::parse("v 0 0 0\nv 1 0 0\nv 1 0 1\nv 0 0 1\nf 1 2 3 4\n", "");
+        REQUIRE(mesh.has_value());
+        REQUIRE(mesh->parts.size() == 1);
+        REQUIRE(mesh->getVertexCount() == 6);
+        REQUIRE(mesh->parts[0].normals.empty());
+        REQUIRE(mesh->parts[0].uvs.empty());
+
+        const auto& p = mesh->parts[0].positions;
+        REQUIRE(std::vector<float>(p.begin() + 9, p.end()) == std::vector<float>{0, 0, 0, 1, 0, 1, 0, 0, 1});
+    }
+
+    SECTION("Corner forms and negative indices") {
+        const auto mesh = ObjParser::parse(
+            "v 0 0 0\nv 2 0 0\nv 0 3 0\nvt 0 0\nvt 1 0\nvt 0 1\nvn 0 0 1\n"
+            "f -3/-3/-1 -2/-2/-1 -1/-1/-1\n"
+            "f 1//1 2//1 3//1\n"
+            "f 1/1 2/2 3/3\n", "");
+        REQUIRE(mesh.has_value());
+        const MeshPart& part = mesh->parts[0];
+        REQUIRE(mesh->getVertexCount() == 9);
+        REQUIRE(part.positions[3] == 2.0f);
+        REQUIRE(part.positions[7] == 3.0f);
+        REQUIRE(part.uvs.size() == 18);
+        REQUIRE(part.uvs[5] == 1.0f);
+        REQUIRE(part.normals.size() == 27);
+        // The last face has no normals of its own and gets its flat normal
+        REQUIRE(part.normals[26] == Approx(1.0f));
+        REQUIRE(mesh->boundsMax == std::array<float, 3>{2.0f, 3.0f, 0.0f});
+    }
+
+    SECTION("Objects and usemtl groups become parts") {
+        const auto mesh = ObjParser::parse(
+            "v 0 0 0\nv 1 0 0\nv 0 1 0\n"
+            "f 1 2 3\n"               // Implicit object, named by the o below
+            "o Body\nusemtl Paint\nf 1 2 3\nusemtl Glass\nf 1 2 3\n"
+            "o Wheel\nf 1 2 3\n"      // Keeps Glass
+            "usemtl Rubber\nusemtl Rim\nf 1 2 3\n"
+            "f 1 2 99\n", "");        // Out of range: dropped
+        REQUIRE(mesh.has_value());
+        REQUIRE(mesh->parts.size() == 5);
+        REQUIRE(mesh->parts[0].name == "Body");
+        REQUIRE(mesh->materials[mesh->parts[0].materialIndex].name.empty());
+        REQUIRE(mesh->materials[mesh->parts[1].materialIndex].name == "Paint");
+        REQUIRE(mesh->parts[2].name == "Body");
+        REQUIRE(mesh->materials[mesh->parts[2].materialIndex].name == "Glass");
+        REQUIRE(mesh->parts[3].name == "Wheel");
+        REQUIRE(mesh->materials[mesh->parts[3].materialIndex].name == "Glass");
+        REQUIRE(mesh->materials[mesh->parts[4].materialIndex].name == "Rim");
+        REQUIRE(mesh->parts[4].positions.size() == 9);
+    }
+
+    SECTION("Text without faces is not a model") {
+        REQUIRE_FALSE(ObjParser::parse("v 0 0 0\nv 1 0 0\n", "").has_value());
+        REQUIRE_FALSE(ObjParser::parseFile("assets/does_not_exist.obj").has_value());
+    }
+}
+
+TEST_CASE("ObjParser reads MTL materials", "[obj_parser]") {
+    const auto materials = ObjParser::parseMaterials(
+        "# comment\nnewmtl Paint\nKd 0.8 0.1 0.1\nKs 0.5 0.5 0.5\nNs 250\nd 0.5\n\n"
+        "newmtl Glass\r\nTr 0.75\r\nKe 0 0 1\r\n");
+
+    REQUIRE(materials.size() == 2);
+    REQUIRE(materials[0].name == "Paint");
+    REQUIRE(materials[0].diffuse == std::array<float, 3>{0.8f, 0.1f, 0.1f});
+    REQUIRE(materials[0].specular[1] == 0.5f);
+    REQUIRE(materials[0].shininess == 250.0f);
+    REQUIRE(materials[0].opacity == 0.5f);
+    REQUIRE(materials[1].name == "Glass");
+    REQUIRE(materials[1].opacity == Approx(0.25f));
+    REQUIRE(materials[1].emissive[2] == 1.0f);
+    REQUIRE(materials[1].diffuse == MeshMaterial{}.diffuse);
+}
+
+TEST_CASE("ObjParser gives the same result on any thread count", "[obj_parser][threads]") {
+    const std::string text = makeLargeObj(200, 200);
+    REQUIRE(text.size() > 8 * 64 * 1024);
+
+    const auto single = ObjParser::parse(text, "", 1);
+    REQUIRE(single.has_value());
+    REQUIRE(single->getVertexCount() == 200 * 200 * 6);
+    // Object starts every 40 rows and material switches every 25 give 12 groups
+    REQUIRE(single->parts.size() == 12);
+
+    for (unsigned int threads : {2u, 3u, 8u}) {
+        const auto parallel = ObjParser::parse(text, "", threads);
+        REQUIRE(parallel.has_value());
+        REQUIRE(*parallel == *single);
+    }
+}
+
+TEST_CASE("ObjParser loads the shipped steering wheel", "[obj_parser]") {
+    const auto mesh = ObjParser::parseFile(STEERING_WHEEL_PATH);
+    REQUIRE(mesh.has_value());
+
+    // 7422 quads, one object with one material
+    REQUIRE(mesh->parts.size() == 1);
+    REQUIRE(mesh->getVertexCount() == 7422 * 6);
+    REQUIRE(mesh->parts[0].name == "SteeringWheel.001");
+    REQUIRE(mesh->parts[0].normals.size() == mesh->parts[0].positions.size());
+    REQUIRE(mesh->parts[0].uvs.size() == mesh->getVertexCount() * 2);
+
+    // From steeringwheel.mtl, which has no Kd
+    REQUIRE(mesh->materials.size() == 1);
+    REQUIRE(mesh->materials[0].name == "SteeringWheel.001");
+    REQUIRE(mesh->materials[0].specular[0] == 0.5f);
+    REQUIRE(mesh->materials[0].diffuse == MeshMaterial{}.diffuse);
+
+    const auto singleThreaded = ObjParser::parseFile(STEERING_WHEEL_PATH, 1);
+    REQUIRE(singleThreaded.has_value());
+    REQUIRE(*singleThreaded == *mesh);
+}
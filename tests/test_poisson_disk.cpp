@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/poisson_disk_sampler.hpp"
+#include "core/spatial_grid.hpp"
+#include "core/obstacle_manager.hpp"
+#include "core/game_config.hpp"
+#include <cmath>
+
+using Catch::Approx;
+
+namespace {
+    // Closest pair distance, using the grid so large sets stay cheap to check
+    float closestPairDistance(const std::vector<std::array<float, 2>>& points, float searchRadius) {
+        std::vector<SpatialGrid::Entry> entries;
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            entries.push_back({points[i][0], points[i][1], 0.0f, static_cast<std::uint32_t>(i)});
+        }
+        SpatialGrid grid(searchRadius);
+        grid.build(entries);
+
+        float closest = searchRadius;
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            grid.forEachCandidate(points[i][0], points[i][1], searchRadius, [&](const SpatialGrid::Entry& entry) {
+                if (entry.index != i) {
+                    closest = (std::min)(closest, std::hypot(entry.x - points[i][0], entry.z - points[i][1]));
+                }
+            });
+        }
+        return closest;
+    }
+}
+
+TEST_CASE("PoissonDiskSampler spacing and bounds", "[poisson]") {
+    constexpr float PLAY_AREA_SIZE = 200.0f;
+    constexpr float MARGIN = 15.0f;
+    constexpr float MIN_DISTANCE = 8.0f;
+    constexpr float EXCLUSION_RADIUS = 10.0f;
+
+    PoissonDiskSampler sampler(PLAY_AREA_SIZE, MARGIN, MIN_DISTANCE, 1234);
+    sampler.setExclusionRadius(EXCLUSION_RADIUS);
+    const auto points = sampler.generateAll();
+
+    SECTION("Fills the area") {
+        // A maximal set at 8 m spacing on 170 x 170 m holds a few hundred points
+        REQUIRE(points.size() > 250);
+    }
+
+    SECTION("Honours the minimum distance") {
+        REQUIRE(closestPairDistance(points, MIN_DISTANCE * 2.0f) >= MIN_DISTANCE);
+    }
+
+    SECTION("Stays inside the margin and outside the exclusion disc") {
+        for (const auto& point : points) {
+            REQUIRE(std::abs(point[0]) <= PLAY_AREA_SIZE / 2.0f - MARGIN);
+            REQUIRE(std::abs(point[1]) <= PLAY_AREA_SIZE / 2.0f - MARGIN);
+            REQUIRE(std::hypot(point[0], point[1]) >= EXCLUSION_RADIUS);
+        }
+    }
+}
+
+TEST_CASE("PoissonDiskSampler count handling", "[poisson]") {
+    SECTION("Returns exactly the requested count when it fits") {
+        PoissonDiskSampler sampler(200.0f, 15.0f, 8.0f, 7);
+        REQUIRE(sampler.generate(30).size() == 30);
+    }
+
+    SECTION("Returns what fits when the area is too small") {
+        PoissonDiskSampler sampler(40.0f, 15.0f, 8.0f, 7);
+        const auto points = sampler.generate(100);
+        REQUIRE_FALSE(points.empty());
+        REQUIRE(points.size() < 100);
+    }
+
+    SECTION("Empty when the margin leaves no area") {
+        PoissonDiskSampler sampler(20.0f, 15.0f, 8.0f, 7);
+        REQUIRE(sampler.generate(10).empty());
+    }
+
+    SECTION("Same seed gives the same points") {
+        PoissonDiskSampler first(200.0f, 15.0f, 8.0f, 99);
+        PoissonDiskSampler second(200.0f, 15.0f, 8.0f, 99);
+        REQUIRE(first.generate(50) == second.generate(50));
+    }
+}
+
+TEST_CASE("PoissonDiskSampler chunks in parallel without changing the result", "[poisson]") {
+    constexpr float PLAY_AREA_SIZE = 600.0f;  // Several chunks per axis
+    constexpr float MIN_DISTANCE = 8.0f;
+
+    PoissonDiskSampler sampler(PLAY_AREA_SIZE, 10.0f, MIN_DISTANCE, 2024);
+    const auto serial = sampler.generateAll(1);
+
+    SECTION("Bit-identical for any thread count") {
+        REQUIRE(sampler.generateAll(2) == serial);
+        REQUIRE(sampler.generateAll(7) == serial);
+        REQUIRE(sampler.generate(500, 1) == sampler.generate(500, 4));
+    }
+
+    SECTION("Spacing holds across chunk edges") {
+        REQUIRE(closestPairDistance(serial, MIN_DISTANCE * 2.0f) >= MIN_DISTANCE);
+    }
+
+    SECTION("Another seed gives other points") {
+        PoissonDiskSampler other(PLAY_AREA_SIZE, 10.0f, MIN_DISTANCE, 2025);
+        REQUIRE(other.generateAll(1) != serial);
+    }
+}
+
+TEST_CASE("ObstacleManager places large forests", "[obstacle_manager][poisson]") {
+    constexpr int TREE_COUNT = 100000;
+    // Roughly twice the area the trees need at the minimum spacing
+    const float playAreaSize = std::sqrt(2.0f * TREE_COUNT) * GameConfig::Obstacle::MIN_DISTANCE_BETWEEN_TREES;
+
+    ObstacleManager manager(playAreaSize, TREE_COUNT);
+
+    std::vector<std::array<float, 2>> trees;
+    for (const auto& obstacle : manager.getObstacles()) {
+        if (obstacle->getType() == ObstacleType::TREE) {
+            trees.push_back({obstacle->getPosition()[0], obstacle->getPosition()[2]});
+        }
+    }
+
+    REQUIRE(trees.size() == TREE_COUNT);
+    REQUIRE(closestPairDistance(trees, GameConfig::Obstacle::MIN_DISTANCE_BETWEEN_TREES * 2.0f) >=
+            GameConfig::Obstacle::MIN_DISTANCE_BETWEEN_TREES);
+}
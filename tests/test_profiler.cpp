@@ -0,0 +1,147 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/profiler.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+
+using Catch::Approx;
+
+namespace {
+    constexpr std::int64_t MILLISECOND = 1000000;
+
+    std::size_t countOccurrences(const std::string& text, const std::string& pattern) {
+        std::size_t count = 0;
+        for (std::size_t at = text.find(pattern); at != std::string::npos; at = text.find(pattern, at + 1)) {
+            ++count;
+        }
+        return count;
+    }
+}
+
+TEST_CASE("Profiler records nested zones per frame", "[profiler]") {
+    Profiler profiler;
+    profiler.endFrame(Profiler::nowNanoseconds());
+    {
+        const Profiler::ScopedZone outer(profiler, "Outer");
+        {
+            const Profiler::ScopedZone inner(profiler, "Inner");
+        }
+        const Profiler::ScopedZone sibling(profiler, "Sibling");
+    }
+    profiler.endFrame(Profiler::nowNanoseconds());
+
+    // In start order per finish: inner and sibling end before outer
+    const auto& zones = profiler.getLastFrameZones();
+    REQUIRE(zones.size() == 3);
+    REQUIRE(std::string(zones[0].name) == "Inner");
+    REQUIRE(zones[0].depth == 1);
+    REQUIRE(std::string(zones[1].name) == "Sibling");
+    REQUIRE(zones[1].depth == 1);
+    REQUIRE(std::string(zones[2].name) == "Outer");
+    REQUIRE(zones[2].depth == 0);
+    REQUIRE(zones[2].startNanoseconds <= zones[0].startNanoseconds);
+    REQUIRE(zones[2].endNanoseconds >= zones[1].endNanoseconds);
+
+    // The next frame starts empty
+    profiler.endFrame(Profiler::nowNanoseconds());
+    REQUIRE(profiler.getLastFrameZones().empty());
+}
+
+TEST_CASE("Profiler frame time percentiles", "[profiler]") {
+    Profiler profiler;
+    REQUIRE(profiler.getFrameStats().frameCount == 0);
+
+    // 100 frames of 1..100 ms
+    std::int64_t now = MILLISECOND;
+    profiler.endFrame(now);
+    for (int i = 1; i <= 100; ++i) {
+        now += i * MILLISECOND;
+        profiler.endFrame(now);
+    }
+
+    const auto stats = profiler.getFrameStats();
+    REQUIRE(stats.frameCount == 100);
+    REQUIRE(stats.lastMilliseconds == Approx(100.0f));
+    REQUIRE(stats.p50Milliseconds == Approx(51.0f).margin(1.0f));
+    REQUIRE(stats.p95Milliseconds == Approx(95.0f).margin(1.0f));
+    REQUIRE(stats.p99Milliseconds == Approx(99.0f).margin(1.0f));
+
+    SECTION("Only the last FRAME_HISTORY frames are kept") {
+        for (std::size_t i = 0; i < Profiler::FRAME_HISTORY; ++i) {
+            now += 2 * MILLISECOND;
+            profiler.endFrame(now);
+        }
+        const auto times = profiler.getFrameTimes();
+        REQUIRE(times.size() == Profiler::FRAME_HISTORY);
+        REQUIRE(profiler.getFrameStats().p99Milliseconds == Approx(2.0f));
+    }
+}
+
+TEST_CASE("Profiler ring keeps the newest zones", "[profiler]") {
+    Profiler profiler;
+    profiler.endFrame(1);
+    const std::size_t total = Profiler::ZONES_PER_THREAD + 10;
+    for (std::size_t i = 0; i < total; ++i) {
+        profiler.recordZone("Step", static_cast<std::int64_t>(i) + 10, static_cast<std::int64_t>(i) + 11);
+    }
+    profiler.endFrame(static_cast<std::int64_t>(total) + 20);
+
+    const auto& zones = profiler.getLastFrameZones();
+    REQUIRE(zones.size() == Profiler::ZONES_PER_THREAD);
+    REQUIRE(zones.front().startNanoseconds == 20);
+    REQUIRE(zones.back().startNanoseconds == static_cast<std::int64_t>(total) + 9);
+}
+
+TEST_CASE("Profiler exports a Chrome trace of every thread", "[profiler]") {
+    Profiler profiler;
+    profiler.setThreadName("Main \"loop\"");
+    profiler.recordZone("Render", 5 * MILLISECOND, 7 * MILLISECOND);
+
+    std::thread worker([&] {
+        profiler.setThreadName("Worker");
+        for (int i = 0; i < 3; ++i) {
+            const Profiler::ScopedZone zone(profiler, "Work");
+        }
+    });
+    worker.join();
+
+    const std::string trace = profiler.toChromeTrace();
+    REQUIRE(trace.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0) == 0);
+    REQUIRE(trace.back() == '}');
+    REQUIRE(countOccurrences(trace, "\"ph\":\"M\"") == 2);
+    REQUIRE(countOccurrences(trace, "\"name\":\"Work\"") == 3);
+    REQUIRE(trace.find("\"args\":{\"name\":\"Main \\\"loop\\\"\"}") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"Worker\"") != std::string::npos);
+    REQUIRE(trace.find("\"dur\":2000.000") != std::string::npos);
+}
+
+TEST_CASE("Profiler traces a thread while it records", "[profiler]") {
+    Profiler profiler;
+    std::atomic<bool> stop{false};
+    std::atomic<bool> started{false};
+
+    // Every zone lasts exactly 1 ns, so a slot copied half-overwritten shows up as another duration
+    std::thread worker([&] {
+        for (std::int64_t i = 0; !stop.load(std::memory_order_relaxed); ++i) {
+            profiler.recordZone("Spin", i * 10, i * 10 + 1);
+            started.store(true, std::memory_order_relaxed);
+        }
+    });
+    while (!started.load(std::memory_order_relaxed)) {
+        std::this_thread::yield();
+    }
+
+    std::size_t zones = 0;
+    std::size_t wrongDurations = 0;
+    for (int trace = 0; trace < 20; ++trace) {
+        const std::string json = profiler.toChromeTrace();
+        zones += countOccurrences(json, "\"name\":\"Spin\"");
+        wrongDurations += countOccurrences(json, "\"name\":\"Spin\"") - countOccurrences(json, "\"dur\":0.001}");
+    }
+    stop = true;
+    worker.join();
+
+    REQUIRE(zones > 0);
+    REQUIRE(wrongDurations == 0);
+}
@@ -0,0 +1,63 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/resource_cache.hpp"
+#include <string>
+#include <vector>
+
+using Catch::Approx;
+
+TEST_CASE("ResourceCache sharing", "[resource_cache]") {
+    int created = 0;
+    ResourceCache<std::string, std::vector<float>> cache(
+        [](const std::vector<float>& buffer) { return buffer.size() * sizeof(float); });
+    const auto makeBuffer = [&created] {
+        ++created;
+        return std::make_shared<std::vector<float>>(100, 1.0f);
+    };
+
+    SECTION("Same key returns the same instance") {
+        auto first = cache.acquire("box", makeBuffer);
+        auto second = cache.acquire("box", makeBuffer);
+
+        REQUIRE(first == second);
+        REQUIRE(created == 1);
+        REQUIRE(cache.getLiveCount() == 1);
+    }
+
+    SECTION("Different keys get different instances") {
+        auto box = cache.acquire("box", makeBuffer);
+        auto sphere = cache.acquire("sphere", makeBuffer);
+
+        REQUIRE(box != sphere);
+        REQUIRE(created == 2);
+    }
+
+    SECTION("Resources are released with their last user") {
+        auto first = cache.acquire("box", makeBuffer);
+        first.reset();
+
+        REQUIRE(cache.getLiveCount() == 0);
+        REQUIRE(cache.pruneExpired() == 1);
+
+        auto again = cache.acquire("box", makeBuffer);
+        REQUIRE(created == 2);
+        REQUIRE(cache.getLiveCount() == 1);
+    }
+
+    SECTION("Stats count hits and bytes saved") {
+        auto a = cache.acquire("box", makeBuffer);
+        auto b = cache.acquire("box", makeBuffer);
+        auto c = cache.acquire("box", makeBuffer);
+        auto d = cache.acquire("sphere", makeBuffer);
+
+        const ResourceCacheStats& stats = cache.getStats();
+        REQUIRE(stats.requests == 4);
+        REQUIRE(stats.hits == 2);
+        REQUIRE(stats.getHitRate() == Approx(0.5));
+        REQUIRE(stats.bytesSaved == 2 * 100 * sizeof(float));
+    }
+
+    SECTION("Empty cache reports a zero hit rate") {
+        REQUIRE(cache.getStats().getHitRate() == 0.0);
+    }
+}
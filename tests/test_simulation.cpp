@@ -0,0 +1,232 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/simulation.hpp"
+#include "core/input_script.hpp"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+using Catch::Approx;
+
+TEST_CASE("Simulation initialization", "[simulation]") {
+    Simulation simulation(100.0f, 5, 10);
+
+    SECTION("Creates world objects") {
+        REQUIRE(simulation.getObstacleManager().getCount() > 0);
+        REQUIRE(simulation.getPowerupManager().getCount() == 10);
+    }
+
+    SECTION("Vehicle starts at spawn point") {
+        auto position = simulation.getVehicle().getPosition();
+        REQUIRE(position[0] == Approx(GameConfig::World::SPAWN_POINT_X));
+        REQUIRE(position[2] == Approx(GameConfig::World::SPAWN_POINT_Z));
+        REQUIRE(simulation.getTickCount() == 0);
+    }
+}
+
+TEST_CASE("Simulation stepping with controls", "[simulation]") {
+    Simulation simulation(100.0f, 0, 0);
+
+    ControlState forward;
+    forward.forward = true;
+
+    SECTION("Held forward accelerates the vehicle") {
+        for (int i = 0; i < 10; ++i) {
+            simulation.step(forward, 0.1f);
+        }
+        REQUIRE(simulation.getVehicle().getVelocity() > 0.0f);
+        REQUIRE(simulation.getTickCount() == 10);
+    }
+
+    SECTION("Drift follows press and release") {
+        ControlState drifting = forward;
+        drifting.drift = true;
+
+        simulation.step(drifting, 0.1f);
+        REQUIRE(simulation.getVehicle().isDrifting());
+
+        simulation.step(forward, 0.1f);
+        REQUIRE_FALSE(simulation.getVehicle().isDrifting());
+    }
+
+    SECTION("Reset press respawns the vehicle") {
+        for (int i = 0; i < 10; ++i) {
+            simulation.step(forward, 0.1f);
+        }
+
+        ControlState reset;
+        reset.reset = true;
+        simulation.step(reset, 0.0f);
+
+        REQUIRE(simulation.getVehicle().getVelocity() == 0.0f);
+        REQUIRE(simulation.getVehicle().getPosition()[2] == Approx(GameConfig::World::SPAWN_POINT_Z));
+    }
+}
+
+TEST_CASE("Large steps don't tunnel through obstacles", "[simulation][ccd]") {
+    constexpr float PLAY_AREA_SIZE = 100.0f;
+    constexpr float HALF_SIZE = PLAY_AREA_SIZE / 2.0f;
+    constexpr float STEP = 0.25f;  // Several metres per step at top speed
+
+    Simulation simulation(PLAY_AREA_SIZE, 10, 0);
+    ControlState forward;
+    forward.forward = true;
+
+    float fastest = 0.0f;
+    for (int tick = 0; tick < 400; ++tick) {
+        simulation.step(forward, STEP);
+
+        const Vehicle& vehicle = simulation.getVehicle();
+        fastest = (std::max)(fastest, vehicle.getVelocity());
+        REQUIRE(std::abs(vehicle.getPosition()[0]) < HALF_SIZE);
+        REQUIRE(std::abs(vehicle.getPosition()[2]) < HALF_SIZE);
+    }
+    // Fast enough that a single step would have cleared a wall
+    REQUIRE(fastest * STEP > GameConfig::Obstacle::WALL_THICKNESS);
+}
+
+TEST_CASE("Driving into a wall settles against it", "[simulation][contact_solver]") {
+    constexpr float PLAY_AREA_SIZE = 100.0f;
+    constexpr float STEP = 1.0f / 60.0f;
+    // The car starts at the centre facing -z; its nose rests on the wall's inner face
+    constexpr float REST_Z = -(PLAY_AREA_SIZE / 2.0f - GameConfig::Obstacle::WALL_THICKNESS / 2.0f
+                               - VehicleTuning::VEHICLE_LENGTH / 2.0f);
+
+    Simulation simulation(PLAY_AREA_SIZE, 0, 0);
+    ControlState forward;
+    forward.forward = true;
+
+    // Long enough to reach the wall, bounce and come back to it
+    for (int tick = 0; tick < 20 * 60; ++tick) {
+        simulation.step(forward, STEP);
+    }
+
+    // Still pushing into it: stays put, never deeper than the solver's slop
+    for (int tick = 0; tick < 60; ++tick) {
+        simulation.step(forward, STEP);
+        const Vehicle& vehicle = simulation.getVehicle();
+        REQUIRE(vehicle.getPosition()[2] == Approx(REST_Z).margin(0.02f));
+        REQUIRE(vehicle.getPosition()[2] >= REST_Z - GameConfig::Collision::PENETRATION_SLOP - 1e-4f);
+        REQUIRE(vehicle.getVelocity() < GameConfig::Collision::RESTITUTION_MIN_SPEED);
+    }
+}
+
+TEST_CASE("Coasting slowly into a wall reaches it", "[simulation][contact_solver]") {
+    constexpr float PLAY_AREA_SIZE = 100.0f;
+    constexpr float STEP = 1.0f / 60.0f;
+    constexpr float CREEP_SPEED = 0.8f;  // Below the bounce threshold
+    constexpr float REST_Z = -(PLAY_AREA_SIZE / 2.0f - GameConfig::Obstacle::WALL_THICKNESS / 2.0f
+                               - VehicleTuning::VEHICLE_LENGTH / 2.0f);
+
+    // Coasting in from a little short of the wall, nose first
+    Simulation simulation(PLAY_AREA_SIZE, 0, 0);
+    simulation.getVehicle().setPosition(0.0f, 0.0f, REST_Z + 0.1f);
+    simulation.getVehicle().setVelocity(CREEP_SPEED);
+    for (int tick = 0; tick < 60; ++tick) {
+        simulation.step(STEP);
+    }
+
+    // Touching, up to the sweep's skin, not stopped at the edge of the contact margin
+    const float nose = simulation.getVehicle().getPosition()[2];
+    REQUIRE(nose == Approx(REST_Z).margin(GameConfig::Collision::CONTACT_SKIN + 1e-4f));
+    REQUIRE(nose >= REST_Z - GameConfig::Collision::PENETRATION_SLOP - 1e-4f);
+}
+
+TEST_CASE("Reset forgets wall contacts but not traffic", "[simulation][contact_solver]") {
+    Simulation simulation(100.0f, 0, 0, GameConfig::World::SEED, 5);
+    const auto trafficSpawn = simulation.getTraffic().getVehicle(0).getPosition();
+    ControlState forward;
+    forward.forward = true;
+
+    // Pinned against the wall, so the solver carries impulses from tick to tick
+    for (int tick = 0; tick < 20 * 60; ++tick) {
+        for (std::size_t i = 0; i < simulation.getTraffic().getCount(); ++i) {
+            simulation.getTraffic().setControls(i, forward);
+        }
+        simulation.step(forward, 1.0f / 60.0f);
+    }
+    REQUIRE_FALSE(simulation.getObstacleManager().getContactSolver().getImpulses().empty());
+    const auto trafficPosition = simulation.getTraffic().getVehicle(0).getPosition();
+    const float trafficVelocity = simulation.getTraffic().getVehicle(0).getVelocity();
+    REQUIRE(trafficPosition != trafficSpawn);
+
+    simulation.reset();
+
+    REQUIRE(simulation.getObstacleManager().getContactSolver().getImpulses().empty());
+    REQUIRE(simulation.getTraffic().getVehicle(0).getPosition() == trafficPosition);
+    REQUIRE(simulation.getTraffic().getVehicle(0).getVelocity() == trafficVelocity);
+}
+
+TEST_CASE("Nitrous activates on press edge only", "[simulation][controls]") {
+    Vehicle vehicle(0.0f, 0.0f, 0.0f);
+    vehicle.pickupNitrous();
+
+    ControlState nitrous;
+    nitrous.nitrous = true;
+
+    applyControls(vehicle, nitrous, nitrous, 0.1f);
+    REQUIRE_FALSE(vehicle.isNitrousActive());
+
+    applyControls(vehicle, nitrous, ControlState{}, 0.1f);
+    REQUIRE(vehicle.isNitrousActive());
+}
+
+TEST_CASE("InputScript parsing", "[simulation][script]") {
+    SECTION("Parses durations, glued keys and comments") {
+        std::istringstream text(
+            "# warm-up\n"
+            "1.5 W\n"
+            "\n"
+            "0.5 wa SPACE  # drift left\n"
+            "2 -\n");
+
+        auto script = InputScript::parse(text);
+
+        REQUIRE(script.getSegments().size() == 3);
+        REQUIRE(script.getDuration() == Approx(4.0));
+
+        auto drift = script.getSegments()[1].controls;
+        REQUIRE(drift.forward);
+        REQUIRE(drift.left);
+        REQUIRE(drift.drift);
+        REQUIRE_FALSE(drift.right);
+
+        REQUIRE(script.getSegments()[2].controls == ControlState{});
+    }
+
+    SECTION("Rejects unknown keys and bad durations") {
+        std::istringstream badKey("1.0 WQ\n");
+        REQUIRE_THROWS_AS(InputScript::parse(badKey), std::runtime_error);
+
+        std::istringstream badDuration("fast W\n");
+        REQUIRE_THROWS_AS(InputScript::parse(badDuration), std::runtime_error);
+
+        std::istringstream negative("-1 W\n");
+        REQUIRE_THROWS_AS(InputScript::parse(negative), std::runtime_error);
+    }
+}
+
+TEST_CASE("InputScript lookup", "[simulation][script]") {
+    std::istringstream text("1.0 W\n1.0 S\n");
+    auto script = InputScript::parse(text);
+
+    SECTION("Returns the segment covering the time") {
+        REQUIRE(script.controlsAt(0.5).forward);
+        REQUIRE(script.controlsAt(1.5).backward);
+    }
+
+    SECTION("Loops past the end") {
+        REQUIRE(script.controlsAt(2.5).forward);
+        REQUIRE(script.controlsAt(3.5).backward);
+    }
+
+    SECTION("Empty script gives no input") {
+        InputScript empty;
+        REQUIRE(empty.controlsAt(1.0) == ControlState{});
+    }
+
+    SECTION("Default lap is non-empty") {
+        REQUIRE_FALSE(InputScript::defaultLap().empty());
+    }
+}
@@ -0,0 +1,156 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/triple_buffer.hpp"
+#include "core/simulation_thread.hpp"
+#include <chrono>
+#include <thread>
+
+using Catch::Approx;
+
+namespace {
+    struct Payload {
+        std::uint64_t sequence = 0;
+        std::uint64_t check = 0;  // Always sequence * 3 in a complete value
+    };
+
+    // Poll until the condition holds or the timeout runs out
+    template <typename Condition>
+    bool waitFor(Condition condition, std::chrono::milliseconds timeout = std::chrono::milliseconds(2000)) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (std::chrono::steady_clock::now() < deadline) {
+            if (condition()) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return condition();
+    }
+}
+
+TEST_CASE("TripleBuffer single-threaded behaviour", "[triple_buffer]") {
+    TripleBuffer<Payload> buffer;
+
+    SECTION("Reader sees a default value before the first publish") {
+        REQUIRE_FALSE(buffer.update());
+        REQUIRE(buffer.read().sequence == 0);
+    }
+
+    SECTION("Reader gets the newest published value") {
+        buffer.writeBuffer() = {1, 3};
+        REQUIRE(buffer.publish());
+        buffer.writeBuffer() = {2, 6};
+        REQUIRE_FALSE(buffer.publish());  // Value 1 was replaced before being read
+
+        REQUIRE(buffer.update());
+        REQUIRE(buffer.read().sequence == 2);
+        REQUIRE_FALSE(buffer.update());
+        REQUIRE(buffer.read().sequence == 2);
+    }
+}
+
+TEST_CASE("TripleBuffer never tears across threads", "[triple_buffer][threads]") {
+    TripleBuffer<Payload> buffer;
+    constexpr std::uint64_t COUNT = 200000;
+
+    std::thread writer([&buffer] {
+        for (std::uint64_t i = 1; i <= COUNT; ++i) {
+            Payload& payload = buffer.writeBuffer();
+            payload.sequence = i;
+            payload.check = i * 3;
+            buffer.publish();
+        }
+    });
+
+    std::uint64_t last = 0;
+    bool consistent = true;
+    bool monotonic = true;
+    while (last < COUNT) {
+        if (buffer.update()) {
+            const Payload& payload = buffer.read();
+            consistent = consistent && payload.check == payload.sequence * 3;
+            monotonic = monotonic && payload.sequence > last;
+            last = payload.sequence;
+        }
+    }
+    writer.join();
+
+    REQUIRE(consistent);
+    REQUIRE(monotonic);
+    REQUIRE(last == COUNT);
+}
+
+TEST_CASE("Snapshot captures the simulation", "[simulation][snapshot]") {
+    Simulation simulation(200.0f, 5, 3);
+    ControlState controls;
+    controls.forward = true;
+    for (int i = 0; i < 10; ++i) {
+        simulation.step(controls, 1.0f / 60.0f);
+    }
+
+    SimulationSnapshot snapshot;
+    captureSnapshot(simulation, snapshot);
+
+    REQUIRE(snapshot.tick == 10);
+    REQUIRE(snapshot.vehicle.current.position == simulation.getVehicle().getPosition());
+    REQUIRE(snapshot.vehicle.previous.position == simulation.getVehicle().getPreviousPosition());
+    REQUIRE(snapshot.vehicle.velocity == simulation.getVehicle().getVelocity());
+    REQUIRE(snapshot.powerupCount == 3);
+    REQUIRE(snapshot.powerupChanges.serial == simulation.getPowerupManager().getChanges().serial);
+
+    VehicleStateView view(snapshot.vehicle);
+    REQUIRE(view.getRPM() == simulation.getVehicle().getRPM());
+    REQUIRE(view.getCurrentGear() == simulation.getVehicle().getCurrentGear());
+}
+
+TEST_CASE("SimulationThread ticks on its own", "[simulation][threads]") {
+    Simulation simulation(200.0f, 0, 0);
+    SimulationThread thread(simulation, 120.0f);
+
+    SECTION("Initial snapshot is available before start") {
+        REQUIRE(thread.getSnapshot().tick == 0);
+        REQUIRE(thread.getStepSize() == Approx(1.0f / 120.0f));
+    }
+
+    SECTION("Held controls drive the vehicle") {
+        ControlState controls;
+        controls.forward = true;
+        thread.submitControls(controls);
+        thread.start();
+
+        REQUIRE(waitFor([&thread] {
+            thread.updateSnapshot();
+            return thread.getSnapshot().vehicle.velocity > 1.0f;
+        }));
+
+        thread.stop();
+        REQUIRE_FALSE(thread.isRunning());
+        REQUIRE(thread.getSnapshot().tick > 0);
+        REQUIRE(thread.getSnapshot().stepSize == Approx(1.0f / 120.0f));
+    }
+
+    SECTION("A reset tap is seen even if released before the next tick") {
+        thread.start();
+
+        ControlState tap;
+        tap.reset = true;
+        thread.submitControls(tap);
+        thread.submitControls(ControlState{});
+
+        REQUIRE(waitFor([&thread] {
+            thread.updateSnapshot();
+            return thread.getSnapshot().resetCount == 1;
+        }));
+    }
+
+    SECTION("Interpolation alpha is clamped to the last step") {
+        thread.start();
+        REQUIRE(waitFor([&thread] {
+            thread.updateSnapshot();
+            return thread.getSnapshot().tick > 0;
+        }));
+
+        const std::int64_t tickTime = thread.getSnapshot().tickTimeNanoseconds;
+        REQUIRE(thread.getInterpolationAlpha(tickTime) == 0.0f);
+        REQUIRE(thread.getInterpolationAlpha(tickTime + 1'000'000'000) == 1.0f);
+    }
+}
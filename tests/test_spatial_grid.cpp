@@ -0,0 +1,151 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/spatial_grid.hpp"
+#include "core/obstacle_manager.hpp"
+#include "core/vehicle.hpp"
+#include <algorithm>
+
+using Catch::Approx;
+
+namespace {
+    std::vector<std::uint32_t> candidates(const SpatialGrid& grid, float x, float z, float radius) {
+        std::vector<std::uint32_t> found;
+        grid.forEachCandidate(x, z, radius, [&found](const SpatialGrid::Entry& entry) {
+            found.push_back(entry.index);
+        });
+        std::sort(found.begin(), found.end());
+        found.erase(std::unique(found.begin(), found.end()), found.end());
+        return found;
+    }
+
+    // ObstacleManager::findContacts without the grid: every obstacle tested on its own
+    std::vector<Contact> findContactsLinear(const ObstacleManager& manager, const Vehicle& vehicle) {
+        std::vector<Contact> contacts;
+        for (std::size_t i = 0; i < manager.getCount(); ++i) {
+            Contact contact;
+            if (manager.findContact(vehicle, static_cast<std::uint32_t>(i), contact)) {
+                contacts.push_back(contact);
+            }
+        }
+        // Every segment of a wall reports the same contact
+        std::stable_sort(contacts.begin(), contacts.end(),
+                         [](const Contact& a, const Contact& b) { return a.obstacle < b.obstacle; });
+        contacts.erase(std::unique(contacts.begin(), contacts.end(),
+                                   [](const Contact& a, const Contact& b) { return a.obstacle == b.obstacle; }),
+                       contacts.end());
+        return contacts;
+    }
+}
+
+TEST_CASE("SpatialGrid queries", "[spatial_grid]") {
+    SpatialGrid grid(10.0f);
+
+    SECTION("Empty grid returns nothing") {
+        grid.build({});
+        REQUIRE(candidates(grid, 0.0f, 0.0f, 100.0f).empty());
+    }
+
+    SECTION("Finds entries near the query and skips far ones") {
+        grid.build({
+            {0.0f, 0.0f, 1.0f, 0},
+            {50.0f, 50.0f, 1.0f, 1},
+            {-40.0f, 30.0f, 1.0f, 2},
+        });
+
+        REQUIRE(candidates(grid, 1.0f, 1.0f, 1.0f) == std::vector<std::uint32_t>{0});
+        REQUIRE(candidates(grid, 49.0f, 51.0f, 2.0f) == std::vector<std::uint32_t>{1});
+        REQUIRE(candidates(grid, -40.0f, 30.0f, 100.0f) == std::vector<std::uint32_t>{0, 1, 2});
+    }
+
+    SECTION("Queries outside the bounds return nothing") {
+        grid.build({{0.0f, 0.0f, 1.0f, 0}});
+        REQUIRE(candidates(grid, 500.0f, 0.0f, 1.0f).empty());
+        REQUIRE(candidates(grid, 0.0f, -500.0f, 1.0f).empty());
+    }
+
+    SECTION("Circles spanning several cells are found from each of them") {
+        grid.build({
+            {-30.0f, -30.0f, 0.5f, 0},
+            {30.0f, 30.0f, 0.5f, 1},
+            {0.0f, 0.0f, 12.0f, 2},
+        });
+
+        REQUIRE(grid.getEntryCount() > 3);
+        REQUIRE(candidates(grid, -11.0f, 0.0f, 0.5f) == std::vector<std::uint32_t>{2});
+        REQUIRE(candidates(grid, 11.0f, 0.0f, 0.5f) == std::vector<std::uint32_t>{2});
+        REQUIRE(candidates(grid, 0.0f, 11.0f, 0.5f) == std::vector<std::uint32_t>{2});
+    }
+
+    SECTION("Huge sparse maps get larger cells instead of a huge table") {
+        grid.build({
+            {-1.0e6f, -1.0e6f, 1.0f, 0},
+            {1.0e6f, 1.0e6f, 1.0f, 1},
+        });
+
+        REQUIRE(grid.getCellSize() > 10.0f);
+        REQUIRE(grid.getColumns() <= 4097);
+        REQUIRE(candidates(grid, 1.0e6f, 1.0e6f, 1.0f) == std::vector<std::uint32_t>{1});
+    }
+}
+
+TEST_CASE("ObstacleManager grid matches the linear scan", "[obstacle_manager][spatial_grid]") {
+    constexpr float PLAY_AREA_SIZE = 200.0f;
+    ObstacleManager manager(PLAY_AREA_SIZE, 60);
+
+    REQUIRE(manager.getGrid().getEntryCount() >= manager.getCount());
+
+    // Place the vehicle all over the map, including over the walls and past them
+    std::vector<Contact> withGrid;
+    int collisions = 0;
+    for (float x = -105.0f; x <= 105.0f; x += 0.7f) {
+        for (float z = -105.0f; z <= 105.0f; z += 0.7f) {
+            const Vehicle vehicle(x, 0.0f, z);
+            manager.findContacts(vehicle, withGrid);
+            const std::vector<Contact> linear = findContactsLinear(manager, vehicle);
+
+            REQUIRE(withGrid.size() == linear.size());
+            for (std::size_t i = 0; i < linear.size(); ++i) {
+                REQUIRE(withGrid[i].obstacle == linear[i].obstacle);
+                REQUIRE(withGrid[i].normalX == linear[i].normalX);
+                REQUIRE(withGrid[i].normalZ == linear[i].normalZ);
+                REQUIRE(withGrid[i].penetration == linear[i].penetration);
+            }
+            if (!linear.empty()) {
+                collisions++;
+            }
+        }
+    }
+
+    REQUIRE(collisions > 0);
+}
+
+TEST_CASE("ObstacleManager box query matches a brute-force scan", "[obstacle_manager][spatial_grid]") {
+    ObstacleManager manager(200.0f, 60);
+    const auto& obstacles = manager.getObstacles();
+
+    std::vector<std::uint32_t> found;
+    for (float x = -120.0f; x <= 120.0f; x += 17.0f) {
+        for (float z = -120.0f; z <= 120.0f; z += 13.0f) {
+            for (float halfSize : {1.0f, 15.0f, 60.0f}) {
+                manager.queryBox(x - halfSize, z - halfSize, x + halfSize, z + halfSize, found);
+
+                std::vector<std::uint32_t> expected;
+                for (std::size_t i = 0; i < obstacles.size(); ++i) {
+                    const auto& position = obstacles[i]->getPosition();
+                    const float radius = obstacles[i]->getCollisionRadius();
+                    const float dx = position[0] - std::clamp(position[0], x - halfSize, x + halfSize);
+                    const float dz = position[2] - std::clamp(position[2], z - halfSize, z + halfSize);
+                    if (dx * dx + dz * dz <= radius * radius) {
+                        expected.push_back(static_cast<std::uint32_t>(i));
+                    }
+                }
+                REQUIRE(found == expected);
+            }
+        }
+    }
+
+    SECTION("The whole map returns every obstacle") {
+        manager.queryBox(-200.0f, -200.0f, 200.0f, 200.0f, found);
+        REQUIRE(found.size() == obstacles.size());
+    }
+}
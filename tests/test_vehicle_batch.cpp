@@ -0,0 +1,141 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/vehicle_batch.hpp"
+#include "core/vehicle.hpp"
+#include "core/control_state.hpp"
+#include <cmath>
+#include <vector>
+
+using Catch::Approx;
+
+namespace {
+    constexpr float DT = 1.0f / 60.0f;
+    constexpr int STEPS = 600;
+    constexpr std::size_t FLEET_SIZE = 37;  // not a multiple of 8 or 16, exercises the scalar tail
+
+    // Deterministic mix of driving styles per vehicle so every branch gets used
+    ControlState controlsFor(std::size_t vehicle, int step) {
+        const int phase = (step / 40 + static_cast<int>(vehicle)) % 8;
+        ControlState controls;
+        controls.forward = phase != 3 && phase != 7;
+        controls.backward = phase == 3;
+        controls.left = (phase == 1 || phase == 5) && vehicle % 3 != 0;
+        controls.right = phase == 2 || (phase == 5 && vehicle % 4 == 0);
+        controls.drift = phase == 5 || phase == 6;
+        controls.nitrous = step % 150 < 3;
+        return controls;
+    }
+
+    struct FleetResult {
+        std::vector<Vehicle> reference;
+        VehicleBatch batch;
+    };
+
+    FleetResult runFleet(SimdLevel level) {
+        FleetResult result{{}, VehicleBatch(level)};
+        for (std::size_t i = 0; i < FLEET_SIZE; ++i) {
+            const float x = static_cast<float>(i) * 4.0f;
+            result.reference.emplace_back(x, 0.0f, -10.0f);
+            result.batch.add(x, 0.0f, -10.0f);
+            if (i % 2 == 0) {
+                result.reference.back().pickupNitrous();
+                result.batch.pickupNitrous(i);
+            }
+        }
+
+        std::vector<ControlState> previous(FLEET_SIZE);
+        for (int step = 0; step < STEPS; ++step) {
+            for (std::size_t i = 0; i < FLEET_SIZE; ++i) {
+                const ControlState controls = controlsFor(i, step);
+                applyControls(result.reference[i], controls, previous[i], DT);
+                result.reference[i].update(DT);
+                previous[i] = controls;
+                result.batch.setControls(i, controls);
+            }
+            result.batch.step(DT);
+        }
+        return result;
+    }
+}
+
+TEST_CASE("VehicleBatch initialization", "[vehicle_batch]") {
+    VehicleBatch batch(SimdLevel::SCALAR);
+    const std::size_t index = batch.add(1.0f, 2.0f, 3.0f);
+    const Vehicle vehicle(1.0f, 2.0f, 3.0f);
+
+    REQUIRE(index == 0);
+    REQUIRE(batch.size() == 1);
+    REQUIRE(batch.getPosition(0) == vehicle.getPosition());
+    REQUIRE(batch.getRotation(0) == vehicle.getRotation());
+    REQUIRE(batch.getCurrentGear(0) == vehicle.getCurrentGear());
+    REQUIRE(batch.getRPM(0) == vehicle.getRPM());
+    REQUIRE(batch.getSimdLevel() == SimdLevel::SCALAR);
+}
+
+TEST_CASE("VehicleBatch scalar level matches Vehicle exactly", "[vehicle_batch]") {
+    FleetResult fleet = runFleet(SimdLevel::SCALAR);
+
+    for (std::size_t i = 0; i < FLEET_SIZE; ++i) {
+        const Vehicle& vehicle = fleet.reference[i];
+        REQUIRE(fleet.batch.getPosition(i) == vehicle.getPosition());
+        REQUIRE(fleet.batch.getRotation(i) == vehicle.getRotation());
+        REQUIRE(fleet.batch.getVelocity(i) == vehicle.getVelocity());
+        REQUIRE(fleet.batch.getDriftAngle(i) == vehicle.getDriftAngle());
+        REQUIRE(fleet.batch.getSteeringInput(i) == vehicle.getSteeringInput());
+        REQUIRE(fleet.batch.getCurrentGear(i) == vehicle.getCurrentGear());
+        REQUIRE(fleet.batch.getRPM(i) == vehicle.getRPM());
+        REQUIRE(fleet.batch.isDrifting(i) == vehicle.isDrifting());
+        REQUIRE(fleet.batch.hasNitrous(i) == vehicle.hasNitrous());
+        REQUIRE(fleet.batch.isNitrousActive(i) == vehicle.isNitrousActive());
+        REQUIRE(fleet.batch.getNitrousTimeRemaining(i) == vehicle.getNitrousTimeRemaining());
+    }
+}
+
+TEST_CASE("VehicleBatch vector levels match Vehicle within tolerance", "[vehicle_batch][simd]") {
+    for (const SimdLevel level : {SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (clampSimdLevel(level) != level) {
+            continue;  // not supported on this machine
+        }
+
+        INFO("SIMD level " << simdLevelName(level));
+        FleetResult fleet = runFleet(level);
+        REQUIRE(fleet.batch.getSimdLevel() == level);
+
+        for (std::size_t i = 0; i < FLEET_SIZE; ++i) {
+            const Vehicle& vehicle = fleet.reference[i];
+            const auto position = fleet.batch.getPosition(i);
+
+            REQUIRE(std::abs(position[0] - vehicle.getPosition()[0]) < VEHICLE_BATCH_POSITION_TOLERANCE);
+            REQUIRE(std::abs(position[2] - vehicle.getPosition()[2]) < VEHICLE_BATCH_POSITION_TOLERANCE);
+            REQUIRE(fleet.batch.getVelocity(i) == Approx(vehicle.getVelocity()).margin(0.01));
+            REQUIRE(fleet.batch.getRotation(i) == Approx(vehicle.getRotation()).margin(0.001));
+            REQUIRE(fleet.batch.getCurrentGear(i) == vehicle.getCurrentGear());
+            REQUIRE(fleet.batch.isDrifting(i) == vehicle.isDrifting());
+            REQUIRE(fleet.batch.isNitrousActive(i) == vehicle.isNitrousActive());
+        }
+    }
+}
+
+TEST_CASE("VehicleBatch reset restores spawn state", "[vehicle_batch]") {
+    VehicleBatch batch;
+    batch.add(5.0f, 0.0f, 5.0f);
+    batch.pickupNitrous(0);
+
+    ControlState controls;
+    controls.forward = true;
+    controls.nitrous = true;
+    batch.setControls(0, controls);
+    for (int i = 0; i < 60; ++i) {
+        batch.step(DT);
+    }
+    REQUIRE(batch.getVelocity(0) > 0.0f);
+    REQUIRE(batch.isNitrousActive(0));
+
+    batch.reset(0);
+    REQUIRE(batch.getPosition(0)[0] == 5.0f);
+    REQUIRE(batch.getPosition(0)[2] == 5.0f);
+    REQUIRE(batch.getVelocity(0) == 0.0f);
+    REQUIRE(batch.getRotation(0) == Approx(VehicleTuning::INITIAL_ROTATION_RADIANS));
+    REQUIRE_FALSE(batch.isNitrousActive(0));
+    REQUIRE_FALSE(batch.hasNitrous(0));
+}
@@ -0,0 +1,219 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "core/vehicle_manager.hpp"
+#include "core/counter_rng.hpp"
+#include "core/game_config.hpp"
+#include "core/simulation.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using Catch::Approx;
+
+namespace {
+    constexpr float RESTITUTION = GameConfig::Collision::RESTITUTION;
+
+    // Every pair whose bounding-circle boxes overlap, checked the slow way
+    std::vector<VehicleManager::Pair> bruteForcePairs(const VehicleManager& manager) {
+        std::vector<VehicleManager::Pair> pairs;
+        const auto& vehicles = manager.getVehicles();
+        for (std::uint32_t i = 0; i < vehicles.size(); ++i) {
+            for (std::uint32_t j = i + 1; j < vehicles.size(); ++j) {
+                const float reach = vehicles[i]->getCollisionRadius() + vehicles[j]->getCollisionRadius();
+                if (std::abs(vehicles[i]->getPosition()[0] - vehicles[j]->getPosition()[0]) <= reach &&
+                    std::abs(vehicles[i]->getPosition()[2] - vehicles[j]->getPosition()[2]) <= reach) {
+                    pairs.push_back({i, j});
+                }
+            }
+        }
+        return pairs;
+    }
+
+    std::vector<VehicleManager::Pair> sorted(std::vector<VehicleManager::Pair> pairs) {
+        std::sort(pairs.begin(), pairs.end());
+        return pairs;
+    }
+}
+
+TEST_CASE("VehicleManager sweep and prune matches a brute-force scan", "[vehicle_manager]") {
+    constexpr std::size_t VEHICLE_COUNT = 300;
+    CounterRng random(7, RandomStream::TRAFFIC);
+
+    // Crowded enough that many cars overlap
+    VehicleManager manager;
+    manager.reserve(VEHICLE_COUNT);
+    for (std::size_t i = 0; i < VEHICLE_COUNT; ++i) {
+        manager.add(random.uniform(-40.0f, 40.0f), 0.0f, random.uniform(-40.0f, 40.0f));
+        manager.getVehicle(i).setRotation(random.uniform(0.0f, 6.3f));
+    }
+
+    ControlState forward;
+    forward.forward = true;
+    ControlState left = forward;
+    left.left = true;
+
+    std::size_t pairCount = 0;
+    for (int tick = 0; tick < 30; ++tick) {
+        const auto expected = bruteForcePairs(manager);
+        manager.resolveCollisions();
+        REQUIRE(sorted(manager.getPairs()) == expected);
+        pairCount += expected.size();
+
+        for (std::size_t i = 0; i < VEHICLE_COUNT; ++i) {
+            manager.setControls(i, i % 3 == 0 ? left : forward);
+        }
+        manager.update(1.0f / 60.0f);
+    }
+    REQUIRE(pairCount > 30);
+}
+
+TEST_CASE("VehicleManager re-sorts incrementally", "[vehicle_manager]") {
+    VehicleManager manager;
+    for (int i = 0; i < 50; ++i) {
+        // Added in reverse order along x, so the first sort has work to do
+        manager.add(static_cast<float>(50 - i) * 3.0f, 0.0f, 0.0f);
+    }
+    manager.resolveCollisions();
+    REQUIRE(manager.getSwapCount() > 0);
+
+    SECTION("Nothing moved, nothing to swap") {
+        manager.resolveCollisions();
+        REQUIRE(manager.getSwapCount() == 0);
+    }
+
+    SECTION("Only cars that pass each other swap") {
+        // The last car added sits lowest on x; move it past its neighbour
+        manager.getVehicle(49).setPosition(4.5f, 0.0f, 0.0f);
+        manager.resolveCollisions();
+        REQUIRE(manager.getSwapCount() > 0);
+        REQUIRE(manager.getSwapCount() <= 4);
+    }
+}
+
+TEST_CASE("VehicleManager collision response", "[vehicle_manager]") {
+    VehicleManager manager;
+
+    SECTION("Head-on cars bounce apart") {
+        manager.add(0.0f, 0.0f, 1.0f);  // Facing -z
+        manager.add(0.0f, 0.0f, -1.0f);
+        manager.getVehicle(1).setRotation(0.0f);  // Facing +z, toward the first
+        manager.getVehicle(0).setVelocity(10.0f);
+        manager.getVehicle(1).setVelocity(10.0f);
+
+        manager.resolveCollisions();
+
+        REQUIRE(manager.getVehicle(0).getVelocity() == Approx(-RESTITUTION * 10.0f));
+        REQUIRE(manager.getVehicle(1).getVelocity() == Approx(-RESTITUTION * 10.0f));
+        const float gap = manager.getVehicle(0).getPosition()[2] - manager.getVehicle(1).getPosition()[2];
+        const float reach = 2.0f * manager.getVehicle(0).getCollisionRadius();
+        REQUIRE(gap == Approx(reach - GameConfig::Collision::PENETRATION_SLOP));
+    }
+
+    SECTION("A rear-end hit hands speed to the car in front") {
+        manager.add(0.0f, 0.0f, 1.0f);   // Behind, both facing -z
+        manager.add(0.0f, 0.0f, -1.0f);  // In front
+        manager.getVehicle(0).setVelocity(10.0f);
+        manager.getVehicle(1).setVelocity(2.0f);
+
+        manager.resolveCollisions();
+
+        const float behind = manager.getVehicle(0).getVelocity();
+        const float ahead = manager.getVehicle(1).getVelocity();
+        REQUIRE(behind + ahead == Approx(12.0f));  // Momentum kept
+        REQUIRE(ahead > behind);
+    }
+
+    SECTION("Cars moving apart keep their speed") {
+        manager.add(0.0f, 0.0f, -0.5f);  // Facing -z, away from the other
+        manager.add(0.0f, 0.0f, 0.5f);
+        manager.getVehicle(1).setRotation(0.0f);
+        manager.getVehicle(0).setVelocity(5.0f);
+        manager.getVehicle(1).setVelocity(5.0f);
+
+        manager.resolveCollisions();
+
+        REQUIRE(manager.getVehicle(0).getVelocity() == 5.0f);
+        REQUIRE(manager.getVehicle(1).getVelocity() == 5.0f);
+        REQUIRE(manager.getVehicle(0).getPosition()[2] < -0.5f);
+    }
+
+    SECTION("An outside vehicle only touches the cars it overlaps") {
+        manager.add(1.0f, 0.0f, 0.0f);
+        manager.add(30.0f, 0.0f, 0.0f);
+
+        Vehicle player(0.0f, 0.0f, 0.0f);
+        manager.handleCollisions(player);
+
+        REQUIRE(player.getPosition()[0] < 0.0f);
+        REQUIRE(manager.getVehicle(0).getPosition()[0] > 1.0f);
+        REQUIRE(manager.getVehicle(1).getPosition()[0] == 30.0f);
+    }
+}
+
+TEST_CASE("VehicleManager reset respawns every car", "[vehicle_manager]") {
+    VehicleManager manager;
+    manager.add(5.0f, 0.0f, -3.0f);
+
+    ControlState forward;
+    forward.forward = true;
+    manager.setControls(0, forward);
+    for (int tick = 0; tick < 60; ++tick) {
+        manager.update(1.0f / 60.0f);
+    }
+    REQUIRE(manager.getVehicle(0).getPosition()[2] != -3.0f);
+
+    manager.reset();
+    REQUIRE(manager.getVehicle(0).getPosition() == std::array<float, 3>{5.0f, 0.0f, -3.0f});
+    REQUIRE(manager.getVehicle(0).getVelocity() == 0.0f);
+
+    // Controls were released too
+    manager.update(1.0f / 60.0f);
+    REQUIRE(manager.getVehicle(0).getVelocity() == 0.0f);
+}
+
+TEST_CASE("Simulation traffic", "[vehicle_manager][simulation]") {
+    constexpr float PLAY_AREA_SIZE = 100.0f;
+    constexpr float HALF_SIZE = PLAY_AREA_SIZE / 2.0f;
+
+    Simulation simulation(PLAY_AREA_SIZE, 10, 0, 42, 40);
+    const VehicleManager& traffic = simulation.getTraffic();
+    REQUIRE(traffic.getCount() == 40);
+
+    SECTION("Spawns from the seed, clear of the player") {
+        const Simulation same(PLAY_AREA_SIZE, 10, 0, 42, 40);
+        for (std::size_t i = 0; i < traffic.getCount(); ++i) {
+            const auto& position = traffic.getVehicle(i).getPosition();
+            REQUIRE(position == same.getTraffic().getVehicle(i).getPosition());
+            REQUIRE(std::hypot(position[0], position[2]) >= GameConfig::Traffic::MIN_DISTANCE_FROM_SPAWN);
+        }
+    }
+
+    SECTION("Driven traffic stays inside the walls") {
+        ControlState forward;
+        forward.forward = true;
+        for (int tick = 0; tick < 600; ++tick) {
+            for (std::size_t i = 0; i < traffic.getCount(); ++i) {
+                simulation.getTraffic().setControls(i, forward);
+            }
+            simulation.step(ControlState{}, 1.0f / 60.0f);
+        }
+
+        for (const auto& vehicle : traffic.getVehicles()) {
+            REQUIRE(std::abs(vehicle->getPosition()[0]) < HALF_SIZE);
+            REQUIRE(std::abs(vehicle->getPosition()[2]) < HALF_SIZE);
+        }
+    }
+
+    SECTION("A traffic car can shove the player") {
+        // Put the first car right behind the player, both facing -z, and drive it into them
+        simulation.getTraffic().getVehicle(0).setPosition(0.0f, 0.0f, 2.5f);
+        simulation.getTraffic().getVehicle(0).setVelocity(10.0f);
+
+        for (int tick = 0; tick < 10; ++tick) {
+            simulation.step(ControlState{}, 1.0f / 60.0f);
+        }
+        REQUIRE(simulation.getVehicle().getVelocity() > 0.0f);
+        REQUIRE(simulation.getVehicle().getPosition()[2] < 0.0f);
+    }
+}